@@ -0,0 +1,423 @@
+#include "OpenGEX.h"
+#include "OpenGEXGenerator.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <new>
+#include <string>
+#include <vector>
+
+#ifdef OPENGEX_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef OPENGEX_ZSTD
+#include <zstd.h>
+#endif
+
+using namespace OpenGEX;
+
+namespace
+{
+    std::atomic<uint64> liveSize(0);
+    std::atomic<uint64> peakSize(0);
+
+    // Each allocation is preceded by its size so that the live size can be tracked when it is freed.
+
+    constexpr std::size_t kSizeHeader = 16;
+} // namespace
+
+// Every allocation made through new and delete is tracked. The internal state of zlib and zstd is allocated with
+// malloc and isn't included, but it is the same for both methods.
+
+void* operator new(std::size_t size)
+{
+    char* pointer = static_cast<char*>(malloc(size + kSizeHeader));
+    if (!pointer)
+    {
+        throw std::bad_alloc();
+    }
+
+    *reinterpret_cast<std::size_t*>(pointer) = size;
+
+    uint64 live = liveSize.fetch_add(size, std::memory_order_relaxed) + size;
+    uint64 peak = peakSize.load(std::memory_order_relaxed);
+    while ((live > peak) && (!peakSize.compare_exchange_weak(peak, live, std::memory_order_relaxed)))
+    {
+    }
+
+    return (pointer + kSizeHeader);
+}
+
+void* operator new[](std::size_t size)
+{
+    return (operator new(size));
+}
+
+void operator delete(void* pointer) noexcept
+{
+    if (pointer)
+    {
+        char* base = static_cast<char*>(pointer) - kSizeHeader;
+        liveSize.fetch_sub(*reinterpret_cast<std::size_t*>(base), std::memory_order_relaxed);
+        free(base);
+    }
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    operator delete(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    operator delete(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+    operator delete(pointer);
+}
+
+namespace
+{
+    enum
+    {
+        kDefaultIterationCount = 5,
+        kBaselineChunkSize = 1 << 17
+    };
+
+    typedef std::chrono::steady_clock::time_point TimePoint;
+
+    inline TimePoint GetTime(void)
+    {
+        return (std::chrono::steady_clock::now());
+    }
+
+    inline double GetSeconds(TimePoint startTime, TimePoint endTime)
+    {
+        return (std::chrono::duration<double>(endTime - startTime).count());
+    }
+
+    void ResetPeakSize(void)
+    {
+        peakSize.store(liveSize.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    bool ReadFile(const char* name, std::string* data)
+    {
+        FILE* file = fopen(name, "rb");
+        if (!file)
+        {
+            return (false);
+        }
+
+        fseek(file, 0, SEEK_END);
+        long size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        data->resize(size);
+        size_t actual = fread(data->data(), 1, size, file);
+        fclose(file);
+
+        data->resize(actual);
+        return (true);
+    }
+
+    bool WriteFile(const char* name, const std::string& data)
+    {
+        FILE* file = fopen(name, "wb");
+        if (!file)
+        {
+            return (false);
+        }
+
+        bool success = (fwrite(data.data(), 1, data.size(), file) == data.size());
+        fclose(file);
+        return (success);
+    }
+
+    // The usual way of loading a compressed file: the whole file is read into memory, and it is decompressed into a
+    // string that grows as each chunk of output is appended. The string is then parsed.
+
+    bool DecompressBaseline(const std::string& data, std::string* text)
+    {
+        int32 format = GetCompressionFormat(data.data(), data.size());
+        char  chunk[kBaselineChunkSize];
+
+#ifdef OPENGEX_ZLIB
+
+        if (format == kCompressionGzip)
+        {
+            z_stream stream;
+            memset(&stream, 0, sizeof(z_stream));
+            inflateInit2(&stream, 15 + 16);
+
+            stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+            stream.avail_in = uInt(data.size());
+
+            int status = Z_OK;
+            while (status == Z_OK)
+            {
+                stream.next_out = reinterpret_cast<Bytef*>(chunk);
+                stream.avail_out = kBaselineChunkSize;
+                status = inflate(&stream, Z_NO_FLUSH);
+                text->append(chunk, kBaselineChunkSize - stream.avail_out);
+            }
+
+            inflateEnd(&stream);
+            return (status == Z_STREAM_END);
+        }
+
+#endif
+
+#ifdef OPENGEX_ZSTD
+
+        if (format == kCompressionZstd)
+        {
+            ZSTD_DStream* stream = ZSTD_createDStream();
+            ZSTD_initDStream(stream);
+
+            ZSTD_inBuffer input = {data.data(), data.size(), 0};
+            size_t        status = 1;
+            while ((input.pos < input.size) || (status != 0))
+            {
+                ZSTD_outBuffer output = {chunk, kBaselineChunkSize, 0};
+                status = ZSTD_decompressStream(stream, &output, &input);
+                if ((ZSTD_isError(status)) || ((output.pos == 0) && (input.pos == input.size) && (status != 0)))
+                {
+                    break;
+                }
+
+                text->append(chunk, output.pos);
+            }
+
+            ZSTD_freeDStream(stream);
+            return (status == 0);
+        }
+
+#endif
+
+        if (format == kCompressionNone)
+        {
+            *text = data;
+            return (true);
+        }
+
+        return (false);
+    }
+
+    bool LoadBaseline(const char* name)
+    {
+        std::string data;
+        std::string text;
+
+        if ((!ReadFile(name, &data)) || (!DecompressBaseline(data, &text)))
+        {
+            return (false);
+        }
+
+        OpenGexDataDescription description;
+        return (description.ProcessText(text.c_str()) == kDataOkay);
+    }
+
+    bool LoadStreamed(const char* name)
+    {
+        OpenGexDataDescription description;
+        return (description.ProcessFile(name) == kDataOkay);
+    }
+
+    struct MethodResult
+    {
+        double seconds;
+        uint64 peakSize;
+        bool   success;
+    };
+
+    MethodResult MeasureMethod(const char* name, int32 iterationCount, bool (*load)(const char*))
+    {
+        MethodResult result = {0.0, 0, true};
+
+        for (machine iteration = 0; iteration < iterationCount; iteration++)
+        {
+            uint64 startSize = liveSize.load(std::memory_order_relaxed);
+            ResetPeakSize();
+
+            TimePoint startTime = GetTime();
+            bool      success = (*load)(name);
+            double    seconds = GetSeconds(startTime, GetTime());
+
+            if (!success)
+            {
+                result.success = false;
+                break;
+            }
+
+            result.seconds = ((iteration == 0) || (seconds < result.seconds)) ? seconds : result.seconds;
+            result.peakSize = peakSize.load(std::memory_order_relaxed) - startSize;
+        }
+
+        return (result);
+    }
+
+    void PrintFile(const char* name, int32 iterationCount)
+    {
+        uint64 fileSize = 0;
+        FILE*  file = fopen(name, "rb");
+        if (file)
+        {
+            fseek(file, 0, SEEK_END);
+            fileSize = uint64(Max(ftell(file), 0L));
+            fclose(file);
+        }
+
+        printf("\n%s: %.2f MB compressed, %.2f MB text\n", name, double(fileSize) / 1048576.0, double(GetTextFileSize(name)) / 1048576.0);
+        printf("    %-26s %12s %14s\n", "method", "ms", "peak heap MB");
+
+        static const char* const methodName[2] = {"decompress then parse", "streamed decompression"};
+        static bool (*const loadMethod[2])(const char*) = {&LoadBaseline, &LoadStreamed};
+
+        for (machine k = 0; k < 2; k++)
+        {
+            MethodResult result = MeasureMethod(name, iterationCount, loadMethod[k]);
+            if (result.success)
+            {
+                printf("    %-26s %12.3f %14.2f\n", methodName[k], result.seconds * 1000.0, double(result.peakSize) / 1048576.0);
+            }
+            else
+            {
+                printf("    %-26s failed\n", methodName[k]);
+            }
+        }
+    }
+
+    // Writes a generated scene compressed with each available format and returns the names of the files.
+
+    bool GenerateFiles(const std::filesystem::path& directory, int32 scale, std::vector<std::string>* fileArray)
+    {
+        GeneratorParams params;
+        InitGeneratorParams(&params);
+        params.nodeCount = 256 * scale;
+        params.hierarchyDepth = 4;
+        params.meshCount = 64 * scale;
+        params.vertexCount = 4096;
+        params.lodCount = 1;
+
+        std::string text;
+        GenerateScene(params, &text);
+
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+
+#ifdef OPENGEX_ZLIB
+
+        {
+            z_stream stream;
+            memset(&stream, 0, sizeof(z_stream));
+            deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+
+            std::string data(deflateBound(&stream, uLong(text.size())), 0);
+            stream.next_in = reinterpret_cast<Bytef*>(text.data());
+            stream.avail_in = uInt(text.size());
+            stream.next_out = reinterpret_cast<Bytef*>(data.data());
+            stream.avail_out = uInt(data.size());
+            deflate(&stream, Z_FINISH);
+            data.resize(stream.total_out);
+            deflateEnd(&stream);
+
+            std::string name = (directory / "scene.ogex.gz").string();
+            if (!WriteFile(name.c_str(), data))
+            {
+                return (false);
+            }
+
+            fileArray->push_back(name);
+        }
+
+#endif
+
+#ifdef OPENGEX_ZSTD
+
+        {
+            std::string data(ZSTD_compressBound(text.size()), 0);
+            data.resize(ZSTD_compress(data.data(), data.size(), text.data(), text.size(), 3));
+
+            std::string name = (directory / "scene.ogex.zst").string();
+            if (!WriteFile(name.c_str(), data))
+            {
+                return (false);
+            }
+
+            fileArray->push_back(name);
+        }
+
+#endif
+
+        return (true);
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    int32                    iterationCount = kDefaultIterationCount;
+    int32                    scale = 1;
+    std::vector<std::string> fileArray;
+
+    for (int a = 1; a < argc; a++)
+    {
+        const char* arg = argv[a];
+        if ((strcmp(arg, "--iterations") == 0) && (a + 1 < argc))
+        {
+            iterationCount = Max(atoi(argv[++a]), 1);
+        }
+        else if ((strcmp(arg, "--scale") == 0) && (a + 1 < argc))
+        {
+            scale = Max(atoi(argv[++a]), 1);
+        }
+        else if (arg[0] != '-')
+        {
+            fileArray.push_back(arg);
+        }
+        else
+        {
+            fprintf(stderr, "Usage: CompressionBenchmark [--iterations n] [--scale n] [file.ogex.gz | file.ogex.zst ...]\n");
+            return (1);
+        }
+    }
+
+    // Without files on the command line, a generated scene is compressed into a temporary directory that is removed at the end.
+
+    std::filesystem::path directory;
+    if (fileArray.empty())
+    {
+        directory = std::filesystem::temp_directory_path() / "OpenGEXCompressionBenchmark";
+        if (!GenerateFiles(directory, scale, &fileArray))
+        {
+            fprintf(stderr, "Unable to write %s\n", directory.string().c_str());
+            return (1);
+        }
+
+        if (fileArray.empty())
+        {
+            fprintf(stderr, "The library was built without zlib or zstd\n");
+            return (1);
+        }
+    }
+
+    for (const std::string& name : fileArray)
+    {
+        PrintFile(name.c_str(), iterationCount);
+    }
+
+    if (!directory.empty())
+    {
+        std::error_code error;
+        std::filesystem::remove_all(directory, error);
+    }
+
+    return (0);
+}
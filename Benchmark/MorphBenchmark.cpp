@@ -0,0 +1,198 @@
+#include "OpenGEX.h"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace OpenGEX;
+
+namespace
+{
+    enum
+    {
+        kFaceColumnCount = 128,
+        kFaceRowCount = 96,
+        kFaceVertexCount = kFaceColumnCount * kFaceRowCount,
+        kFaceTargetCount = 100,
+        kBlendIterationCount = 20
+    };
+
+    const int32 kActiveCount[3] = {10, 50, kFaceTargetCount};
+
+    void AppendVertexArray(std::string* text, const char* attrib, uint32 morph, const float* array)
+    {
+        char line[96];
+        snprintf(line, sizeof(line), "VertexArray (attrib = \"%s\", morph = %u)\n{\nfloat[3]\n{\n", attrib, morph);
+        *text += line;
+
+        for (machine a = 0; a < kFaceVertexCount; a++)
+        {
+            snprintf(line, sizeof(line), "{%.9g, %.9g, %.9g}%s\n", array[a * 3], array[a * 3 + 1], array[a * 3 + 2], (a + 1 < kFaceVertexCount) ? "," : "");
+            *text += line;
+        }
+
+        *text += "}\n}\n";
+    }
+
+    // A synthetic face is a grid of vertices with a set of morph targets, each of which moves a round patch
+    // covering a few percent of the vertices, the way facial shapes affect only part of a head. The targets
+    // are written as absolute positions and normals, so the deltas are calculated when the file is processed.
+
+    std::string GenerateFace(void)
+    {
+        std::vector<float> positionArray(kFaceVertexCount * 3);
+        std::vector<float> normalArray(kFaceVertexCount * 3);
+
+        for (machine j = 0; j < kFaceRowCount; j++)
+        {
+            for (machine i = 0; i < kFaceColumnCount; i++)
+            {
+                machine a = j * kFaceColumnCount + i;
+                positionArray[a * 3] = float(i);
+                positionArray[a * 3 + 1] = float(j);
+                positionArray[a * 3 + 2] = 0.0F;
+                normalArray[a * 3] = 0.0F;
+                normalArray[a * 3 + 1] = 0.0F;
+                normalArray[a * 3 + 2] = 1.0F;
+            }
+        }
+
+        std::string text = "GeometryObject\n{\nMesh\n{\n";
+        AppendVertexArray(&text, "position", 0, positionArray.data());
+        AppendVertexArray(&text, "normal", 0, normalArray.data());
+
+        uint32 seed = 1;
+        auto   random = [&seed](void) -> float {
+            seed = seed * 1664525U + 1013904223U;
+            return (float(seed >> 8) * (1.0F / 16777216.0F));
+        };
+
+        std::vector<float> targetPosition(kFaceVertexCount * 3);
+        std::vector<float> targetNormal(kFaceVertexCount * 3);
+
+        for (machine t = 0; t < kFaceTargetCount; t++)
+        {
+            float cx = random() * float(kFaceColumnCount);
+            float cy = random() * float(kFaceRowCount);
+            float radius = 6.0F + random() * 10.0F;
+
+            for (machine j = 0; j < kFaceRowCount; j++)
+            {
+                for (machine i = 0; i < kFaceColumnCount; i++)
+                {
+                    machine a = j * kFaceColumnCount + i;
+                    float   dx = float(i) - cx;
+                    float   dy = float(j) - cy;
+                    float   f = 1.0F - (dx * dx + dy * dy) / (radius * radius);
+                    f = (f > 0.0F) ? f * f : 0.0F;
+
+                    targetPosition[a * 3] = positionArray[a * 3] + dx * f * 0.1F;
+                    targetPosition[a * 3 + 1] = positionArray[a * 3 + 1] + dy * f * 0.1F;
+                    targetPosition[a * 3 + 2] = positionArray[a * 3 + 2] + f;
+                    targetNormal[a * 3] = normalArray[a * 3] - dx * f * 0.05F;
+                    targetNormal[a * 3 + 1] = normalArray[a * 3 + 1] - dy * f * 0.05F;
+                    targetNormal[a * 3 + 2] = normalArray[a * 3 + 2];
+                }
+            }
+
+            AppendVertexArray(&text, "position", uint32(t + 1), targetPosition.data());
+            AppendVertexArray(&text, "normal", uint32(t + 1), targetNormal.data());
+        }
+
+        text += "}\n}\n";
+        return (text);
+    }
+
+    // Returns the average time in milliseconds to blend the first activeCount targets of the mesh into the output arrays.
+
+    float MeasureBlend(const MeshStructure* meshStructure, int32 activeCount, float* positionArray, float* normalArray)
+    {
+        const MorphTarget* targetArray[kFaceTargetCount];
+        float              weightArray[kFaceTargetCount];
+
+        const MorphTarget* morphTarget = meshStructure->GetMorphTargetArray();
+        for (machine t = 0; t < activeCount; t++)
+        {
+            targetArray[t] = &morphTarget[t];
+            weightArray[t] = 0.5F / float(t + 1);
+        }
+
+        MorphStream positionStream = {static_cast<const float*>(meshStructure->FindVertexArray("position")->GetVertexArrayData()), positionArray};
+        MorphStream normalStream = {static_cast<const float*>(meshStructure->FindVertexArray("normal")->GetVertexArrayData()), normalArray};
+
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+        for (machine i = 0; i < kBlendIterationCount; i++)
+        {
+            BlendMorphTargets(targetArray, weightArray, activeCount, kFaceVertexCount, positionStream, normalStream, nullptr);
+        }
+
+        std::chrono::steady_clock::time_point endTime = std::chrono::steady_clock::now();
+        return (std::chrono::duration<float, std::milli>(endTime - startTime).count() / float(kBlendIterationCount));
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::string text = GenerateFace();
+
+    // Every target is stored densely first, and then the same targets are rebuilt with every target stored sparsely.
+
+    OpenGexDataDescription description;
+    description.SetMorphSparseThreshold(0.0F);
+
+    DataResult result = description.ProcessText(text.c_str());
+    if (result != kDataOkay)
+    {
+        fprintf(stderr, "ProcessText failed: %s\n", OpenGEX::DataResultToString(result).c_str());
+        return (1);
+    }
+
+    MeshStructure* meshStructure = description.GetMeshList()->front();
+    if ((meshStructure->GetVertexCount() != kFaceVertexCount) || (meshStructure->GetMorphTargetCount() != kFaceTargetCount))
+    {
+        fprintf(stderr, "The face has %d vertices and %d targets\n", meshStructure->GetVertexCount(), meshStructure->GetMorphTargetCount());
+        return (1);
+    }
+
+    uint32 denseSize = meshStructure->GetMorphStatistics().storedSize;
+
+    std::vector<float> densePosition[3];
+    std::vector<float> denseNormal[3];
+    float              denseTime[3];
+
+    for (machine k = 0; k < 3; k++)
+    {
+        densePosition[k].resize(kFaceVertexCount * 3);
+        denseNormal[k].resize(kFaceVertexCount * 3);
+        denseTime[k] = MeasureBlend(meshStructure, kActiveCount[k], densePosition[k].data(), denseNormal[k].data());
+    }
+
+    description.SetMorphSparseThreshold(1.0F);
+    meshStructure->BuildMorphTargets(&description);
+    uint32 sparseSize = meshStructure->GetMorphStatistics().storedSize;
+
+    printf("Synthetic face: %d vertices, %d targets\n", int32(kFaceVertexCount), int32(kFaceTargetCount));
+    printf("Dense deltas:  %10u bytes\n", denseSize);
+    printf("Sparse deltas: %10u bytes (%.1f%% saved)\n", sparseSize, 100.0F * (1.0F - float(sparseSize) / float(denseSize)));
+
+    printf("\n%8s  %12s  %12s  %12s\n", "active", "dense ms", "sparse ms", "max error");
+
+    std::vector<float> sparsePosition(kFaceVertexCount * 3);
+    std::vector<float> sparseNormal(kFaceVertexCount * 3);
+
+    for (machine k = 0; k < 3; k++)
+    {
+        float sparseTime = MeasureBlend(meshStructure, kActiveCount[k], sparsePosition.data(), sparseNormal.data());
+
+        float maxError = 0.0F;
+        for (machine a = 0; a < kFaceVertexCount * 3; a++)
+        {
+            maxError = Fmax(maxError, Fabs(densePosition[k][a] - sparsePosition[a]), Fabs(denseNormal[k][a] - sparseNormal[a]));
+        }
+
+        printf("%8d  %12.3f  %12.3f  %12g\n", kActiveCount[k], denseTime[k], sparseTime, maxError);
+    }
+
+    return (0);
+}
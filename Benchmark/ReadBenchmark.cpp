@@ -0,0 +1,340 @@
+#include "OpenGEX.h"
+#include "OpenGEXGenerator.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace OpenGEX;
+
+namespace
+{
+    enum
+    {
+        kDefaultIterationCount = 5,
+        kDefaultFileCount = 16
+    };
+
+    typedef std::chrono::steady_clock::time_point TimePoint;
+
+    inline TimePoint GetTime(void)
+    {
+        return (std::chrono::steady_clock::now());
+    }
+
+    inline double GetSeconds(TimePoint startTime, TimePoint endTime)
+    {
+        return (std::chrono::duration<double>(endTime - startTime).count());
+    }
+
+    // Asks the kernel to drop the cached pages of each file so that the next read comes from the device. This only
+    // works for pages that aren't dirty, so generated files are flushed first, and it does nothing on Windows.
+
+    void EvictFiles(const std::vector<std::string>& fileArray)
+    {
+#if defined(POSIX_FADV_DONTNEED)
+
+        for (const std::string& name : fileArray)
+        {
+            int descriptor = open(name.c_str(), O_RDONLY);
+            if (descriptor >= 0)
+            {
+                fdatasync(descriptor);
+                posix_fadvise(descriptor, 0, 0, POSIX_FADV_DONTNEED);
+                close(descriptor);
+            }
+        }
+
+#else
+
+        (void) fileArray;
+
+#endif
+    }
+
+    // The same read as Example/main.cpp: the whole file is read with fread into a buffer with a zero terminator.
+
+    char* ReadFile(const char* name, uint64* size)
+    {
+        FILE* file = fopen(name, "rb");
+        if (!file)
+        {
+            return (nullptr);
+        }
+
+        fseek(file, 0, SEEK_END);
+        long length = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        char*  buffer = new char[length + 1];
+        size_t actual = fread(buffer, 1, length, file);
+        fclose(file);
+
+        buffer[actual] = 0;
+        *size = actual;
+        return (buffer);
+    }
+
+    bool LoadBuffer(const char* buffer)
+    {
+        OpenGexDataDescription description;
+        return (description.ProcessText(buffer) == kDataOkay);
+    }
+
+    // Each method returns the number of bytes read, or zero if any file failed.
+
+    uint64 ReadSerial(const std::vector<std::string>& fileArray, bool loadFlag)
+    {
+        uint64 totalSize = 0;
+        for (const std::string& name : fileArray)
+        {
+            uint64 size = 0;
+            char*  buffer = ReadFile(name.c_str(), &size);
+            if (!buffer)
+            {
+                return (0);
+            }
+
+            bool success = (!loadFlag) || (LoadBuffer(buffer));
+            delete[] buffer;
+
+            if (!success)
+            {
+                return (0);
+            }
+
+            totalSize += size;
+        }
+
+        return (totalSize);
+    }
+
+    // Every read is started before the first file is finished, so the reads of later files overlap the loading of earlier ones.
+
+    uint64 ReadAhead(FileReader* reader, const std::vector<std::string>& fileArray, bool loadFlag)
+    {
+        std::vector<FileRead*> readArray;
+        for (const std::string& name : fileArray)
+        {
+            readArray.push_back(reader->BeginRead(name.c_str()));
+        }
+
+        uint64 totalSize = 0;
+        bool   success = true;
+
+        for (FileRead* fileRead : readArray)
+        {
+            char*  buffer = nullptr;
+            uint64 size = 0;
+
+            if ((!fileRead) || (!reader->FinishRead(fileRead, &buffer, &size)))
+            {
+                success = false;
+                continue;
+            }
+
+            if ((success) && (loadFlag))
+            {
+                success = LoadBuffer(buffer);
+            }
+
+            delete[] buffer;
+            totalSize += size;
+        }
+
+        return ((success) ? totalSize : 0);
+    }
+
+    uint64 LoadBatch(ThreadPool* pool, FileReader* reader, const std::vector<std::string>& fileArray)
+    {
+        BatchLoader loader(pool, ~uint64(0));
+        loader.SetFileReader(reader);
+
+        for (const std::string& name : fileArray)
+        {
+            loader.AddFile(name.c_str());
+        }
+
+        loader.Load();
+
+        const BatchStatistics& statistics = loader.GetStatistics();
+        return ((statistics.failedCount == 0) ? statistics.totalSize : 0);
+    }
+
+    struct MethodResult
+    {
+        const char* name;
+        double      seconds;
+        uint64      size;
+    };
+
+    void MeasureMethod(const char* name, const std::vector<std::string>& fileArray, int32 iterationCount, bool coldFlag, const std::function<uint64()>& method)
+    {
+        MethodResult result = {name, 0.0, 0};
+
+        for (machine iteration = 0; iteration < iterationCount; iteration++)
+        {
+            if (coldFlag)
+            {
+                EvictFiles(fileArray);
+            }
+
+            TimePoint startTime = GetTime();
+            uint64    size = method();
+            double    seconds = GetSeconds(startTime, GetTime());
+
+            if (size == 0)
+            {
+                fprintf(stderr, "%s failed\n", name);
+                return;
+            }
+
+            result.size = size;
+            result.seconds = ((iteration == 0) || (seconds < result.seconds)) ? seconds : result.seconds;
+        }
+
+        printf("    %-24s %12.3f %12.1f\n", result.name, result.seconds * 1000.0, double(result.size) / 1048576.0 / result.seconds);
+    }
+
+    bool GenerateFiles(const std::filesystem::path& directory, int32 fileCount, int32 scale, std::vector<std::string>* fileArray)
+    {
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+
+        std::string text;
+        for (machine a = 0; a < fileCount; a++)
+        {
+            GeneratorParams params;
+            InitGeneratorParams(&params);
+            params.nodeCount = 64 * scale;
+            params.hierarchyDepth = 4;
+            params.meshCount = 16 * scale;
+            params.vertexCount = 4096;
+            params.seed = uint32(a + 1);
+
+            text.clear();
+            GenerateScene(params, &text);
+
+            char name[32];
+            snprintf(name, sizeof(name), "read%03d.ogex", int(a));
+            std::string fileName = (directory / name).string();
+
+            FILE* file = fopen(fileName.c_str(), "wb");
+            if (!file)
+            {
+                return (false);
+            }
+
+            fwrite(text.data(), 1, text.size(), file);
+            fclose(file);
+
+            fileArray->push_back(fileName);
+        }
+
+        return (true);
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    int32                    iterationCount = kDefaultIterationCount;
+    int32                    fileCount = kDefaultFileCount;
+    int32                    scale = 1;
+    bool                     coldFlag = false;
+    std::vector<std::string> fileArray;
+
+    for (int a = 1; a < argc; a++)
+    {
+        const char* arg = argv[a];
+        if ((strcmp(arg, "--iterations") == 0) && (a + 1 < argc))
+        {
+            iterationCount = Max(atoi(argv[++a]), 1);
+        }
+        else if ((strcmp(arg, "--files") == 0) && (a + 1 < argc))
+        {
+            fileCount = Max(atoi(argv[++a]), 1);
+        }
+        else if ((strcmp(arg, "--scale") == 0) && (a + 1 < argc))
+        {
+            scale = Max(atoi(argv[++a]), 1);
+        }
+        else if (strcmp(arg, "--cold") == 0)
+        {
+            coldFlag = true;
+        }
+        else if (arg[0] != '-')
+        {
+            fileArray.push_back(arg);
+        }
+        else
+        {
+            fprintf(stderr, "Usage: ReadBenchmark [--iterations n] [--files n] [--scale n] [--cold] [file.ogex ...]\n");
+            return (1);
+        }
+    }
+
+    // Without files on the command line, generated scenes are written to a temporary directory and removed at the end.
+
+    std::filesystem::path directory;
+    if (fileArray.empty())
+    {
+        directory = std::filesystem::temp_directory_path() / "OpenGEXReadBenchmark";
+        if (!GenerateFiles(directory, fileCount, scale, &fileArray))
+        {
+            fprintf(stderr, "Unable to write %s\n", directory.string().c_str());
+            return (1);
+        }
+    }
+
+    ThreadPool pool;
+    FileReader poolReader(kFileReadDefaultThreadCount, kFileReadDefaultChunkSize, kFileReadDefaultQueueDepth, false);
+    FileReader uringReader;
+
+    bool uringFlag = (uringReader.GetBackend() == kFileReaderUring);
+
+    printf("%d files, %d iterations, %s cache%s\n", int(fileArray.size()), iterationCount, (coldFlag) ? "cold" : "warm", (uringFlag) ? "" : ", io_uring unavailable");
+    printf("\n    %-24s %12s %12s\n", "method", "ms", "MB/s");
+
+    MeasureMethod("fread", fileArray, iterationCount, coldFlag, [&] { return (ReadSerial(fileArray, false)); });
+    MeasureMethod("pread pool", fileArray, iterationCount, coldFlag, [&] { return (ReadAhead(&poolReader, fileArray, false)); });
+    if (uringFlag)
+    {
+        MeasureMethod("io_uring", fileArray, iterationCount, coldFlag, [&] { return (ReadAhead(&uringReader, fileArray, false)); });
+    }
+
+    printf("\n");
+
+    MeasureMethod("fread + load", fileArray, iterationCount, coldFlag, [&] { return (ReadSerial(fileArray, true)); });
+    MeasureMethod("pread pool + load", fileArray, iterationCount, coldFlag, [&] { return (ReadAhead(&poolReader, fileArray, true)); });
+    if (uringFlag)
+    {
+        MeasureMethod("io_uring + load", fileArray, iterationCount, coldFlag, [&] { return (ReadAhead(&uringReader, fileArray, true)); });
+    }
+
+    printf("\n");
+
+    MeasureMethod("batch fread", fileArray, iterationCount, coldFlag, [&] { return (LoadBatch(&pool, nullptr, fileArray)); });
+    MeasureMethod("batch pread pool", fileArray, iterationCount, coldFlag, [&] { return (LoadBatch(&pool, &poolReader, fileArray)); });
+    if (uringFlag)
+    {
+        MeasureMethod("batch io_uring", fileArray, iterationCount, coldFlag, [&] { return (LoadBatch(&pool, &uringReader, fileArray)); });
+    }
+
+    if (!directory.empty())
+    {
+        std::error_code error;
+        std::filesystem::remove_all(directory, error);
+    }
+
+    return (0);
+}
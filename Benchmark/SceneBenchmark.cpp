@@ -0,0 +1,857 @@
+#include "OpenGEX.h"
+#include "OpenGEXGenerator.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <set>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+using namespace OpenGEX;
+
+namespace
+{
+    std::atomic<uint64> allocationCount(0);
+    std::atomic<uint64> allocationSize(0);
+    std::atomic<uint64> freeCount(0);
+} // namespace
+
+// Every allocation made through new and delete is counted, including those made by OpenDDL and the standard library.
+
+void* operator new(std::size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocationSize.fetch_add(size, std::memory_order_relaxed);
+
+    void* pointer = malloc((size != 0) ? size : 1);
+    if (!pointer)
+    {
+        throw std::bad_alloc();
+    }
+
+    return (pointer);
+}
+
+void* operator new[](std::size_t size)
+{
+    return (operator new(size));
+}
+
+void operator delete(void* pointer) noexcept
+{
+    if (pointer)
+    {
+        freeCount.fetch_add(1, std::memory_order_relaxed);
+        free(pointer);
+    }
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    operator delete(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    operator delete(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+    operator delete(pointer);
+}
+
+// Over-aligned types go through the aligned forms, which need the matching aligned allocator and free function.
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocationSize.fetch_add(size, std::memory_order_relaxed);
+
+    std::size_t align = std::size_t(alignment);
+    std::size_t alignedSize = (((size != 0) ? size : 1) + align - 1) & ~(align - 1);
+
+#ifdef _WIN32
+    void* pointer = _aligned_malloc(alignedSize, align);
+#else
+    void* pointer = aligned_alloc(align, alignedSize);
+#endif
+
+    if (!pointer)
+    {
+        throw std::bad_alloc();
+    }
+
+    return (pointer);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return (operator new(size, alignment));
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept
+{
+    if (pointer)
+    {
+        freeCount.fetch_add(1, std::memory_order_relaxed);
+
+#ifdef _WIN32
+        _aligned_free(pointer);
+#else
+        free(pointer);
+#endif
+    }
+}
+
+void operator delete[](void* pointer, std::align_val_t alignment) noexcept
+{
+    operator delete(pointer, alignment);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t alignment) noexcept
+{
+    operator delete(pointer, alignment);
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t alignment) noexcept
+{
+    operator delete(pointer, alignment);
+}
+
+namespace
+{
+    enum
+    {
+        kDefaultIterationCount = 5,
+        kTransformIterationCount = 10,
+        kAnimationFrameCount = 120
+    };
+
+    typedef std::chrono::steady_clock::time_point TimePoint;
+
+    inline TimePoint GetTime(void)
+    {
+        return (std::chrono::steady_clock::now());
+    }
+
+    inline double GetSeconds(TimePoint startTime, TimePoint endTime)
+    {
+        return (std::chrono::duration<double>(endTime - startTime).count());
+    }
+
+    struct AllocationCounter
+    {
+        uint64 count;
+        uint64 size;
+        uint64 frees;
+
+        static AllocationCounter Read(void)
+        {
+            return {allocationCount.load(std::memory_order_relaxed), allocationSize.load(std::memory_order_relaxed), freeCount.load(std::memory_order_relaxed)};
+        }
+
+        AllocationCounter operator-(const AllocationCounter& counter) const
+        {
+            return {count - counter.count, size - counter.size, frees - counter.frees};
+        }
+
+        AllocationCounter operator+(const AllocationCounter& counter) const
+        {
+            return {count + counter.count, size + counter.size, frees + counter.frees};
+        }
+    };
+
+    // Returns the largest resident set size of the process so far, in bytes. The operating system only keeps the peak
+    // over the lifetime of the process, so it can't be attributed to a phase or to a scene loaded after a larger one.
+
+    uint64 GetPeakResidentSize(void)
+    {
+#if defined(_WIN32)
+
+        PROCESS_MEMORY_COUNTERS counters;
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        {
+            return (uint64(counters.PeakWorkingSetSize));
+        }
+
+        return (0);
+
+#else
+
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+
+#if defined(__APPLE__)
+        return (uint64(usage.ru_maxrss));
+#else
+        return (uint64(usage.ru_maxrss) * 1024);
+#endif
+
+#endif
+    }
+
+    // A phase keeps its fastest time over all iterations. The amount of work is measured in the units that
+    // its throughput is reported in, and the allocation counts come from the last iteration.
+
+    struct PhaseResult
+    {
+        std::string       name;
+        const char*       unit;
+        double            workAmount;
+        double            seconds;
+        AllocationCounter allocations;
+    };
+
+    struct StructureTiming
+    {
+        const char*       identifier;
+        int32             count;
+        double            seconds;
+        AllocationCounter allocations;
+    };
+
+    // ProcessData for a structure includes the processing of its subnodes, so the time and allocations spent in
+    // subnodes are accumulated separately and subtracted to leave the exclusive cost of each structure.
+
+    struct ChildTotal
+    {
+        double            seconds;
+        AllocationCounter allocations;
+    };
+
+    ChildTotal childTotal;
+
+    template <class type>
+    class TimedStructure : public type
+    {
+    private:
+        StructureTiming* structureTiming;
+
+    public:
+        TimedStructure(StructureTiming* timing)
+        {
+            structureTiming = timing;
+        }
+
+        DataResult ProcessData(DataDescription* dataDescription) override
+        {
+            ChildTotal parentTotal = childTotal;
+            childTotal = ChildTotal{};
+
+            AllocationCounter startAllocations = AllocationCounter::Read();
+            TimePoint         startTime = GetTime();
+
+            DataResult result = type::ProcessData(dataDescription);
+
+            double            seconds = GetSeconds(startTime, GetTime());
+            AllocationCounter allocations = AllocationCounter::Read() - startAllocations;
+
+            structureTiming->count++;
+            structureTiming->seconds += seconds - childTotal.seconds;
+            structureTiming->allocations = structureTiming->allocations + (allocations - childTotal.allocations);
+
+            childTotal.seconds = parentTotal.seconds + seconds;
+            childTotal.allocations = parentTotal.allocations + allocations;
+            return (result);
+        }
+    };
+
+    template <class type>
+    Structure* CreateTimedStructure(StructureTiming* timing)
+    {
+        return (new TimedStructure<type>(timing));
+    }
+
+    struct StructureFactory
+    {
+        const char* identifier;
+        Structure* (*create)(StructureTiming*);
+    };
+
+    // Transform, Translation, Rotation, and Scale are final classes, so their time is included in the node containing them.
+
+    const StructureFactory structureFactory[] = {
+        {"Metric", &CreateTimedStructure<MetricStructure>},
+        {"Name", &CreateTimedStructure<NameStructure>},
+        {"ObjectRef", &CreateTimedStructure<ObjectRefStructure>},
+        {"MaterialRef", &CreateTimedStructure<MaterialRefStructure>},
+        {"MorphWeight", &CreateTimedStructure<MorphWeightStructure>},
+        {"Node", &CreateTimedStructure<NodeStructure>},
+        {"BoneNode", &CreateTimedStructure<BoneNodeStructure>},
+        {"GeometryNode", &CreateTimedStructure<GeometryNodeStructure>},
+        {"LightNode", &CreateTimedStructure<LightNodeStructure>},
+        {"CameraNode", &CreateTimedStructure<CameraNodeStructure>},
+        {"VertexArray", &CreateTimedStructure<VertexArrayStructure>},
+        {"IndexArray", &CreateTimedStructure<IndexArrayStructure>},
+        {"BoneRefArray", &CreateTimedStructure<BoneRefArrayStructure>},
+        {"BoneCountArray", &CreateTimedStructure<BoneCountArrayStructure>},
+        {"BoneIndexArray", &CreateTimedStructure<BoneIndexArrayStructure>},
+        {"BoneWeightArray", &CreateTimedStructure<BoneWeightArrayStructure>},
+        {"Skeleton", &CreateTimedStructure<SkeletonStructure>},
+        {"Skin", &CreateTimedStructure<SkinStructure>},
+        {"Morph", &CreateTimedStructure<MorphStructure>},
+        {"Mesh", &CreateTimedStructure<MeshStructure>},
+        {"GeometryObject", &CreateTimedStructure<GeometryObjectStructure>},
+        {"LightObject", &CreateTimedStructure<LightObjectStructure>},
+        {"CameraObject", &CreateTimedStructure<CameraObjectStructure>},
+        {"Param", &CreateTimedStructure<ParamStructure>},
+        {"Color", &CreateTimedStructure<ColorStructure>},
+        {"Spectrum", &CreateTimedStructure<SpectrumStructure>},
+        {"Texture", &CreateTimedStructure<TextureStructure>},
+        {"Atten", &CreateTimedStructure<AttenStructure>},
+        {"Material", &CreateTimedStructure<MaterialStructure>},
+        {"Key", &CreateTimedStructure<KeyStructure>},
+        {"Time", &CreateTimedStructure<TimeStructure>},
+        {"Value", &CreateTimedStructure<ValueStructure>},
+        {"Track", &CreateTimedStructure<TrackStructure>},
+        {"Animation", &CreateTimedStructure<AnimationStructure>},
+        {"Clip", &CreateTimedStructure<ClipStructure>}};
+
+    enum
+    {
+        kStructureFactoryCount = sizeof(structureFactory) / sizeof(StructureFactory)
+    };
+
+    // A data description that measures the whole ProcessData step, which follows parsing inside ProcessText.
+    // When a timing array is given, structures are created with wrappers that measure each ProcessData call.
+
+    class BenchmarkDescription : public OpenGexDataDescription
+    {
+    private:
+        StructureTiming* timingArray;
+
+    protected:
+        DataResult ProcessData(void) override;
+
+    public:
+        double            processSeconds;
+        double            structureSeconds;
+        AllocationCounter processAllocations;
+
+        BenchmarkDescription(StructureTiming* timing)
+        {
+            timingArray = timing;
+            processSeconds = 0.0;
+            structureSeconds = 0.0;
+            processAllocations = AllocationCounter{};
+        }
+
+        Structure* CreateStructure(std::string_view identifier) const override;
+    };
+
+    DataResult BenchmarkDescription::ProcessData(void)
+    {
+        childTotal = ChildTotal{};
+
+        AllocationCounter startAllocations = AllocationCounter::Read();
+        TimePoint         startTime = GetTime();
+
+        DataResult result = OpenGexDataDescription::ProcessData();
+
+        processSeconds = GetSeconds(startTime, GetTime());
+        processAllocations = AllocationCounter::Read() - startAllocations;
+
+        // After processing, the child total holds the inclusive time of all top-level structures.
+
+        structureSeconds = childTotal.seconds;
+        return (result);
+    }
+
+    Structure* BenchmarkDescription::CreateStructure(std::string_view identifier) const
+    {
+        if (timingArray)
+        {
+            for (machine k = 0; k < kStructureFactoryCount; k++)
+            {
+                if (identifier == structureFactory[k].identifier)
+                {
+                    return ((*structureFactory[k].create)(&timingArray[k]));
+                }
+            }
+        }
+
+        return (OpenGexDataDescription::CreateStructure(identifier));
+    }
+
+    struct SceneInfo
+    {
+        int32           structureCount;
+        int32           nodeCount;
+        int32           vertexCount;
+        std::set<int32> clipSet;
+    };
+
+    void GetSceneInfo(const OpenGexDataDescription* description, SceneInfo* info)
+    {
+        info->structureCount = 0;
+        info->nodeCount = 0;
+        info->vertexCount = 0;
+        info->clipSet.clear();
+
+        const Structure* root = description->GetRootStructure();
+        const Structure* structure = root->GetFirstSubnode();
+        while (structure)
+        {
+            info->structureCount++;
+
+            StructureType type = structure->GetStructureType();
+            if (structure->GetBaseStructureType() == kStructureNode)
+            {
+                info->nodeCount++;
+            }
+            else if (type == kStructureVertexArray)
+            {
+                const VertexArrayStructure* vertexArray = static_cast<const VertexArrayStructure*>(structure);
+                if ((vertexArray->GetAttribString() == "position") && (vertexArray->GetMorphIndex() == 0))
+                {
+                    info->vertexCount += vertexArray->GetVertexCount();
+                }
+            }
+            else if (type == kStructureAnimation)
+            {
+                info->clipSet.insert(int32(static_cast<const AnimationStructure*>(structure)->GetClipIndex()));
+            }
+
+            structure = structure->GetNextNode(root);
+        }
+    }
+
+    int32 CountClipTracks(const OpenGexDataDescription* description, int32 clip)
+    {
+        int32            trackCount = 0;
+        const Structure* root = description->GetRootStructure();
+        const Structure* structure = root->GetFirstSubnode();
+        while (structure)
+        {
+            if ((structure->GetStructureType() == kStructureTrack) && (int32(static_cast<const AnimationStructure*>(structure->GetSuperNode())->GetClipIndex()) == clip))
+            {
+                trackCount++;
+            }
+
+            structure = structure->GetNextNode(root);
+        }
+
+        return (trackCount);
+    }
+
+    void RecordPhase(std::vector<PhaseResult>& phaseArray, machine index, const char* name, const char* unit, double workAmount, double seconds, const AllocationCounter& allocations)
+    {
+        if (index == machine(phaseArray.size()))
+        {
+            phaseArray.push_back(PhaseResult{name, unit, workAmount, seconds, allocations});
+        }
+
+        PhaseResult& phase = phaseArray[index];
+        phase.seconds = (seconds < phase.seconds) ? seconds : phase.seconds;
+        phase.allocations = allocations;
+    }
+
+    struct SceneResult
+    {
+        std::string                  name;
+        uint64                       textSize;
+        SceneInfo                    info;
+        DataResult                   result;
+        std::vector<PhaseResult>     phaseArray;
+        std::vector<StructureTiming> structureArray;
+        double                       postProcessSeconds;
+        MemoryUsage                  memoryUsage;
+        uint64                       processPeakResidentSize;
+    };
+
+    // Loads the text the given number of times, timing each phase separately, and then loads it once more with
+    // every structure wrapped to measure the exclusive cost of ProcessData for each structure type.
+
+    void MeasureScene(const char* name, const std::string& text, int32 iterationCount, SceneResult* sceneResult)
+    {
+        sceneResult->name = name;
+        sceneResult->textSize = text.size();
+        sceneResult->result = kDataOkay;
+        sceneResult->phaseArray.clear();
+        sceneResult->structureArray.clear();
+        sceneResult->postProcessSeconds = 0.0;
+        sceneResult->memoryUsage = MemoryUsage{};
+        sceneResult->processPeakResidentSize = 0;
+
+        double megabytes = double(text.size()) / 1048576.0;
+
+        for (machine iteration = 0; iteration < iterationCount; iteration++)
+        {
+            BenchmarkDescription* description = new BenchmarkDescription(nullptr);
+
+            AllocationCounter startAllocations = AllocationCounter::Read();
+            TimePoint         startTime = GetTime();
+
+            DataResult result = description->ProcessText(text.c_str());
+
+            double            loadSeconds = GetSeconds(startTime, GetTime());
+            AllocationCounter loadAllocations = AllocationCounter::Read() - startAllocations;
+
+            if (result != kDataOkay)
+            {
+                sceneResult->result = result;
+                delete description;
+                return;
+            }
+
+            SceneInfo& info = sceneResult->info;
+            GetSceneInfo(description, &info);
+
+            machine phase = 0;
+            RecordPhase(sceneResult->phaseArray, phase++, "parse", "MB/s", megabytes, loadSeconds - description->processSeconds, loadAllocations - description->processAllocations);
+            RecordPhase(sceneResult->phaseArray, phase++, "process", "vertices/s", double(info.vertexCount), description->processSeconds, description->processAllocations);
+
+            // Node transforms are calculated during processing, and they are calculated again here so they can be timed alone.
+
+            startAllocations = AllocationCounter::Read();
+            startTime = GetTime();
+
+            for (machine k = 0; k < kTransformIterationCount; k++)
+            {
+                Structure* structure = description->GetRootStructure()->GetFirstSubnode();
+                while (structure)
+                {
+                    if (structure->GetBaseStructureType() == kStructureNode)
+                    {
+                        static_cast<NodeStructure*>(structure)->UpdateNodeTransforms(description);
+                    }
+
+                    structure = structure->GetNextSubnode();
+                }
+            }
+
+            RecordPhase(sceneResult->phaseArray, phase++, "transforms", "nodes/s", double(info.nodeCount) * double(kTransformIterationCount), GetSeconds(startTime, GetTime()), AllocationCounter::Read() - startAllocations);
+
+            for (int32 clip : info.clipSet)
+            {
+                Range<float> range = description->GetAnimationTimeRange(clip);
+                int32        trackCount = CountClipTracks(description, clip);
+
+                startAllocations = AllocationCounter::Read();
+                startTime = GetTime();
+
+                for (machine frame = 0; frame < kAnimationFrameCount; frame++)
+                {
+                    float t = float(frame) / float(kAnimationFrameCount - 1);
+                    description->UpdateAnimation(clip, range.min + (range.max - range.min) * t);
+                }
+
+                char phaseName[32];
+                snprintf(phaseName, sizeof(phaseName), "animate clip %d", clip);
+                RecordPhase(sceneResult->phaseArray, phase++, phaseName, "tracks/s", double(trackCount) * double(kAnimationFrameCount), GetSeconds(startTime, GetTime()), AllocationCounter::Read() - startAllocations);
+            }
+
+            startAllocations = AllocationCounter::Read();
+            startTime = GetTime();
+
+            delete description;
+
+            RecordPhase(sceneResult->phaseArray, phase++, "teardown", "structures/s", double(info.structureCount), GetSeconds(startTime, GetTime()), AllocationCounter::Read() - startAllocations);
+        }
+
+        StructureTiming timingArray[kStructureFactoryCount];
+        for (machine k = 0; k < kStructureFactoryCount; k++)
+        {
+            timingArray[k] = StructureTiming{structureFactory[k].identifier, 0, 0.0, AllocationCounter{}};
+        }
+
+        BenchmarkDescription* description = new BenchmarkDescription(timingArray);
+        if (description->ProcessText(text.c_str()) == kDataOkay)
+        {
+            for (machine k = 0; k < kStructureFactoryCount; k++)
+            {
+                if (timingArray[k].count != 0)
+                {
+                    sceneResult->structureArray.push_back(timingArray[k]);
+                }
+            }
+
+            // Whatever isn't spent in structures is spent converting meshes, building skeletons, and calculating bounds.
+
+            sceneResult->postProcessSeconds = description->processSeconds - description->structureSeconds;
+
+            MemoryReport memoryReport;
+            description->GetMemoryReport(&memoryReport);
+            sceneResult->memoryUsage = memoryReport.totalUsage;
+        }
+
+        delete description;
+
+        sceneResult->processPeakResidentSize = GetPeakResidentSize();
+    }
+
+    void PrintScene(const SceneResult& sceneResult)
+    {
+        printf("\n%s: %.2f MB, %d structures, %d nodes, %d vertices\n", sceneResult.name.c_str(), double(sceneResult.textSize) / 1048576.0, sceneResult.info.structureCount,
+               sceneResult.info.nodeCount, sceneResult.info.vertexCount);
+        if (sceneResult.result != kDataOkay)
+        {
+            printf("    Load failed: %s\n", OpenGEX::DataResultToString(sceneResult.result).c_str());
+            return;
+        }
+
+        printf("    %-16s %12s %16s %14s %14s\n", "phase", "ms", "throughput", "allocations", "alloc bytes");
+        for (const PhaseResult& phase : sceneResult.phaseArray)
+        {
+            char throughput[32];
+            snprintf(throughput, sizeof(throughput), "%.4g %s", (phase.seconds > 0.0) ? phase.workAmount / phase.seconds : 0.0, phase.unit);
+            printf("    %-16s %12.3f %16s %14llu %14llu\n", phase.name.c_str(), phase.seconds * 1000.0, throughput, (unsigned long long) phase.allocations.count,
+                   (unsigned long long) phase.allocations.size);
+        }
+
+        printf("\n    %-16s %12s %12s %14s\n", "structure", "count", "ms", "allocations");
+        for (const StructureTiming& timing : sceneResult.structureArray)
+        {
+            printf("    %-16s %12d %12.3f %14llu\n", timing.identifier, timing.count, timing.seconds * 1000.0, (unsigned long long) timing.allocations.count);
+        }
+
+        printf("    %-16s %12s %12.3f\n", "(post-process)", "", sceneResult.postProcessSeconds * 1000.0);
+
+        const MemoryUsage& usage = sceneResult.memoryUsage;
+        printf("\n    Array data: %.2f MB parsed, %.2f MB processed, %.2f MB redundant, %.2f MB duplicated\n", double(usage.parserSize) / 1048576.0, double(usage.processedSize) / 1048576.0,
+               double(usage.redundantSize) / 1048576.0, double(usage.duplicateSize) / 1048576.0);
+        printf("    Process peak RSS so far: %.1f MB\n", double(sceneResult.processPeakResidentSize) / 1048576.0);
+    }
+
+    // Scene names come from the command line, so quotes and backslashes are escaped and control characters are dropped
+    // before names are written into JSON strings.
+
+    std::string EscapeJsonString(std::string_view string)
+    {
+        std::string output;
+        for (char c : string)
+        {
+            if ((c == '"') || (c == '\\'))
+            {
+                output.push_back('\\');
+            }
+
+            if (uint8(c) >= 0x20)
+            {
+                output.push_back(c);
+            }
+        }
+
+        return (output);
+    }
+
+    void WriteJson(FILE* file, const std::vector<SceneResult>& sceneArray, int32 iterationCount)
+    {
+        fprintf(file, "{\n\t\"benchmark\": \"OpenGEX_bench\",\n\t\"iterations\": %d,\n\t\"scenes\": [", iterationCount);
+
+        for (size_t s = 0; s < sceneArray.size(); s++)
+        {
+            const SceneResult& sceneResult = sceneArray[s];
+            fprintf(file, "%s\n\t\t{\n\t\t\t\"name\": \"%s\",\n\t\t\t\"ok\": %s,\n", (s != 0) ? "," : "", EscapeJsonString(sceneResult.name).c_str(), (sceneResult.result == kDataOkay) ? "true" : "false");
+            fprintf(file, "\t\t\t\"textBytes\": %llu,\n\t\t\t\"structures\": %d,\n\t\t\t\"nodes\": %d,\n\t\t\t\"vertices\": %d,\n", (unsigned long long) sceneResult.textSize,
+                    sceneResult.info.structureCount, sceneResult.info.nodeCount, sceneResult.info.vertexCount);
+
+            fprintf(file, "\t\t\t\"phases\": [");
+            for (size_t p = 0; p < sceneResult.phaseArray.size(); p++)
+            {
+                const PhaseResult& phase = sceneResult.phaseArray[p];
+                fprintf(file, "%s\n\t\t\t\t{\"name\": \"%s\", \"seconds\": %.9g, \"throughput\": %.9g, \"unit\": \"%s\", \"allocations\": %llu, \"allocatedBytes\": %llu, \"frees\": %llu}",
+                        (p != 0) ? "," : "", EscapeJsonString(phase.name).c_str(), phase.seconds, (phase.seconds > 0.0) ? phase.workAmount / phase.seconds : 0.0, phase.unit,
+                        (unsigned long long) phase.allocations.count, (unsigned long long) phase.allocations.size, (unsigned long long) phase.allocations.frees);
+            }
+
+            fprintf(file, "\n\t\t\t],\n\t\t\t\"structureProcessing\": [");
+            for (size_t k = 0; k < sceneResult.structureArray.size(); k++)
+            {
+                const StructureTiming& timing = sceneResult.structureArray[k];
+                fprintf(file, "%s\n\t\t\t\t{\"type\": \"%s\", \"count\": %d, \"seconds\": %.9g, \"allocations\": %llu, \"allocatedBytes\": %llu}", (k != 0) ? "," : "", timing.identifier,
+                        timing.count, timing.seconds, (unsigned long long) timing.allocations.count, (unsigned long long) timing.allocations.size);
+            }
+
+            const MemoryUsage& usage = sceneResult.memoryUsage;
+            fprintf(file, "\n\t\t\t],\n\t\t\t\"postProcessSeconds\": %.9g,\n\t\t\t\"processPeakRSS\": %llu,\n", sceneResult.postProcessSeconds,
+                    (unsigned long long) sceneResult.processPeakResidentSize);
+            fprintf(file, "\t\t\t\"memory\": {\"parserBytes\": %llu, \"processedBytes\": %llu, \"redundantBytes\": %llu, \"duplicateBytes\": %llu}\n\t\t}", (unsigned long long) usage.parserSize,
+                    (unsigned long long) usage.processedSize, (unsigned long long) usage.redundantSize, (unsigned long long) usage.duplicateSize);
+        }
+
+        fprintf(file, "\n\t]\n}\n");
+    }
+
+    bool ReadFile(const char* name, std::string* text)
+    {
+        FILE* file = fopen(name, "rb");
+        if (!file)
+        {
+            return (false);
+        }
+
+        fseek(file, 0, SEEK_END);
+        long size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        text->resize(size);
+        size_t actual = fread(text->data(), 1, size, file);
+        fclose(file);
+
+        text->resize(actual);
+        return (true);
+    }
+
+    // The synthetic scenes each stress a different part of the importer. The scale multiplies the number of nodes and objects.
+
+    void InitStaticScene(GeneratorParams* params, int32 scale)
+    {
+        InitGeneratorParams(params);
+        params->nodeCount = 256 * scale;
+        params->hierarchyDepth = 4;
+        params->meshCount = 64 * scale;
+        params->vertexCount = 4096;
+        params->lodCount = 1;
+    }
+
+    void InitSkinnedScene(GeneratorParams* params, int32 scale)
+    {
+        InitGeneratorParams(params);
+        params->nodeCount = 64 * scale;
+        params->meshCount = 16 * scale;
+        params->vertexCount = 4096;
+        params->morphTargetCount = 8;
+        params->boneCount = 64;
+        params->influenceCount = 4;
+    }
+
+    void InitAnimatedScene(GeneratorParams* params, int32 scale)
+    {
+        InitGeneratorParams(params);
+        params->nodeCount = 512 * scale;
+        params->hierarchyDepth = 8;
+        params->meshCount = 8;
+        params->vertexCount = 256;
+        params->clipCount = 2;
+        params->animatedNodeCount = params->nodeCount;
+        params->trackCount = 3;
+        params->keyCount = 120;
+        params->curveType = kGeneratorCurveBezier;
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    int32                    iterationCount = kDefaultIterationCount;
+    int32                    scale = 1;
+    bool                     hexFloatFlag = false;
+    const char*              jsonName = nullptr;
+    const char*              traceName = nullptr;
+    std::vector<const char*> fileArray;
+
+    for (int a = 1; a < argc; a++)
+    {
+        const char* arg = argv[a];
+        if ((strcmp(arg, "--iterations") == 0) && (a + 1 < argc))
+        {
+            iterationCount = Max(atoi(argv[++a]), 1);
+        }
+        else if ((strcmp(arg, "--scale") == 0) && (a + 1 < argc))
+        {
+            scale = Max(atoi(argv[++a]), 1);
+        }
+        else if ((strcmp(arg, "--json") == 0) && (a + 1 < argc))
+        {
+            jsonName = argv[++a];
+        }
+        else if ((strcmp(arg, "--trace") == 0) && (a + 1 < argc))
+        {
+            traceName = argv[++a];
+        }
+        else if (strcmp(arg, "--hex") == 0)
+        {
+            hexFloatFlag = true;
+        }
+        else if (arg[0] != '-')
+        {
+            fileArray.push_back(arg);
+        }
+        else
+        {
+            fprintf(stderr, "Usage: OpenGEX_bench [--iterations n] [--scale n] [--hex] [--json output.json] [--trace trace.json] [file.ogex ...]\n");
+            return (1);
+        }
+    }
+
+    std::vector<SceneResult> sceneArray;
+    std::string              text;
+
+    // Profiling zones are only recorded when the library is built with ENABLE_PROFILING, and they add to the measured times.
+
+    if (traceName)
+    {
+        BeginProfileCapture();
+    }
+
+    if (fileArray.empty())
+    {
+        static const char* const sceneName[3] = {"static", "skinned", "animated"};
+        static void (*const initScene[3])(GeneratorParams*, int32) = {&InitStaticScene, &InitSkinnedScene, &InitAnimatedScene};
+
+        for (machine k = 0; k < 3; k++)
+        {
+            GeneratorParams params;
+            (*initScene[k])(&params, scale);
+            params.hexFloatFlag = hexFloatFlag;
+
+            text.clear();
+            GenerateScene(params, &text);
+
+            sceneArray.emplace_back();
+            MeasureScene(sceneName[k], text, iterationCount, &sceneArray.back());
+            PrintScene(sceneArray.back());
+        }
+    }
+    else
+    {
+        for (const char* name : fileArray)
+        {
+            if (!ReadFile(name, &text))
+            {
+                fprintf(stderr, "Unable to read %s\n", name);
+                return (1);
+            }
+
+            sceneArray.emplace_back();
+            MeasureScene(name, text, iterationCount, &sceneArray.back());
+            PrintScene(sceneArray.back());
+        }
+    }
+
+    if (traceName)
+    {
+        EndProfileCapture();
+        if (!WriteProfileTrace(traceName))
+        {
+            fprintf(stderr, "Unable to open %s\n", traceName);
+            return (1);
+        }
+    }
+
+    if (jsonName)
+    {
+        FILE* file = fopen(jsonName, "w");
+        if (!file)
+        {
+            fprintf(stderr, "Unable to open %s\n", jsonName);
+            return (1);
+        }
+
+        WriteJson(file, sceneArray, iterationCount);
+        fclose(file);
+    }
+
+    return (0);
+}
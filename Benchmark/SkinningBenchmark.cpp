@@ -0,0 +1,216 @@
+#include "OpenGEXSkinning.h"
+
+#include <chrono>
+#include <cstdio>
+
+using namespace OpenGEX;
+
+namespace
+{
+    enum
+    {
+        kCylinderRingCount = 64,
+        kCylinderSegmentCount = 32,
+        kThroughputVertexCount = 200000,
+        kThroughputBoneCount = 64,
+        kThroughputInfluenceCount = 4,
+        kThroughputIterationCount = 20
+    };
+
+    // A unit-radius cylinder along the z axis from 0 to 2, bound to one bone at each end with weights that fade
+    // linearly across the middle half. The accuracy test twists the upper bone and measures how far the vertices
+    // move away from the unit radius, which is where linear blend skinning collapses into a candy wrapper.
+
+    struct Cylinder
+    {
+        int32   vertexCount;
+        float*  positionArray;
+        uint16* boneCountArray;
+        uint16* boneIndexArray;
+        float*  boneWeightArray;
+
+        Cylinder();
+        ~Cylinder();
+    };
+
+    Cylinder::Cylinder()
+    {
+        vertexCount = kCylinderRingCount * kCylinderSegmentCount;
+        positionArray = new float[vertexCount * 3];
+        boneCountArray = new uint16[vertexCount];
+        boneIndexArray = new uint16[vertexCount * 2];
+        boneWeightArray = new float[vertexCount * 2];
+
+        for (machine i = 0; i < kCylinderRingCount; i++)
+        {
+            float z = float(i) * 2.0F / float(kCylinderRingCount - 1);
+            float w = Clamp(z - 0.5F, 0.0F, 1.0F);
+
+            for (machine j = 0; j < kCylinderSegmentCount; j++)
+            {
+                machine a = i * kCylinderSegmentCount + j;
+                CosSin(float(j) * Math::tau / float(kCylinderSegmentCount), &positionArray[a * 3], &positionArray[a * 3 + 1]);
+                positionArray[a * 3 + 2] = z;
+
+                boneCountArray[a] = 2;
+                boneIndexArray[a * 2] = 0;
+                boneIndexArray[a * 2 + 1] = 1;
+                boneWeightArray[a * 2] = 1.0F - w;
+                boneWeightArray[a * 2 + 1] = w;
+            }
+        }
+    }
+
+    Cylinder::~Cylinder()
+    {
+        delete[] boneWeightArray;
+        delete[] boneIndexArray;
+        delete[] boneCountArray;
+        delete[] positionArray;
+    }
+
+    // Returns the smallest and mean radius of the skinned vertices, which are both 1 for a volume-preserving twist.
+
+    void MeasureTwist(const Cylinder& cylinder, float angle, int32 method, float* minRadius, float* meanRadius)
+    {
+        Transform3D paletteArray[2];
+        paletteArray[0].SetIdentity();
+        paletteArray[1].Set(Matrix3D::MakeRotationZ(angle), Vector3D(0.0F, 0.0F, 0.0F));
+
+        float*         outputArray = new float[cylinder.vertexCount * 3];
+        SkinningStream positionStream = {cylinder.positionArray, 3, outputArray};
+        SkinningStream emptyStream = {nullptr, 0, nullptr};
+
+        if (method == kSkinningDualQuaternion)
+        {
+            SkinVerticesDualQuaternion(paletteArray, 2, cylinder.boneCountArray, cylinder.boneIndexArray, cylinder.boneWeightArray, cylinder.vertexCount, positionStream, emptyStream, emptyStream, nullptr);
+        }
+        else
+        {
+            SkinVertices(paletteArray, 2, cylinder.boneCountArray, cylinder.boneIndexArray, cylinder.boneWeightArray, cylinder.vertexCount, positionStream, emptyStream, emptyStream, nullptr);
+        }
+
+        float minimum = 1.0F;
+        float sum = 0.0F;
+        for (machine a = 0; a < cylinder.vertexCount; a++)
+        {
+            float r = Sqrt(outputArray[a * 3] * outputArray[a * 3] + outputArray[a * 3 + 1] * outputArray[a * 3 + 1]);
+            minimum = Fmin(minimum, r);
+            sum += r;
+        }
+
+        *minRadius = minimum;
+        *meanRadius = sum / float(cylinder.vertexCount);
+        delete[] outputArray;
+    }
+
+    // Returns the average time in milliseconds to skin positions and normals for a large mesh with random
+    // four-bone influences and rotating, translating bones.
+
+    float MeasureThroughput(int32 method, ThreadPool* threadPool)
+    {
+        int32 vertexCount = kThroughputVertexCount;
+        int32 influenceCount = vertexCount * kThroughputInfluenceCount;
+
+        float*  positionArray = new float[vertexCount * 3];
+        float*  normalArray = new float[vertexCount * 3];
+        float*  outputPositionArray = new float[vertexCount * 3];
+        float*  outputNormalArray = new float[vertexCount * 3];
+        uint16* boneCountArray = new uint16[vertexCount];
+        uint16* boneIndexArray = new uint16[influenceCount];
+        float*  boneWeightArray = new float[influenceCount];
+
+        uint32 seed = 1;
+        auto random = [&seed](void) -> float {
+            seed = seed * 1664525U + 1013904223U;
+            return (float(seed >> 8) * (1.0F / 16777216.0F));
+        };
+
+        for (machine a = 0; a < vertexCount; a++)
+        {
+            for (machine k = 0; k < 3; k++)
+            {
+                positionArray[a * 3 + k] = random() * 2.0F - 1.0F;
+            }
+
+            normalArray[a * 3] = 0.0F;
+            normalArray[a * 3 + 1] = 0.0F;
+            normalArray[a * 3 + 2] = 1.0F;
+
+            boneCountArray[a] = kThroughputInfluenceCount;
+            for (machine k = 0; k < kThroughputInfluenceCount; k++)
+            {
+                boneIndexArray[a * kThroughputInfluenceCount + k] = uint16(random() * float(kThroughputBoneCount - 1));
+                boneWeightArray[a * kThroughputInfluenceCount + k] = random() + 0.01F;
+            }
+        }
+
+        Transform3D paletteArray[kThroughputBoneCount];
+        for (machine b = 0; b < kThroughputBoneCount; b++)
+        {
+            paletteArray[b].Set(Matrix3D::MakeRotation(random() * Math::tau, !Normalize(Vector3D(random() - 0.5F, random() - 0.5F, random() - 0.5F))),
+                                Vector3D(random(), random(), random()));
+        }
+
+        SkinningStream positionStream = {positionArray, 3, outputPositionArray};
+        SkinningStream normalStream = {normalArray, 3, outputNormalArray};
+        SkinningStream emptyStream = {nullptr, 0, nullptr};
+
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+        for (machine i = 0; i < kThroughputIterationCount; i++)
+        {
+            if (method == kSkinningDualQuaternion)
+            {
+                SkinVerticesDualQuaternion(paletteArray, kThroughputBoneCount, boneCountArray, boneIndexArray, boneWeightArray, vertexCount, positionStream, normalStream, emptyStream, threadPool);
+            }
+            else
+            {
+                SkinVertices(paletteArray, kThroughputBoneCount, boneCountArray, boneIndexArray, boneWeightArray, vertexCount, positionStream, normalStream, emptyStream, threadPool);
+            }
+        }
+
+        float time = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count() / float(kThroughputIterationCount);
+
+        delete[] boneWeightArray;
+        delete[] boneIndexArray;
+        delete[] boneCountArray;
+        delete[] outputNormalArray;
+        delete[] outputPositionArray;
+        delete[] normalArray;
+        delete[] positionArray;
+        return (time);
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Cylinder cylinder;
+
+    printf("Twist accuracy (radius of a unit cylinder)\n");
+    printf("%8s  %12s  %12s  %12s  %12s\n", "degrees", "LBS min", "LBS mean", "DQS min", "DQS mean");
+
+    static const float twistAngle[] = {45.0F, 90.0F, 135.0F, 170.0F};
+    for (float degrees : twistAngle)
+    {
+        float lbsMin, lbsMean, dqsMin, dqsMean;
+        MeasureTwist(cylinder, degrees * (Math::tau / 360.0F), kSkinningLinearBlend, &lbsMin, &lbsMean);
+        MeasureTwist(cylinder, degrees * (Math::tau / 360.0F), kSkinningDualQuaternion, &dqsMin, &dqsMean);
+        printf("%8.0f  %12.4f  %12.4f  %12.4f  %12.4f\n", degrees, lbsMin, lbsMean, dqsMin, dqsMean);
+    }
+
+    ThreadPool threadPool;
+
+    printf("\nThroughput (%d vertices, %d influences, positions and normals)\n", int32(kThroughputVertexCount), int32(kThroughputInfluenceCount));
+    printf("%8s  %12s  %12s\n", "method", "serial ms", "parallel ms");
+
+    static const char* const methodName[2] = {"LBS", "DQS"};
+    for (machine method = 0; method < 2; method++)
+    {
+        float serialTime = MeasureThroughput(int32(method), nullptr);
+        float parallelTime = MeasureThroughput(int32(method), &threadPool);
+        printf("%8s  %12.3f  %12.3f\n", methodName[method], serialTime, parallelTime);
+    }
+
+    return (0);
+}
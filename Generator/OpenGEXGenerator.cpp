@@ -0,0 +1,810 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#include "OpenGEXGenerator.h"
+
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+using namespace OpenGEX;
+
+namespace
+{
+    enum
+    {
+        kGeneratorElementsPerLine = 8,
+        kGeneratorBoneFanout = 4
+    };
+
+    class SceneWriter
+    {
+    private:
+        const GeneratorParams* params;
+        std::string*           output;
+        int32                  indentLevel;
+        uint32                 randomState;
+
+        int32  gridSize;
+        float* boneWorldArray;
+
+        void WriteIndent(void);
+        void Print(const char* format, ...);
+        void Line(const char* format, ...);
+        void Open(const char* format, ...);
+        void Close(void);
+
+        void WriteFloat(float f);
+        void WriteFloatArray(const float* data, int32 count, int32 arraySize);
+        void WriteTranslationMatrix(float x, float y, float z);
+
+        void WriteMetrics(void);
+        void WriteGeometryNode(int32 index, int32 level);
+        void WriteAnimation(int32 clip);
+        void WriteGeometryObject(int32 index);
+        void WriteMesh(int32 object, int32 level);
+        void WriteSkin(int32 vertexCount);
+        void WriteBoneNode(int32 index);
+        void WriteMaterial(void);
+        void WriteClips(void);
+
+    public:
+        SceneWriter(const GeneratorParams* generatorParams, std::string* string);
+        ~SceneWriter();
+
+        float Random(void)
+        {
+            randomState = randomState * 1664525U + 1013904223U;
+            return (float(randomState >> 8) * (1.0F / 16777216.0F));
+        }
+
+        void WriteScene(void);
+    };
+
+    SceneWriter::SceneWriter(const GeneratorParams* generatorParams, std::string* string)
+    {
+        params = generatorParams;
+        output = string;
+        indentLevel = 0;
+        randomState = generatorParams->seed;
+
+        gridSize = Max(int32(std::sqrt(float(Max(params->vertexCount, 4))) + 0.5F), 2);
+
+        // Bones form a tree in which each bone has up to kGeneratorBoneFanout children. Only the translation
+        // of each bone in world space is needed for the bind pose.
+
+        int32 boneCount = params->boneCount;
+        boneWorldArray = new float[Max(boneCount, 1) * 3];
+        for (machine a = 0; a < boneCount; a++)
+        {
+            if (a == 0)
+            {
+                boneWorldArray[0] = 0.5F;
+                boneWorldArray[1] = 0.5F;
+                boneWorldArray[2] = 0.0F;
+            }
+            else
+            {
+                machine parent = (a - 1) / kGeneratorBoneFanout;
+                float   angle = float((a - 1) % kGeneratorBoneFanout) * 1.5707963F;
+                boneWorldArray[a * 3] = boneWorldArray[parent * 3] + std::cos(angle) * 0.125F;
+                boneWorldArray[a * 3 + 1] = boneWorldArray[parent * 3 + 1] + std::sin(angle) * 0.125F;
+                boneWorldArray[a * 3 + 2] = boneWorldArray[parent * 3 + 2] + 0.125F;
+            }
+        }
+    }
+
+    SceneWriter::~SceneWriter()
+    {
+        delete[] boneWorldArray;
+    }
+
+    void SceneWriter::WriteIndent(void)
+    {
+        output->append(indentLevel, '\t');
+    }
+
+    void SceneWriter::Print(const char* format, ...)
+    {
+        char    buffer[256];
+        va_list args;
+
+        va_start(args, format);
+        int32 length = vsnprintf(buffer, sizeof(buffer), format, args);
+        va_end(args);
+
+        output->append(buffer, Min(length, int32(sizeof(buffer) - 1)));
+    }
+
+    void SceneWriter::Line(const char* format, ...)
+    {
+        char    buffer[256];
+        va_list args;
+
+        va_start(args, format);
+        int32 length = vsnprintf(buffer, sizeof(buffer), format, args);
+        va_end(args);
+
+        WriteIndent();
+        output->append(buffer, Min(length, int32(sizeof(buffer) - 1)));
+        output->push_back('\n');
+    }
+
+    void SceneWriter::Open(const char* format, ...)
+    {
+        char    buffer[256];
+        va_list args;
+
+        va_start(args, format);
+        int32 length = vsnprintf(buffer, sizeof(buffer), format, args);
+        va_end(args);
+
+        WriteIndent();
+        output->append(buffer, Min(length, int32(sizeof(buffer) - 1)));
+        output->push_back('\n');
+
+        WriteIndent();
+        output->append("{\n");
+        indentLevel++;
+    }
+
+    void SceneWriter::Close(void)
+    {
+        indentLevel--;
+        WriteIndent();
+        output->append("}\n");
+    }
+
+    void SceneWriter::WriteFloat(float f)
+    {
+        if (params->hexFloatFlag)
+        {
+            uint32 bits;
+            memcpy(&bits, &f, 4);
+            Print("0x%08X", bits);
+        }
+        else
+        {
+            // Nine significant digits are enough for every float to be read back exactly.
+
+            Print("%.9g", f);
+        }
+    }
+
+    void SceneWriter::WriteFloatArray(const float* data, int32 count, int32 arraySize)
+    {
+        // Writes count elements, each with arraySize components, or scalars if arraySize is zero.
+
+        int32 componentCount = Max(arraySize, 1);
+        for (machine a = 0; a < count; a++)
+        {
+            if ((a % kGeneratorElementsPerLine) == 0)
+            {
+                WriteIndent();
+            }
+
+            if (arraySize != 0)
+            {
+                output->push_back('{');
+            }
+
+            for (machine k = 0; k < componentCount; k++)
+            {
+                WriteFloat(data[a * componentCount + k]);
+                if (k + 1 < componentCount)
+                {
+                    output->append(", ");
+                }
+            }
+
+            if (arraySize != 0)
+            {
+                output->push_back('}');
+            }
+
+            if (a + 1 < count)
+            {
+                output->append(((a + 1) % kGeneratorElementsPerLine == 0) ? ",\n" : ", ");
+            }
+        }
+
+        output->push_back('\n');
+    }
+
+    void SceneWriter::WriteTranslationMatrix(float x, float y, float z)
+    {
+        float m[16] = {1.0F, 0.0F, 0.0F, 0.0F, 0.0F, 1.0F, 0.0F, 0.0F, 0.0F, 0.0F, 1.0F, 0.0F, x, y, z, 1.0F};
+        WriteFloatArray(m, 1, 16);
+    }
+
+    void SceneWriter::WriteMetrics(void)
+    {
+        Line("Metric (key = \"distance\") {float {1}}");
+        Line("Metric (key = \"angle\") {float {1}}");
+        Line("Metric (key = \"time\") {float {1}}");
+        Line("Metric (key = \"up\") {string {\"z\"}}");
+        Line("Metric (key = \"forward\") {string {\"x\"}}");
+        output->push_back('\n');
+    }
+
+    void SceneWriter::WriteGeometryNode(int32 index, int32 level)
+    {
+        Open("GeometryNode $node%d", index + 1);
+
+        Line("Name {string {\"Node%d\"}}", index + 1);
+        Line("ObjectRef {ref {$geometry%d}}", (index % Max(params->meshCount, 1)) + 1);
+        Line("MaterialRef {ref {$material1}}");
+        output->push_back('\n');
+
+        // Nested nodes are offset from their parent, and top-level chains are spread out along the x axis.
+
+        float x = (level == 0) ? float(index / Max(params->hierarchyDepth, 1)) * 2.0F : 0.0F;
+        float z = (level == 0) ? 0.0F : 1.5F;
+
+        Open("Transform");
+        Open("float[16]");
+        WriteTranslationMatrix(x, 0.0F, z);
+        Close();
+        Close();
+
+        for (machine m = 0; m < params->morphTargetCount; m++)
+        {
+            Line("MorphWeight %%mw%d (index = %d) {float {0}}", int32(m + 1), int32(m + 1));
+        }
+
+        if (index < params->animatedNodeCount)
+        {
+            // Every track has its own animated transform, cycling through translation, rotation, and scale.
+
+            for (machine k = 0; k < params->trackCount; k++)
+            {
+                switch (k % 3)
+                {
+                case 0:
+
+                    Line("Translation %%xform%d (kind = \"xyz\") {float[3] {{0, 0, 0}}}", int32(k + 1));
+                    break;
+
+                case 1:
+
+                    Line("Rotation %%xform%d (kind = \"z\") {float {0}}", int32(k + 1));
+                    break;
+
+                default:
+
+                    Line("Scale %%xform%d (kind = \"xyz\") {float[3] {{1, 1, 1}}}", int32(k + 1));
+                    break;
+                }
+            }
+
+            for (machine clip = 0; clip < params->clipCount; clip++)
+            {
+                WriteAnimation(int32(clip));
+            }
+        }
+
+        int32 child = index + 1;
+        if ((level + 1 < params->hierarchyDepth) && (child < params->nodeCount))
+        {
+            output->push_back('\n');
+            WriteGeometryNode(child, level + 1);
+        }
+
+        Close();
+    }
+
+    void SceneWriter::WriteAnimation(int32 clip)
+    {
+        static const char* const curveName[4] = {"constant", "linear", "bezier", "tcb"};
+
+        int32       keyCount = Max(params->keyCount, 1);
+        int32       curveType = params->curveType;
+        const char* valueCurve = curveName[curveType];
+        const char* timeCurve = (curveType == kGeneratorCurveBezier) ? "bezier" : "linear";
+
+        float* timeArray = new float[keyCount * 3];
+        float* valueArray = new float[keyCount * 3];
+
+        Open("Animation (clip = %d)", clip);
+
+        for (machine k = 0; k < params->trackCount; k++)
+        {
+            int32 arraySize = ((k % 3) == 1) ? 0 : 3;
+            int32 componentCount = Max(arraySize, 1);
+
+            Open("Track (target = %%xform%d)", int32(k + 1));
+
+            for (machine a = 0; a < keyCount; a++)
+            {
+                timeArray[a] = float(a) / 30.0F;
+            }
+
+            Open("Time (curve = \"%s\")", timeCurve);
+            Open("Key");
+            Open("float");
+            WriteFloatArray(timeArray, keyCount, 0);
+            Close();
+            Close();
+
+            if (curveType == kGeneratorCurveBezier)
+            {
+                for (machine side = 0; side < 2; side++)
+                {
+                    float offset = (side == 0) ? -1.0F / 90.0F : 1.0F / 90.0F;
+                    for (machine a = 0; a < keyCount; a++)
+                    {
+                        timeArray[keyCount + a] = timeArray[a] + offset;
+                    }
+
+                    Open("Key (kind = \"%s\")", (side == 0) ? "-control" : "+control");
+                    Open("float");
+                    WriteFloatArray(timeArray + keyCount, keyCount, 0);
+                    Close();
+                    Close();
+                }
+            }
+
+            Close();
+
+            Open("Value (curve = \"%s\")", valueCurve);
+
+            float base = ((k % 3) == 2) ? 1.0F : 0.0F;
+            for (machine a = 0; a < keyCount * componentCount; a++)
+            {
+                valueArray[a] = base + (Random() - 0.5F) * 0.5F;
+            }
+
+            Open("Key");
+            Open((arraySize != 0) ? "float[3]" : "float");
+            WriteFloatArray(valueArray, keyCount, arraySize);
+            Close();
+            Close();
+
+            if (curveType == kGeneratorCurveBezier)
+            {
+                // Control points equal to the values give flat tangents at every key.
+
+                Open("Key (kind = \"-control\")");
+                Open((arraySize != 0) ? "float[3]" : "float");
+                WriteFloatArray(valueArray, keyCount, arraySize);
+                Close();
+                Close();
+
+                Open("Key (kind = \"+control\")");
+                Open((arraySize != 0) ? "float[3]" : "float");
+                WriteFloatArray(valueArray, keyCount, arraySize);
+                Close();
+                Close();
+            }
+            else if (curveType == kGeneratorCurveTcb)
+            {
+                for (machine a = 0; a < keyCount; a++)
+                {
+                    timeArray[a] = 0.0F;
+                }
+
+                static const char* const tcbKind[3] = {"tension", "continuity", "bias"};
+                for (machine kind = 0; kind < 3; kind++)
+                {
+                    Open("Key (kind = \"%s\")", tcbKind[kind]);
+                    Open("float");
+                    WriteFloatArray(timeArray, keyCount, 0);
+                    Close();
+                    Close();
+                }
+            }
+
+            Close();
+            Close();
+        }
+
+        Close();
+
+        delete[] valueArray;
+        delete[] timeArray;
+    }
+
+    void SceneWriter::WriteGeometryObject(int32 index)
+    {
+        Open("GeometryObject $geometry%d", index + 1);
+
+        for (machine m = 0; m < params->morphTargetCount; m++)
+        {
+            Line("Morph (index = %d) {Name {string {\"Morph%d\"}}}", int32(m + 1), int32(m + 1));
+        }
+
+        for (machine level = 0; level <= params->lodCount; level++)
+        {
+            WriteMesh(index, int32(level));
+        }
+
+        Close();
+        output->push_back('\n');
+    }
+
+    void SceneWriter::WriteMesh(int32 object, int32 level)
+    {
+        // Each mesh is a gently curved grid. Every level of detail halves the resolution in both directions.
+
+        int32 size = Max(((gridSize - 1) >> level) + 1, 2);
+        int32 vertexCount = size * size;
+        float scale = 1.0F / float(size - 1);
+
+        float* positionArray = new float[vertexCount * 3];
+        float* normalArray = new float[vertexCount * 3];
+        float* texcoordArray = new float[vertexCount * 2];
+
+        for (machine j = 0; j < size; j++)
+        {
+            for (machine i = 0; i < size; i++)
+            {
+                machine a = j * size + i;
+                float   u = float(i) * scale;
+                float   v = float(j) * scale;
+                float   dz = std::cos(u * 6.2831853F) * 0.05F;
+
+                positionArray[a * 3] = u;
+                positionArray[a * 3 + 1] = v;
+                positionArray[a * 3 + 2] = std::sin(u * 6.2831853F) * 0.05F + float(object) * 0.001F;
+
+                float nx = -dz * 6.2831853F;
+                float inverseLength = 1.0F / std::sqrt(nx * nx + 1.0F);
+                normalArray[a * 3] = nx * inverseLength;
+                normalArray[a * 3 + 1] = 0.0F;
+                normalArray[a * 3 + 2] = inverseLength;
+
+                texcoordArray[a * 2] = u;
+                texcoordArray[a * 2 + 1] = v;
+            }
+        }
+
+        if (level == 0)
+        {
+            Open("Mesh (primitive = \"triangles\")");
+        }
+        else
+        {
+            Open("Mesh (lod = %d, primitive = \"triangles\")", level);
+        }
+
+        Open("VertexArray (attrib = \"position\")");
+        Open("float[3]");
+        WriteFloatArray(positionArray, vertexCount, 3);
+        Close();
+        Close();
+
+        Open("VertexArray (attrib = \"normal\")");
+        Open("float[3]");
+        WriteFloatArray(normalArray, vertexCount, 3);
+        Close();
+        Close();
+
+        Open("VertexArray (attrib = \"texcoord\")");
+        Open("float[2]");
+        WriteFloatArray(texcoordArray, vertexCount, 2);
+        Close();
+        Close();
+
+        // Each morph target raises a round patch of the grid, so it only changes part of the mesh.
+        // The patch positions come from a separate sequence so that every level of detail matches.
+
+        uint32 patchState = params->seed ^ (uint32(object) * 0x9E3779B9U);
+        for (machine m = 0; m < params->morphTargetCount; m++)
+        {
+            patchState = patchState * 1664525U + 1013904223U;
+            float cx = float(patchState >> 8) * (1.0F / 16777216.0F);
+            patchState = patchState * 1664525U + 1013904223U;
+            float cy = float(patchState >> 8) * (1.0F / 16777216.0F);
+
+            float* morphArray = new float[vertexCount * 3];
+            for (machine a = 0; a < vertexCount; a++)
+            {
+                float dx = positionArray[a * 3] - cx;
+                float dy = positionArray[a * 3 + 1] - cy;
+                float f = 1.0F - (dx * dx + dy * dy) * 64.0F;
+
+                morphArray[a * 3] = positionArray[a * 3];
+                morphArray[a * 3 + 1] = positionArray[a * 3 + 1];
+                morphArray[a * 3 + 2] = positionArray[a * 3 + 2] + ((f > 0.0F) ? f * f * 0.1F : 0.0F);
+            }
+
+            Open("VertexArray (attrib = \"position\", morph = %d)", int32(m + 1));
+            Open("float[3]");
+            WriteFloatArray(morphArray, vertexCount, 3);
+            Close();
+            Close();
+
+            delete[] morphArray;
+        }
+
+        Open("IndexArray");
+        Open("uint32[3]");
+
+        int32 triangleCount = (size - 1) * (size - 1) * 2;
+        int32 triangle = 0;
+        for (machine j = 0; j < size - 1; j++)
+        {
+            for (machine i = 0; i < size - 1; i++)
+            {
+                int32 a = int32(j * size + i);
+                for (machine k = 0; k < 2; k++)
+                {
+                    if ((triangle % kGeneratorElementsPerLine) == 0)
+                    {
+                        WriteIndent();
+                    }
+
+                    if (k == 0)
+                    {
+                        Print("{%d, %d, %d}", a, a + 1, a + size + 1);
+                    }
+                    else
+                    {
+                        Print("{%d, %d, %d}", a, a + size + 1, a + size);
+                    }
+
+                    triangle++;
+                    if (triangle < triangleCount)
+                    {
+                        output->append((triangle % kGeneratorElementsPerLine == 0) ? ",\n" : ", ");
+                    }
+                }
+            }
+        }
+
+        output->push_back('\n');
+        Close();
+        Close();
+
+        if (params->boneCount > 0)
+        {
+            WriteSkin(vertexCount);
+        }
+
+        Close();
+
+        delete[] texcoordArray;
+        delete[] normalArray;
+        delete[] positionArray;
+    }
+
+    void SceneWriter::WriteSkin(int32 vertexCount)
+    {
+        int32 boneCount = params->boneCount;
+        int32 influenceCount = Min(Max(params->influenceCount, 1), boneCount);
+
+        Open("Skin");
+
+        Open("Transform");
+        Open("float[16]");
+        WriteTranslationMatrix(0.0F, 0.0F, 0.0F);
+        Close();
+        Close();
+
+        // Every object shares the same skeleton, so the references and bind pose are identical.
+
+        Open("Skeleton");
+        Open("BoneRefArray");
+        Open("ref");
+        for (machine a = 0; a < boneCount; a++)
+        {
+            if ((a % kGeneratorElementsPerLine) == 0)
+            {
+                WriteIndent();
+            }
+
+            Print("$bone%d", int32(a + 1));
+            if (a + 1 < boneCount)
+            {
+                output->append(((a + 1) % kGeneratorElementsPerLine == 0) ? ",\n" : ", ");
+            }
+        }
+
+        output->push_back('\n');
+        Close();
+        Close();
+
+        Open("Transform");
+        Open("float[16]");
+        for (machine a = 0; a < boneCount; a++)
+        {
+            WriteTranslationMatrix(boneWorldArray[a * 3], boneWorldArray[a * 3 + 1], boneWorldArray[a * 3 + 2]);
+        }
+
+        Close();
+        Close();
+        Close();
+
+        Open("BoneCountArray");
+        Open("uint16");
+        for (machine a = 0; a < vertexCount; a++)
+        {
+            if ((a % (kGeneratorElementsPerLine * 4)) == 0)
+            {
+                WriteIndent();
+            }
+
+            Print("%d", influenceCount);
+            if (a + 1 < vertexCount)
+            {
+                output->append(((a + 1) % (kGeneratorElementsPerLine * 4) == 0) ? ",\n" : ", ");
+            }
+        }
+
+        output->push_back('\n');
+        Close();
+        Close();
+
+        // Consecutive bones starting at a random one influence each vertex, with decreasing weights that sum to one.
+
+        int32   totalCount = vertexCount * influenceCount;
+        uint16* boneIndexArray = new uint16[totalCount];
+        float*  boneWeightArray = new float[totalCount];
+
+        for (machine a = 0; a < vertexCount; a++)
+        {
+            int32 firstBone = Min(int32(Random() * float(boneCount)), boneCount - 1);
+            float sum = 0.0F;
+
+            for (machine k = 0; k < influenceCount; k++)
+            {
+                float weight = 1.0F / float(k + 1);
+                boneIndexArray[a * influenceCount + k] = uint16((firstBone + k) % boneCount);
+                boneWeightArray[a * influenceCount + k] = weight;
+                sum += weight;
+            }
+
+            for (machine k = 0; k < influenceCount; k++)
+            {
+                boneWeightArray[a * influenceCount + k] /= sum;
+            }
+        }
+
+        Open("BoneIndexArray");
+        Open("uint16");
+        for (machine a = 0; a < totalCount; a++)
+        {
+            if ((a % (kGeneratorElementsPerLine * 4)) == 0)
+            {
+                WriteIndent();
+            }
+
+            Print("%d", boneIndexArray[a]);
+            if (a + 1 < totalCount)
+            {
+                output->append(((a + 1) % (kGeneratorElementsPerLine * 4) == 0) ? ",\n" : ", ");
+            }
+        }
+
+        output->push_back('\n');
+        Close();
+        Close();
+
+        Open("BoneWeightArray");
+        Open("float");
+        WriteFloatArray(boneWeightArray, totalCount, 0);
+        Close();
+        Close();
+
+        Close();
+
+        delete[] boneWeightArray;
+        delete[] boneIndexArray;
+    }
+
+    void SceneWriter::WriteBoneNode(int32 index)
+    {
+        Open("BoneNode $bone%d", index + 1);
+        Line("Name {string {\"Bone%d\"}}", index + 1);
+
+        float x = boneWorldArray[index * 3];
+        float y = boneWorldArray[index * 3 + 1];
+        float z = boneWorldArray[index * 3 + 2];
+        if (index > 0)
+        {
+            machine parent = (index - 1) / kGeneratorBoneFanout;
+            x -= boneWorldArray[parent * 3];
+            y -= boneWorldArray[parent * 3 + 1];
+            z -= boneWorldArray[parent * 3 + 2];
+        }
+
+        Open("Transform");
+        Open("float[16]");
+        WriteTranslationMatrix(x, y, z);
+        Close();
+        Close();
+
+        for (machine k = 1; k <= kGeneratorBoneFanout; k++)
+        {
+            int32 child = index * kGeneratorBoneFanout + int32(k);
+            if (child < params->boneCount)
+            {
+                WriteBoneNode(child);
+            }
+        }
+
+        Close();
+    }
+
+    void SceneWriter::WriteMaterial(void)
+    {
+        Open("Material $material1");
+        Line("Name {string {\"Default\"}}");
+        Line("Color (attrib = \"diffuse\") {float[3] {{0.588235, 0.588235, 0.588235}}}");
+        Close();
+        output->push_back('\n');
+    }
+
+    void SceneWriter::WriteClips(void)
+    {
+        for (machine clip = 0; clip < params->clipCount; clip++)
+        {
+            Line("Clip (index = %d) {Name {string {\"Clip%d\"}}}", int32(clip), int32(clip));
+        }
+
+        if (params->clipCount > 0)
+        {
+            output->push_back('\n');
+        }
+    }
+
+    void SceneWriter::WriteScene(void)
+    {
+        WriteMetrics();
+        WriteClips();
+
+        if (params->boneCount > 0)
+        {
+            Open("Node $skeleton");
+            Line("Name {string {\"Skeleton\"}}");
+            WriteBoneNode(0);
+            Close();
+            output->push_back('\n');
+        }
+
+        int32 depth = Max(params->hierarchyDepth, 1);
+        for (machine a = 0; a < params->nodeCount; a += depth)
+        {
+            WriteGeometryNode(int32(a), 0);
+            output->push_back('\n');
+        }
+
+        for (machine a = 0; a < params->meshCount; a++)
+        {
+            WriteGeometryObject(int32(a));
+        }
+
+        WriteMaterial();
+    }
+} // namespace
+
+void OpenGEX::InitGeneratorParams(GeneratorParams* params)
+{
+    params->nodeCount = 16;
+    params->hierarchyDepth = 4;
+    params->meshCount = 4;
+    params->vertexCount = 1024;
+    params->lodCount = 0;
+    params->morphTargetCount = 0;
+    params->boneCount = 0;
+    params->influenceCount = 4;
+    params->clipCount = 0;
+    params->animatedNodeCount = 0;
+    params->trackCount = 3;
+    params->keyCount = 30;
+    params->curveType = kGeneratorCurveLinear;
+    params->hexFloatFlag = false;
+    params->seed = 1;
+}
+
+void OpenGEX::GenerateScene(const GeneratorParams& params, std::string* output)
+{
+    SceneWriter writer(&params, output);
+    writer.WriteScene();
+}
@@ -0,0 +1,57 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#ifndef OpenGEXGenerator_h
+#define OpenGEXGenerator_h
+
+#include "TSPlatform.h"
+
+#include <string>
+
+using namespace Terathon;
+
+namespace OpenGEX
+{
+    enum
+    {
+        kGeneratorCurveConstant,
+        kGeneratorCurveLinear,
+        kGeneratorCurveBezier,
+        kGeneratorCurveTcb
+    };
+
+    // Parameters controlling the size and content of a generated scene. The same parameters and seed always
+    // produce the same text.
+
+    struct GeneratorParams
+    {
+        int32  nodeCount;         // Geometry nodes in the scene.
+        int32  hierarchyDepth;    // Geometry nodes are nested in chains of this length.
+        int32  meshCount;         // Geometry objects, which the nodes refer to in turn.
+        int32  vertexCount;       // Approximate vertex count of the most detailed mesh of each object.
+        int32  lodCount;          // Additional levels of detail per object, each with a quarter of the vertices.
+        int32  morphTargetCount;  // Morph targets per object, each moving a patch of vertices.
+        int32  boneCount;         // Bones in the skeleton shared by every object. Zero for no skins.
+        int32  influenceCount;    // Bones per skinned vertex.
+        int32  clipCount;         // Animation clips.
+        int32  animatedNodeCount; // Geometry nodes that are animated, starting with the first.
+        int32  trackCount;        // Tracks per animated node in each clip.
+        int32  keyCount;          // Keys per track.
+        int32  curveType;         // One of the kGeneratorCurve constants, used for the values of every track.
+        bool   hexFloatFlag;      // Write floating-point values as hexadecimal bit patterns.
+        uint32 seed;
+    };
+
+    void InitGeneratorParams(GeneratorParams* params);
+
+    // Appends the OpenGEX text for a scene to the output string.
+
+    void GenerateScene(const GeneratorParams& params, std::string* output);
+} // namespace OpenGEX
+
+#endif
@@ -0,0 +1,130 @@
+#include "OpenGEXGenerator.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace OpenGEX;
+
+namespace
+{
+    struct IntegerOption
+    {
+        const char* name;
+        int32 GeneratorParams::*member;
+    };
+
+    const IntegerOption integerOption[] =
+    {
+        {"--nodes", &GeneratorParams::nodeCount},
+        {"--depth", &GeneratorParams::hierarchyDepth},
+        {"--meshes", &GeneratorParams::meshCount},
+        {"--vertices", &GeneratorParams::vertexCount},
+        {"--lods", &GeneratorParams::lodCount},
+        {"--morphs", &GeneratorParams::morphTargetCount},
+        {"--bones", &GeneratorParams::boneCount},
+        {"--influences", &GeneratorParams::influenceCount},
+        {"--clips", &GeneratorParams::clipCount},
+        {"--animated", &GeneratorParams::animatedNodeCount},
+        {"--tracks", &GeneratorParams::trackCount},
+        {"--keys", &GeneratorParams::keyCount}
+    };
+
+    void PrintUsage(void)
+    {
+        fprintf(stderr, "Usage: GenerateOGEX [options] output.ogex\n");
+        for (const IntegerOption& option : integerOption)
+        {
+            fprintf(stderr, "    %s count\n", option.name);
+        }
+
+        fprintf(stderr, "    --curve constant|linear|bezier|tcb\n    --seed value\n    --hex\n");
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    GeneratorParams params;
+    InitGeneratorParams(&params);
+
+    const char* outputName = nullptr;
+    for (int a = 1; a < argc; a++)
+    {
+        const char* arg = argv[a];
+        if (strcmp(arg, "--hex") == 0)
+        {
+            params.hexFloatFlag = true;
+            continue;
+        }
+
+        if (arg[0] != '-')
+        {
+            outputName = arg;
+            continue;
+        }
+
+        if (a + 1 >= argc)
+        {
+            PrintUsage();
+            return (1);
+        }
+
+        const char* value = argv[++a];
+        bool        found = false;
+
+        for (const IntegerOption& option : integerOption)
+        {
+            if (strcmp(arg, option.name) == 0)
+            {
+                params.*option.member = Max(atoi(value), 0);
+                found = true;
+                break;
+            }
+        }
+
+        if (strcmp(arg, "--seed") == 0)
+        {
+            params.seed = uint32(strtoul(value, nullptr, 0));
+            found = true;
+        }
+        else if (strcmp(arg, "--curve") == 0)
+        {
+            static const char* const curveName[4] = {"constant", "linear", "bezier", "tcb"};
+
+            for (machine k = 0; k < 4; k++)
+            {
+                if (strcmp(value, curveName[k]) == 0)
+                {
+                    params.curveType = int32(k);
+                    found = true;
+                }
+            }
+        }
+
+        if (!found)
+        {
+            PrintUsage();
+            return (1);
+        }
+    }
+
+    if (!outputName)
+    {
+        PrintUsage();
+        return (1);
+    }
+
+    std::string text;
+    GenerateScene(params, &text);
+
+    FILE* file = fopen(outputName, "wb");
+    if (!file)
+    {
+        fprintf(stderr, "Unable to open %s\n", outputName);
+        return (1);
+    }
+
+    fwrite(text.data(), 1, text.size(), file);
+    fclose(file);
+    return (0);
+}
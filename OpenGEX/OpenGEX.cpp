@@ -7,7 +7,11 @@
 //
 
 #include "OpenGEX.h"
+#include "OpenGEXConvert.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <utility>
 
 using namespace OpenGEX;
@@ -20,6 +24,27 @@ OpenGexStructure::~OpenGexStructure()
 {
 }
 
+DataResult OpenGexStructure::ProcessData(DataDescription* dataDescription)
+{
+    LoadMonitor* loadMonitor = static_cast<OpenGexDataDescription*>(dataDescription)->GetLoadMonitor();
+    if (loadMonitor)
+    {
+        if (loadMonitor->GetCancelFlag())
+        {
+            return (kDataOpenGexLoadCancelled);
+        }
+
+        loadMonitor->AddProcessedStructure();
+    }
+
+    if (static_cast<OpenGexDataDescription*>(dataDescription)->GetSubstructuresProcessed(this))
+    {
+        return (kDataOkay);
+    }
+
+    return (Structure::ProcessData(dataDescription));
+}
+
 MetricStructure::MetricStructure() : OpenGexStructure(kStructureMetric)
 {
 }
@@ -53,6 +78,8 @@ bool MetricStructure::ValidateSubstructure(const DataDescription* dataDescriptio
 
 DataResult MetricStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("MetricStructure::ProcessData");
+
     const Structure* structure = GetFirstSubnode();
     if (!structure)
     {
@@ -235,6 +262,8 @@ bool NameStructure::ValidateSubstructure(const DataDescription* dataDescription,
 
 DataResult NameStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("NameStructure::ProcessData");
+
     const Structure* structure = GetFirstSubnode();
     if (!structure)
     {
@@ -277,6 +306,8 @@ bool ObjectRefStructure::ValidateSubstructure(const DataDescription* dataDescrip
 
 DataResult ObjectRefStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("ObjectRefStructure::ProcessData");
+
     const Structure* structure = GetFirstSubnode();
     if (!structure)
     {
@@ -291,7 +322,7 @@ DataResult ObjectRefStructure::ProcessData(DataDescription* dataDescription)
     const DataStructure<RefDataType>* dataStructure = static_cast<const DataStructure<RefDataType>*>(structure);
     if (dataStructure->GetDataElementCount() != 0)
     {
-        Structure* objectStructure = dataDescription->FindStructure(dataStructure->GetDataElement(0));
+        Structure* objectStructure = static_cast<OpenGexDataDescription*>(dataDescription)->GetNameIndex()->FindStructure(dataStructure->GetDataElement(0));
         if (objectStructure)
         {
             targetStructure = objectStructure;
@@ -336,6 +367,8 @@ bool MaterialRefStructure::ValidateSubstructure(const DataDescription* dataDescr
 
 DataResult MaterialRefStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("MaterialRefStructure::ProcessData");
+
     const Structure* structure = GetFirstSubnode();
     if (!structure)
     {
@@ -350,7 +383,7 @@ DataResult MaterialRefStructure::ProcessData(DataDescription* dataDescription)
     const DataStructure<RefDataType>* dataStructure = static_cast<const DataStructure<RefDataType>*>(structure);
     if (dataStructure->GetDataElementCount() != 0)
     {
-        const Structure* materialStructure = dataDescription->FindStructure(dataStructure->GetDataElement(0));
+        const Structure* materialStructure = static_cast<OpenGexDataDescription*>(dataDescription)->GetNameIndex()->FindStructure(dataStructure->GetDataElement(0));
         if (materialStructure)
         {
             if (materialStructure->GetStructureType() != kStructureMaterial)
@@ -420,6 +453,8 @@ bool TransformStructure::ValidateSubstructure(const DataDescription* dataDescrip
 
 DataResult TransformStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("TransformStructure::ProcessData");
+
     const Structure* structure = GetFirstSubnode();
     if (!structure)
     {
@@ -525,6 +560,8 @@ bool TranslationStructure::ValidateSubstructure(const DataDescription* dataDescr
 
 DataResult TranslationStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("TranslationStructure::ProcessData");
+
     const Structure* structure = GetFirstSubnode();
     if (!structure)
     {
@@ -616,6 +653,8 @@ bool RotationStructure::ValidateSubstructure(const DataDescription* dataDescript
 
 DataResult RotationStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("RotationStructure::ProcessData");
+
     const Structure* structure = GetFirstSubnode();
     if (!structure)
     {
@@ -714,6 +753,8 @@ bool ScaleStructure::ValidateSubstructure(const DataDescription* dataDescription
 
 DataResult ScaleStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("ScaleStructure::ProcessData");
+
     const Structure* structure = GetFirstSubnode();
     if (!structure)
     {
@@ -807,6 +848,8 @@ bool MorphWeightStructure::ValidateSubstructure(const DataDescription* dataDescr
 
 DataResult MorphWeightStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("MorphWeightStructure::ProcessData");
+
     const Structure* structure = GetFirstSubnode();
     if (!structure)
     {
@@ -871,6 +914,8 @@ bool NodeStructure::ValidateSubstructure(const DataDescription* dataDescription,
 
 DataResult NodeStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("NodeStructure::ProcessData");
+
     DataResult result = OpenGexStructure::ProcessData(dataDescription);
     if (result != kDataOkay)
     {
@@ -932,10 +977,24 @@ void NodeStructure::CalculateNodeTransforms(const OpenGexDataDescription* dataDe
     dataDescription->AdjustTransform(objectTransform);
 
     inverseObjectTransform = Inverse(objectTransform);
+
+    // Transforms are updated from the top of the hierarchy down, so the parent's world transform is current here.
+
+    const Structure* superNode = GetSuperNode();
+    if ((superNode) && (superNode->GetBaseStructureType() == kStructureNode))
+    {
+        worldTransform = static_cast<const NodeStructure*>(superNode)->worldTransform * nodeTransform;
+    }
+    else
+    {
+        worldTransform = nodeTransform;
+    }
 }
 
 void NodeStructure::UpdateNodeTransforms(const OpenGexDataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("NodeStructure::UpdateNodeTransforms");
+
     CalculateNodeTransforms(dataDescription);
 
     Structure* structure = GetFirstSubnode();
@@ -972,6 +1031,7 @@ GeometryNodeStructure::GeometryNodeStructure() : NodeStructure(kStructureGeometr
 GeometryNodeStructure::~GeometryNodeStructure()
 {
     morphWeightList.clear();
+    morphWeightMap.clear();
 }
 
 bool GeometryNodeStructure::ValidateProperty(const DataDescription* dataDescription, std::string_view identifier, DataType* type, void** value)
@@ -1016,6 +1076,8 @@ bool GeometryNodeStructure::ValidateSubstructure(const DataDescription* dataDesc
 
 DataResult GeometryNodeStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("GeometryNodeStructure::ProcessData");
+
     DataResult result = NodeStructure::ProcessData(dataDescription);
     if (result != kDataOkay)
     {
@@ -1068,7 +1130,9 @@ DataResult GeometryNodeStructure::ProcessData(DataDescription* dataDescription)
         }
         else if (type == kStructureMorphWeight)
         {
-            morphWeightList.push_back(static_cast<MorphWeightStructure*>(structure));
+            MorphWeightStructure* morphWeightStructure = static_cast<MorphWeightStructure*>(structure);
+            morphWeightList.push_back(morphWeightStructure);
+            morphWeightMap.insert({morphWeightStructure->GetMorphIndex(), morphWeightStructure});
         }
 
         structure = structure->GetNextSubnode();
@@ -1106,6 +1170,7 @@ DataResult GeometryNodeStructure::ProcessData(DataDescription* dataDescription)
 
     // Do application-specific node processing here.
 
+    static_cast<OpenGexDataDescription*>(dataDescription)->AddGeometryNode(this);
     return (kDataOkay);
 }
 
@@ -1114,16 +1179,50 @@ const ObjectStructure* GeometryNodeStructure::GetObjectStructure(void) const
     return (geometryObjectStructure);
 }
 
-const MorphWeightStructure* GeometryNodeStructure::FindMorphWeightStructure(uint32 index) const
+void GeometryNodeStructure::UpdateWorldBounds(void)
 {
-    for (const MorphWeightStructure* morphWeightStructure : morphWeightList)
+    const MeshStructure* meshStructure = geometryObjectStructure->GetBaseMesh();
+    const SkinStructure* skinStructure = meshStructure->GetSkinStructure();
+
+    if ((skinStructure) && (meshStructure->GetBoneBoundsCount() != 0))
     {
-        if (morphWeightStructure->GetMorphIndex() == index)
+        // Skinned vertices are placed by the bones, so the node bounds are the union of the
+        // bone bounds transformed by the current world transform of each bone.
+
+        const BoneNodeStructure* const* boneNodeArray = skinStructure->GetSkeletonStructure()->GetBoneRefArrayStructure()->GetBoneNodeArray();
+        const BoundingBox*              boneBoundsArray = meshStructure->GetBoneBoundsArray();
+        int32                           boneCount = meshStructure->GetBoneBoundsCount();
+
+        worldBoundingBox.Clear();
+        for (machine a = 0; a < boneCount; a++)
+        {
+            if (!boneBoundsArray[a].Empty())
+            {
+                BoundingBox box;
+                TransformBoundingBox(boneNodeArray[a]->GetWorldTransform(), boneBoundsArray[a], &box);
+                UnionBoundingBox(&worldBoundingBox, box);
+            }
+        }
+
+        if (!worldBoundingBox.Empty())
         {
-            return morphWeightStructure;
+            worldBoundingSphere.center = worldBoundingBox.GetCenter();
+            worldBoundingSphere.radius = Magnitude(worldBoundingBox.max - worldBoundingSphere.center);
+            return;
         }
     }
-    return nullptr;
+
+    Transform3D transform = GetWorldTransform() * GetObjectTransform();
+    TransformBoundingBox(transform, meshStructure->GetBoundingBox(), &worldBoundingBox);
+    TransformBoundingSphere(transform, meshStructure->GetBoundingSphere(), &worldBoundingSphere);
+}
+
+const MorphWeightStructure* GeometryNodeStructure::FindMorphWeightStructure(uint32 index) const
+{
+    // When a morph index appears more than once, the first weight is used.
+
+    auto iterator = morphWeightMap.find(index);
+    return ((iterator != morphWeightMap.end()) ? iterator->second : nullptr);
 }
 
 LightNodeStructure::LightNodeStructure() : NodeStructure(kStructureLightNode)
@@ -1164,6 +1263,8 @@ bool LightNodeStructure::ValidateSubstructure(const DataDescription* dataDescrip
 
 DataResult LightNodeStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("LightNodeStructure::ProcessData");
+
     DataResult result = NodeStructure::ProcessData(dataDescription);
     if (result != kDataOkay)
     {
@@ -1231,6 +1332,8 @@ bool CameraNodeStructure::ValidateSubstructure(const DataDescription* dataDescri
 
 DataResult CameraNodeStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("CameraNodeStructure::ProcessData");
+
     DataResult result = NodeStructure::ProcessData(dataDescription);
     if (result != kDataOkay)
     {
@@ -1332,6 +1435,8 @@ bool VertexArrayStructure::ValidateSubstructure(const DataDescription* dataDescr
 
 DataResult VertexArrayStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("VertexArrayStructure::ProcessData");
+
     int32        elementCount;
     const float* data;
 
@@ -1487,11 +1592,96 @@ DataResult VertexArrayStructure::ProcessData(DataDescription* dataDescription)
     return (kDataOkay);
 }
 
+float* VertexArrayStructure::AllocateVertexArray(std::string_view attrib, int32 count, int32 components)
+{
+    attribString = attrib;
+    attribIndex = 0;
+    morphIndex = 0;
+    componentCount = components;
+
+    delete[] arrayStorage;
+    delete[] floatStorage;
+    floatStorage = nullptr;
+
+    arrayStorage = new char[count * components * sizeof(float)];
+    vertexArrayData = arrayStorage;
+    vertexCount = count;
+
+    return (reinterpret_cast<float*>(arrayStorage));
+}
+
+void VertexArrayStructure::RemapVertices(int32 count, const uint32* vertexMap)
+{
+    CopyVertexArray(this, count, vertexMap);
+}
+
+void VertexArrayStructure::CopyVertexArray(const VertexArrayStructure* vertexArrayStructure, int32 count, const uint32* vertexMap)
+{
+    // The source can be this structure itself, in which case its old storage is released after the copy.
+
+    attribString = vertexArrayStructure->attribString;
+    attribIndex = vertexArrayStructure->attribIndex;
+    morphIndex = vertexArrayStructure->morphIndex;
+    componentCount = vertexArrayStructure->componentCount;
+
+    const float* inputData = static_cast<const float*>(vertexArrayStructure->vertexArrayData);
+
+    char*  storage = new char[count * componentCount * sizeof(float)];
+    float* outputData = reinterpret_cast<float*>(storage);
+
+    for (machine a = 0; a < count; a++)
+    {
+        const float* input = inputData + vertexMap[a] * componentCount;
+        for (machine k = 0; k < componentCount; k++)
+        {
+            outputData[k] = input[k];
+        }
+
+        outputData += componentCount;
+    }
+
+    delete[] arrayStorage;
+    delete[] floatStorage;
+    floatStorage = nullptr;
+
+    arrayStorage = storage;
+    vertexArrayData = storage;
+    vertexCount = count;
+}
+
+void VertexArrayStructure::AccountMemory(MemoryAccount* account, const MeshStructure* meshStructure) const
+{
+    // The parser data is redundant once the vertices are read from a converted or remapped copy.
+    // Arrays generated while processing have no parser data.
+
+    const void*      parserData = nullptr;
+    const Structure* structure = GetFirstSubnode();
+    if ((structure) && (structure->GetBaseStructureType() == kStructurePrimitive))
+    {
+        parserData = GetPrimitiveData(structure);
+        account->AddParserData(kStructureVertexArray, meshStructure, attribString, GetPrimitiveDataSize(structure), (vertexArrayData != parserData));
+    }
+
+    uint64 size = uint64(vertexCount) * componentCount * sizeof(float);
+    if (floatStorage)
+    {
+        account->AddProcessedData(kStructureVertexArray, meshStructure, attribString, size, false);
+    }
+
+    if (arrayStorage)
+    {
+        bool duplicateFlag = ((parserData) && (structure->GetStructureType() == kDataFloat) && (GetPrimitiveDataSize(structure) == size) && (memcmp(arrayStorage, parserData, size) == 0));
+        account->AddProcessedData(kStructureVertexArray, meshStructure, attribString, size, duplicateFlag);
+    }
+}
+
 IndexArrayStructure::IndexArrayStructure() : OpenGexStructure(kStructureIndexArray)
 {
     materialIndex = 0;
     restartIndex = 0;
     frontFace = "ccw";
+    indexCount = 0;
+    indexSize = 0;
     arrayStorage = nullptr;
     indexArrayData = nullptr;
 }
@@ -1540,6 +1730,8 @@ bool IndexArrayStructure::ValidateSubstructure(const DataDescription* dataDescri
 
 DataResult IndexArrayStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("IndexArrayStructure::ProcessData");
+
     const Structure* structure = GetFirstSubnode();
     if (!structure)
     {
@@ -1567,6 +1759,7 @@ DataResult IndexArrayStructure::ProcessData(DataDescription* dataDescription)
 
         const uint32_t* inputData = &dataStructure->GetDataElement(0);
         uint32_t*       outputData = new uint32_t[indexCount];
+        indexSize = sizeof(uint32_t);
         arrayStorage = reinterpret_cast<char*>(outputData);
         indexArrayData = arrayStorage;
 
@@ -1581,6 +1774,7 @@ DataResult IndexArrayStructure::ProcessData(DataDescription* dataDescription)
         indexCount = dataStructure->GetDataElementCount();
         const uint16_t* inputData = &dataStructure->GetDataElement(0);
         uint16_t*       outputData = new uint16_t[indexCount];
+        indexSize = sizeof(uint16_t);
         arrayStorage = reinterpret_cast<char*>(outputData);
         indexArrayData = arrayStorage;
         for (size_t i = 0; std::cmp_less(i, indexCount); ++i)
@@ -1594,6 +1788,7 @@ DataResult IndexArrayStructure::ProcessData(DataDescription* dataDescription)
         indexCount = dataStructure->GetDataElementCount();
         const uint8_t* inputData = &dataStructure->GetDataElement(0);
         uint8_t*       outputData = new uint8_t[indexCount];
+        indexSize = sizeof(uint8_t);
         arrayStorage = reinterpret_cast<char*>(outputData);
         indexArrayData = arrayStorage;
         for (size_t i = 0; std::cmp_less(i, indexCount); ++i)
@@ -1607,6 +1802,7 @@ DataResult IndexArrayStructure::ProcessData(DataDescription* dataDescription)
         indexCount = dataStructure->GetDataElementCount();
         const uint64_t* inputData = &dataStructure->GetDataElement(0);
         uint64_t*       outputData = new uint64_t[indexCount];
+        indexSize = sizeof(uint64_t);
         arrayStorage = reinterpret_cast<char*>(outputData);
         indexArrayData = arrayStorage;
         for (size_t i = 0; std::cmp_less(i, indexCount); ++i)
@@ -1620,6 +1816,215 @@ DataResult IndexArrayStructure::ProcessData(DataDescription* dataDescription)
     return (kDataOkay);
 }
 
+void IndexArrayStructure::ReadIndexArray(uint32* indexArray) const
+{
+    if (indexSize == 4)
+    {
+        const uint32* data = static_cast<const uint32*>(indexArrayData);
+        for (machine a = 0; a < indexCount; a++)
+        {
+            indexArray[a] = data[a];
+        }
+    }
+    else if (indexSize == 2)
+    {
+        const uint16* data = static_cast<const uint16*>(indexArrayData);
+        for (machine a = 0; a < indexCount; a++)
+        {
+            indexArray[a] = data[a];
+        }
+    }
+    else if (indexSize == 1)
+    {
+        const uint8* data = static_cast<const uint8*>(indexArrayData);
+        for (machine a = 0; a < indexCount; a++)
+        {
+            indexArray[a] = data[a];
+        }
+    }
+    else
+    {
+        // Values that don't fit in 32 bits are rejected by the mesh processing that calls this function.
+
+        const uint64* data = static_cast<const uint64*>(indexArrayData);
+        for (machine a = 0; a < indexCount; a++)
+        {
+            indexArray[a] = uint32(Min(data[a], uint64(0xFFFFFFFF)));
+        }
+    }
+}
+
+void IndexArrayStructure::WriteIndexArray(const uint32* indexArray)
+{
+    // The index array is always stored in processed storage, so it can be rewritten in its original format.
+    // If the new indices don't fit in that format, as when vertices are renumbered across the whole mesh,
+    // the storage is widened instead of truncating them.
+
+    if (indexSize < 4)
+    {
+        uint32 maxIndex = CalculateMaxIndex(indexArray, indexCount);
+        int32  size = (maxIndex < 256) ? 1 : ((maxIndex < 65536) ? 2 : 4);
+        if (size > indexSize)
+        {
+            delete[] arrayStorage;
+            arrayStorage = new char[indexCount * size];
+            indexArrayData = arrayStorage;
+            indexSize = size;
+        }
+    }
+
+    if (indexSize == 4)
+    {
+        uint32* data = reinterpret_cast<uint32*>(arrayStorage);
+        for (machine a = 0; a < indexCount; a++)
+        {
+            data[a] = indexArray[a];
+        }
+    }
+    else if (indexSize == 2)
+    {
+        uint16* data = reinterpret_cast<uint16*>(arrayStorage);
+        for (machine a = 0; a < indexCount; a++)
+        {
+            data[a] = uint16(indexArray[a]);
+        }
+    }
+    else if (indexSize == 1)
+    {
+        uint8* data = reinterpret_cast<uint8*>(arrayStorage);
+        for (machine a = 0; a < indexCount; a++)
+        {
+            data[a] = uint8(indexArray[a]);
+        }
+    }
+    else
+    {
+        uint64* data = reinterpret_cast<uint64*>(arrayStorage);
+        for (machine a = 0; a < indexCount; a++)
+        {
+            data[a] = indexArray[a];
+        }
+    }
+}
+
+void IndexArrayStructure::NarrowIndexArray(int32 vertexCount, int32 minIndexSize)
+{
+    if ((restartIndex != 0) || (indexCount == 0) || (indexSize <= minIndexSize))
+    {
+        // The restart value is tied to the original width, so those arrays are left alone.
+        return;
+    }
+
+    const uint32* inputData = nullptr;
+    uint32*       tempStorage = nullptr;
+
+    if (indexSize == 4)
+    {
+        inputData = static_cast<const uint32*>(indexArrayData);
+    }
+    else
+    {
+        if (indexSize == 8)
+        {
+            // ReadIndexArray() clamps 64-bit values, so they are checked here first. An array holding
+            // an index that doesn't fit in 32 bits is left alone.
+
+            const uint64* data = static_cast<const uint64*>(indexArrayData);
+            for (machine a = 0; a < indexCount; a++)
+            {
+                if (data[a] > 0xFFFFFFFF)
+                {
+                    return;
+                }
+            }
+        }
+
+        tempStorage = new uint32[indexCount];
+        ReadIndexArray(tempStorage);
+        inputData = tempStorage;
+    }
+
+    // The width is chosen from the vertex count, but an out-of-range index must never be truncated.
+
+    uint32 maxIndex = Max(CalculateMaxIndex(inputData, indexCount), uint32(MaxZero(vertexCount - 1)));
+
+    int32 size = 4;
+    if (maxIndex < 256)
+    {
+        size = 1;
+    }
+    else if (maxIndex < 65536)
+    {
+        size = 2;
+    }
+
+    size = Max(size, minIndexSize);
+    if (size < indexSize)
+    {
+        char* storage = new char[indexCount * size];
+
+        if (size == 1)
+        {
+            ConvertIndexArray(inputData, indexCount, reinterpret_cast<uint8*>(storage));
+        }
+        else if (size == 2)
+        {
+            ConvertIndexArray(inputData, indexCount, reinterpret_cast<uint16*>(storage));
+        }
+        else
+        {
+            uint32* outputData = reinterpret_cast<uint32*>(storage);
+            for (machine a = 0; a < indexCount; a++)
+            {
+                outputData[a] = inputData[a];
+            }
+        }
+
+        delete[] arrayStorage;
+        arrayStorage = storage;
+        indexArrayData = storage;
+        indexSize = size;
+    }
+
+    delete[] tempStorage;
+}
+
+void IndexArrayStructure::CopyIndexArray(const IndexArrayStructure* indexArrayStructure, int32 count, const uint32* indexArray)
+{
+    materialIndex = indexArrayStructure->materialIndex;
+    restartIndex = 0;
+    frontFace = indexArrayStructure->frontFace;
+
+    delete[] arrayStorage;
+    arrayStorage = new char[count * 4];
+    indexArrayData = arrayStorage;
+    indexCount = count;
+    indexSize = 4;
+
+    WriteIndexArray(indexArray);
+}
+
+void IndexArrayStructure::AccountMemory(MemoryAccount* account, const MeshStructure* meshStructure) const
+{
+    const void*      parserData = nullptr;
+    uint64           parserSize = 0;
+    const Structure* structure = GetFirstSubnode();
+    if ((structure) && (structure->GetBaseStructureType() == kStructurePrimitive))
+    {
+        parserData = GetPrimitiveData(structure);
+        parserSize = GetPrimitiveDataSize(structure);
+        account->AddParserData(kStructureIndexArray, meshStructure, "index", parserSize, (indexArrayData != parserData));
+    }
+
+    if (arrayStorage)
+    {
+        // Indices are always copied, so the copy is a duplicate unless it was converted to a different size.
+
+        uint64 size = uint64(indexCount) * indexSize;
+        account->AddProcessedData(kStructureIndexArray, meshStructure, "index", size, ((parserData) && (parserSize == size) && (memcmp(arrayStorage, parserData, size) == 0)));
+    }
+}
+
 BoneRefArrayStructure::BoneRefArrayStructure() : OpenGexStructure(kStructureBoneRefArray)
 {
     boneNodeArray = nullptr;
@@ -1642,6 +2047,8 @@ bool BoneRefArrayStructure::ValidateSubstructure(const DataDescription* dataDesc
 
 DataResult BoneRefArrayStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("BoneRefArrayStructure::ProcessData");
+
     const Structure* structure = GetFirstSubnode();
     if (!structure)
     {
@@ -1660,10 +2067,11 @@ DataResult BoneRefArrayStructure::ProcessData(DataDescription* dataDescription)
     {
         boneNodeArray = new const BoneNodeStructure*[boneCount];
 
+        const NameIndex* nameIndex = static_cast<OpenGexDataDescription*>(dataDescription)->GetNameIndex();
         for (machine a = 0; a < boneCount; a++)
         {
             const StructureRef& reference = dataStructure->GetDataElement(a);
-            const Structure*    boneStructure = dataDescription->FindStructure(reference);
+            const Structure*    boneStructure = nameIndex->FindStructure(reference);
             if (!boneStructure)
             {
                 return (kDataBrokenReference);
@@ -1681,6 +2089,20 @@ DataResult BoneRefArrayStructure::ProcessData(DataDescription* dataDescription)
     return (kDataOkay);
 }
 
+void BoneRefArrayStructure::AccountMemory(MemoryAccount* account, const MeshStructure* meshStructure) const
+{
+    const Structure* structure = GetFirstSubnode();
+    if ((structure) && (structure->GetBaseStructureType() == kStructurePrimitive))
+    {
+        account->AddParserData(kStructureBoneRefArray, meshStructure, "bone reference", GetPrimitiveDataSize(structure), false);
+    }
+
+    if (boneNodeArray)
+    {
+        account->AddProcessedData(kStructureBoneRefArray, meshStructure, "bone reference", uint64(boneCount) * sizeof(const BoneNodeStructure*), false);
+    }
+}
+
 BoneCountArrayStructure::BoneCountArrayStructure() : OpenGexStructure(kStructureBoneCountArray)
 {
     arrayStorage = nullptr;
@@ -1704,6 +2126,8 @@ bool BoneCountArrayStructure::ValidateSubstructure(const DataDescription* dataDe
 
 DataResult BoneCountArrayStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("BoneCountArrayStructure::ProcessData");
+
     const Structure* structure = GetFirstSubnode();
     if (!structure)
     {
@@ -1788,6 +2212,31 @@ DataResult BoneCountArrayStructure::ProcessData(DataDescription* dataDescription
     return (kDataOkay);
 }
 
+void BoneCountArrayStructure::SetBoneCountArray(int32 count, uint16* array)
+{
+    delete[] arrayStorage;
+
+    vertexCount = count;
+    boneCountArray = array;
+    arrayStorage = array;
+}
+
+void BoneCountArrayStructure::AccountMemory(MemoryAccount* account, const MeshStructure* meshStructure) const
+{
+    const void*      parserData = nullptr;
+    const Structure* structure = GetFirstSubnode();
+    if ((structure) && (structure->GetBaseStructureType() == kStructurePrimitive))
+    {
+        parserData = GetPrimitiveData(structure);
+        account->AddParserData(kStructureBoneCountArray, meshStructure, "bone count", GetPrimitiveDataSize(structure), (boneCountArray != parserData));
+    }
+
+    if (arrayStorage)
+    {
+        account->AddProcessedData(kStructureBoneCountArray, meshStructure, "bone count", uint64(vertexCount) * sizeof(uint16), false);
+    }
+}
+
 BoneIndexArrayStructure::BoneIndexArrayStructure() : OpenGexStructure(kStructureBoneIndexArray)
 {
     arrayStorage = nullptr;
@@ -1811,6 +2260,8 @@ bool BoneIndexArrayStructure::ValidateSubstructure(const DataDescription* dataDe
 
 DataResult BoneIndexArrayStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("BoneIndexArrayStructure::ProcessData");
+
     const Structure* structure = GetFirstSubnode();
     if (!structure)
     {
@@ -1895,12 +2346,39 @@ DataResult BoneIndexArrayStructure::ProcessData(DataDescription* dataDescription
     return (kDataOkay);
 }
 
+void BoneIndexArrayStructure::SetBoneIndexArray(int32 count, uint16* array)
+{
+    delete[] arrayStorage;
+
+    boneIndexCount = count;
+    boneIndexArray = array;
+    arrayStorage = array;
+}
+
+void BoneIndexArrayStructure::AccountMemory(MemoryAccount* account, const MeshStructure* meshStructure) const
+{
+    const void*      parserData = nullptr;
+    const Structure* structure = GetFirstSubnode();
+    if ((structure) && (structure->GetBaseStructureType() == kStructurePrimitive))
+    {
+        parserData = GetPrimitiveData(structure);
+        account->AddParserData(kStructureBoneIndexArray, meshStructure, "bone index", GetPrimitiveDataSize(structure), (boneIndexArray != parserData));
+    }
+
+    if (arrayStorage)
+    {
+        account->AddProcessedData(kStructureBoneIndexArray, meshStructure, "bone index", uint64(boneIndexCount) * sizeof(uint16), false);
+    }
+}
+
 BoneWeightArrayStructure::BoneWeightArrayStructure() : OpenGexStructure(kStructureBoneWeightArray)
 {
+    arrayStorage = nullptr;
 }
 
 BoneWeightArrayStructure::~BoneWeightArrayStructure()
 {
+    delete[] arrayStorage;
 }
 
 bool BoneWeightArrayStructure::ValidateSubstructure(const DataDescription* dataDescription, const Structure* structure) const
@@ -1915,6 +2393,8 @@ bool BoneWeightArrayStructure::ValidateSubstructure(const DataDescription* dataD
 
 DataResult BoneWeightArrayStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("BoneWeightArrayStructure::ProcessData");
+
     const Structure* structure = GetFirstSubnode();
     if (!structure)
     {
@@ -1937,17 +2417,42 @@ DataResult BoneWeightArrayStructure::ProcessData(DataDescription* dataDescriptio
     return (kDataOkay);
 }
 
-SkeletonStructure::SkeletonStructure() : OpenGexStructure(kStructureSkeleton)
+void BoneWeightArrayStructure::SetBoneWeightArray(int32 count, float* array)
 {
-}
+    delete[] arrayStorage;
 
-SkeletonStructure::~SkeletonStructure()
-{
+    boneWeightCount = count;
+    boneWeightArray = array;
+    arrayStorage = array;
 }
 
-bool SkeletonStructure::ValidateSubstructure(const DataDescription* dataDescription, const Structure* structure) const
+void BoneWeightArrayStructure::AccountMemory(MemoryAccount* account, const MeshStructure* meshStructure) const
 {
-    StructureType type = structure->GetStructureType();
+    const void*      parserData = nullptr;
+    const Structure* structure = GetFirstSubnode();
+    if ((structure) && (structure->GetBaseStructureType() == kStructurePrimitive))
+    {
+        parserData = GetPrimitiveData(structure);
+        account->AddParserData(kStructureBoneWeightArray, meshStructure, "bone weight", GetPrimitiveDataSize(structure), (boneWeightArray != parserData));
+    }
+
+    if (arrayStorage)
+    {
+        account->AddProcessedData(kStructureBoneWeightArray, meshStructure, "bone weight", uint64(boneWeightCount) * sizeof(float), false);
+    }
+}
+
+SkeletonStructure::SkeletonStructure() : OpenGexStructure(kStructureSkeleton)
+{
+}
+
+SkeletonStructure::~SkeletonStructure()
+{
+}
+
+bool SkeletonStructure::ValidateSubstructure(const DataDescription* dataDescription, const Structure* structure) const
+{
+    StructureType type = structure->GetStructureType();
     if ((type == kStructureBoneRefArray) || (type == kStructureTransform))
     {
         return (true);
@@ -1958,6 +2463,8 @@ bool SkeletonStructure::ValidateSubstructure(const DataDescription* dataDescript
 
 DataResult SkeletonStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("SkeletonStructure::ProcessData");
+
     DataResult result = OpenGexStructure::ProcessData(dataDescription);
     if (result != kDataOkay)
     {
@@ -2000,10 +2507,22 @@ DataResult SkeletonStructure::ProcessData(DataDescription* dataDescription)
 
 SkinStructure::SkinStructure() : OpenGexStructure(kStructureSkin)
 {
+    skeletonStructure = nullptr;
+    boneCountArrayStructure = nullptr;
+    boneIndexArrayStructure = nullptr;
+    boneWeightArrayStructure = nullptr;
+
+    packedStorage = nullptr;
+    packedSkinData.vertexCount = 0;
+    packedSkinData.influenceCount = 0;
+    packedSkinData.paletteCount = 0;
+
+    skeleton = nullptr;
 }
 
 SkinStructure::~SkinStructure()
 {
+    delete[] packedStorage;
 }
 
 bool SkinStructure::ValidateSubstructure(const DataDescription* dataDescription, const Structure* structure) const
@@ -2020,13 +2539,15 @@ bool SkinStructure::ValidateSubstructure(const DataDescription* dataDescription,
 
 DataResult SkinStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("SkinStructure::ProcessData");
+
     DataResult result = OpenGexStructure::ProcessData(dataDescription);
     if (result != kDataOkay)
     {
         return (result);
     }
 
-    const Structure* structure = GetFirstSubstructure(kStructureTransform);
+    Structure* structure = GetFirstSubstructure(kStructureTransform);
     if (structure)
     {
         if (GetLastSubstructure(kStructureTransform) != structure)
@@ -2066,7 +2587,7 @@ DataResult SkinStructure::ProcessData(DataDescription* dataDescription)
         return (kDataExtraneousSubstructure);
     }
 
-    boneCountArrayStructure = static_cast<const BoneCountArrayStructure*>(structure);
+    boneCountArrayStructure = static_cast<BoneCountArrayStructure*>(structure);
 
     structure = GetFirstSubstructure(kStructureBoneIndexArray);
     if (!structure)
@@ -2079,7 +2600,7 @@ DataResult SkinStructure::ProcessData(DataDescription* dataDescription)
         return (kDataExtraneousSubstructure);
     }
 
-    boneIndexArrayStructure = static_cast<const BoneIndexArrayStructure*>(structure);
+    boneIndexArrayStructure = static_cast<BoneIndexArrayStructure*>(structure);
 
     structure = GetFirstSubstructure(kStructureBoneWeightArray);
     if (!structure)
@@ -2092,7 +2613,7 @@ DataResult SkinStructure::ProcessData(DataDescription* dataDescription)
         return (kDataExtraneousSubstructure);
     }
 
-    boneWeightArrayStructure = static_cast<const BoneWeightArrayStructure*>(structure);
+    boneWeightArrayStructure = static_cast<BoneWeightArrayStructure*>(structure);
 
     int32 boneIndexCount = boneIndexArrayStructure->GetBoneIndexCount();
     if (boneWeightArrayStructure->GetBoneWeightCount() != boneIndexCount)
@@ -2120,6 +2641,132 @@ DataResult SkinStructure::ProcessData(DataDescription* dataDescription)
     return (kDataOkay);
 }
 
+void SkinStructure::RemapVertices(int32 count, const uint32* vertexMap)
+{
+    CopySkin(this, count, vertexMap);
+}
+
+void SkinStructure::CopySkin(const SkinStructure* skinStructure, int32 count, const uint32* vertexMap)
+{
+    if (skinStructure != this)
+    {
+        // A copied skin refers to the skeleton of the original skin but owns its own bone arrays.
+
+        skinTransform = skinStructure->skinTransform;
+        skeletonStructure = skinStructure->skeletonStructure;
+
+        boneCountArrayStructure = new BoneCountArrayStructure;
+        boneIndexArrayStructure = new BoneIndexArrayStructure;
+        boneWeightArrayStructure = new BoneWeightArrayStructure;
+
+        AppendSubnode(boneCountArrayStructure);
+        AppendSubnode(boneIndexArrayStructure);
+        AppendSubnode(boneWeightArrayStructure);
+    }
+
+    const BoneCountArrayStructure* countStructure = skinStructure->boneCountArrayStructure;
+    int32                          vertexCount = countStructure->GetVertexCount();
+    const uint16*                  boneCountArray = countStructure->GetBoneCountArray();
+    const uint16*                  boneIndexArray = skinStructure->boneIndexArrayStructure->GetBoneIndexArray();
+    const float*                   boneWeightArray = skinStructure->boneWeightArrayStructure->GetBoneWeightArray();
+
+    // The bone data is variable-length per vertex, so the start of each vertex's influences is needed to gather it.
+
+    int32* offsetArray = new int32[vertexCount];
+    int32  offset = 0;
+    for (machine a = 0; a < vertexCount; a++)
+    {
+        offsetArray[a] = offset;
+        offset += boneCountArray[a];
+    }
+
+    uint16* newCountArray = new uint16[count];
+    int32   influenceCount = 0;
+    for (machine a = 0; a < count; a++)
+    {
+        uint16 boneCount = boneCountArray[vertexMap[a]];
+        newCountArray[a] = boneCount;
+        influenceCount += boneCount;
+    }
+
+    uint16* newIndexArray = new uint16[influenceCount];
+    float*  newWeightArray = new float[influenceCount];
+
+    offset = 0;
+    for (machine a = 0; a < count; a++)
+    {
+        uint32 vertex = vertexMap[a];
+        int32  start = offsetArray[vertex];
+        for (machine k = 0; k < boneCountArray[vertex]; k++)
+        {
+            newIndexArray[offset] = boneIndexArray[start + k];
+            newWeightArray[offset] = boneWeightArray[start + k];
+            offset++;
+        }
+    }
+
+    delete[] offsetArray;
+
+    boneCountArrayStructure->SetBoneCountArray(count, newCountArray);
+    boneIndexArrayStructure->SetBoneIndexArray(influenceCount, newIndexArray);
+    boneWeightArrayStructure->SetBoneWeightArray(influenceCount, newWeightArray);
+}
+
+DataResult SkinStructure::PackInfluences(const SkinPackFormat& format, ThreadPool* threadPool)
+{
+    int32 vertexCount = boneCountArrayStructure->GetVertexCount();
+    int32 boneCount = skeletonStructure->GetBoneRefArrayStructure()->GetBoneCount();
+
+    int32 influenceCount = Min(Max(format.influenceCount, 1), int32(kSkinMaxInfluenceCount));
+    int32 indexSize = (format.indexSize == 1) ? 1 : 2;
+    int32 weightSize = GetSkinWeightSize(format.weightFormat);
+    int32 indexArraySize = vertexCount * influenceCount * indexSize;
+
+    // The weight array is placed first, and the palette and index arrays follow it. The sizes of the weight array and the
+    // palette are rounded up to multiples of 16 bytes so that every array starts on a 16-byte boundary, even when the
+    // weights are 8-bit and the number of influences is odd.
+
+    int32 weightArraySize = (vertexCount * influenceCount * weightSize + 15) & ~15;
+    int32 paletteSize = (Max(boneCount, 1) * int32(sizeof(uint16)) + 15) & ~15;
+
+    char* storage = new char[weightArraySize + paletteSize + indexArraySize];
+
+    PackedSkinData data;
+    data.vertexCount = vertexCount;
+    data.influenceCount = influenceCount;
+    data.indexSize = indexSize;
+    data.weightFormat = format.weightFormat;
+    data.planarFlag = format.planarFlag;
+    data.boneWeightArray = storage;
+    data.paletteArray = reinterpret_cast<uint16*>(storage + weightArraySize);
+    data.boneIndexArray = storage + weightArraySize + paletteSize;
+
+    if (!PackSkinInfluences(boneCountArrayStructure->GetBoneCountArray(), boneIndexArrayStructure->GetBoneIndexArray(), boneWeightArrayStructure->GetBoneWeightArray(), boneCount,
+                            format.compactPaletteFlag, &data, threadPool))
+    {
+        delete[] storage;
+        return (kDataOpenGexBonePaletteUnsupported);
+    }
+
+    delete[] packedStorage;
+    packedStorage = storage;
+    packedSkinData = data;
+
+    return (kDataOkay);
+}
+
+void SkinStructure::AccountMemory(MemoryAccount* account, const MeshStructure* meshStructure) const
+{
+    if (packedStorage)
+    {
+        // The index array is the last of the three packed arrays.
+
+        const PackedSkinData& data = packedSkinData;
+        uint64                size = uint64(static_cast<const char*>(data.boneIndexArray) - packedStorage) + uint64(data.vertexCount) * data.influenceCount * data.indexSize;
+        account->AddProcessedData(kStructureSkin, meshStructure, "packed skin", size, false);
+    }
+}
+
 MorphStructure::MorphStructure() : OpenGexStructure(kStructureMorph)
 {
     // The value of baseFlag indicates whether the base property was actually
@@ -2165,6 +2812,8 @@ bool MorphStructure::ValidateSubstructure(const DataDescription* dataDescription
 
 DataResult MorphStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("MorphStructure::ProcessData");
+
     DataResult result = OpenGexStructure::ProcessData(dataDescription);
     if (result != kDataOkay)
     {
@@ -2196,10 +2845,57 @@ MeshStructure::MeshStructure() : OpenGexStructure(kStructureMesh)
     meshLevel = 0;
 
     skinStructure = nullptr;
+
+    weldStatistics.originalVertexCount = 0;
+    weldStatistics.weldedVertexCount = 0;
+    weldStatistics.weldTime = 0.0F;
+
+    originalCacheStatistics.acmr = 0.0F;
+    originalCacheStatistics.atvr = 0.0F;
+    optimizedCacheStatistics = originalCacheStatistics;
+
+    meshletStorage = nullptr;
+    meshletData.meshletCount = 0;
+    meshletData.vertexCount = 0;
+    meshletData.triangleCount = 0;
+    meshletData.meshletArray = nullptr;
+    meshletData.vertexArray = nullptr;
+    meshletData.triangleArray = nullptr;
+
+    lodError = 0.0F;
+
+    boundingBox.Clear();
+    boundingSphere.center.Set(0.0F, 0.0F, 0.0F);
+    boundingSphere.radius = 0.0F;
+    boneBoundsCount = 0;
+    boneBoundsArray = nullptr;
+
+    morphTargetCount = 0;
+    morphTargetArray = nullptr;
+    morphRunStorage = nullptr;
+    morphDeltaStorage = nullptr;
+
+    morphStatistics.targetCount = 0;
+    morphStatistics.sparseTargetCount = 0;
+    morphStatistics.denseSize = 0;
+    morphStatistics.storedSize = 0;
 }
 
 MeshStructure::~MeshStructure()
 {
+    // Generated meshes that were never attached to a geometry object are still owned here.
+
+    for (MeshStructure* meshStructure : generatedMeshList)
+    {
+        delete meshStructure;
+    }
+
+    delete[] morphDeltaStorage;
+    delete[] morphRunStorage;
+    delete[] morphTargetArray;
+    delete[] boneBoundsArray;
+    delete[] meshletStorage;
+    vertexArrayList.clear();
     indexArrayList.clear();
 }
 
@@ -2224,6 +2920,14 @@ bool MeshStructure::ValidateProperty(const DataDescription* dataDescription, std
 
 bool MeshStructure::ValidateSubstructure(const DataDescription* dataDescription, const Structure* structure) const
 {
+    // Vertex and index arrays make up most of the text, so a cancelled load also stops parsing between them.
+
+    LoadMonitor* loadMonitor = static_cast<const OpenGexDataDescription*>(dataDescription)->GetLoadMonitor();
+    if ((loadMonitor) && (loadMonitor->GetCancelFlag()))
+    {
+        return (false);
+    }
+
     StructureType type = structure->GetStructureType();
     if ((type == kStructureVertexArray) || (type == kStructureIndexArray) || (type == kStructureSkin))
     {
@@ -2235,7 +2939,9 @@ bool MeshStructure::ValidateSubstructure(const DataDescription* dataDescription,
 
 DataResult MeshStructure::ProcessData(DataDescription* dataDescription)
 {
-    DataResult result = Structure::ProcessData(dataDescription);
+    OPENGEX_PROFILE_ZONE("MeshStructure::ProcessData");
+
+    DataResult result = (static_cast<OpenGexDataDescription*>(dataDescription)->GetSubstructuresProcessed(this)) ? DataResult(kDataOkay) : Structure::ProcessData(dataDescription);
     if (result != kDataOkay)
     {
         return (result);
@@ -2247,7 +2953,8 @@ DataResult MeshStructure::ProcessData(DataDescription* dataDescription)
         StructureType type = structure->GetStructureType();
         if (type == kStructureVertexArray)
         {
-            const VertexArrayStructure* vertexArrayStructure = static_cast<const VertexArrayStructure*>(structure);
+            VertexArrayStructure* vertexArrayStructure = static_cast<VertexArrayStructure*>(structure);
+            vertexArrayList.push_back(vertexArrayStructure);
 
             // Process vertex array here.
         }
@@ -2274,191 +2981,1577 @@ DataResult MeshStructure::ProcessData(DataDescription* dataDescription)
 
     // Do application-specific mesh processing here.
 
-    return (kDataOkay);
-}
+    OpenGexDataDescription* openGexDataDescription = static_cast<OpenGexDataDescription*>(dataDescription);
+    CalculateBounds(openGexDataDescription);
 
-ObjectStructure::ObjectStructure(StructureType type) : OpenGexStructure(type)
-{
-    SetBaseStructureType(kStructureObject);
+    openGexDataDescription->AddMesh(this);
+    return (kDataOkay);
 }
 
-ObjectStructure::~ObjectStructure()
+void MeshStructure::CalculateBounds(const OpenGexDataDescription* dataDescription)
 {
-}
+    OPENGEX_PROFILE_ZONE("MeshStructure::CalculateBounds");
 
-GeometryObjectStructure::GeometryObjectStructure() : ObjectStructure(kStructureGeometryObject)
-{
-    visibleFlag = true;
-    shadowFlag = true;
-    motionBlurFlag = true;
-}
+    // The bounds enclose the base positions and all morph target positions.
 
-GeometryObjectStructure::~GeometryObjectStructure()
-{
-    meshMap.clear();
-}
+    boundingBox.Clear();
+    for (const VertexArrayStructure* vertexArrayStructure : vertexArrayList)
+    {
+        if ((vertexArrayStructure->GetAttribString() == "position") && (vertexArrayStructure->GetComponentCount() >= 3))
+        {
+            const float* positionArray = static_cast<const float*>(vertexArrayStructure->GetVertexArrayData());
+            ExpandBoundingBox(&boundingBox, positionArray, vertexArrayStructure->GetComponentCount(), vertexArrayStructure->GetVertexCount());
+        }
+    }
 
-bool GeometryObjectStructure::ValidateProperty(const DataDescription* dataDescription, std::string_view identifier, DataType* type, void** value)
-{
-    if (identifier == "visible")
+    if (boundingBox.Empty())
     {
-        *type = kDataBool;
-        *value = &visibleFlag;
-        return (true);
+        return;
     }
 
-    if (identifier == "shadow")
+    Point3D center = boundingBox.GetCenter();
+    float   radius = 0.0F;
+
+    for (const VertexArrayStructure* vertexArrayStructure : vertexArrayList)
     {
-        *type = kDataBool;
-        *value = &shadowFlag;
-        return (true);
+        if ((vertexArrayStructure->GetAttribString() == "position") && (vertexArrayStructure->GetComponentCount() >= 3))
+        {
+            const float* positionArray = static_cast<const float*>(vertexArrayStructure->GetVertexArrayData());
+            radius = Fmax(radius, CalculateMaxSquaredDistance(center, positionArray, vertexArrayStructure->GetComponentCount(), vertexArrayStructure->GetVertexCount()));
+        }
     }
 
-    if (identifier == "motion_blur")
+    boundingSphere.center = center;
+    boundingSphere.radius = Sqrt(radius);
+
+    if (!skinStructure)
     {
-        *type = kDataBool;
-        *value = &motionBlurFlag;
-        return (true);
+        return;
     }
 
-    return (false);
-}
+    // Each influenced vertex is moved into the space of the bone at bind time. The bind pose transforms
+    // are stored unadjusted, so they are brought into the same space as the positions first.
 
-bool GeometryObjectStructure::ValidateSubstructure(const DataDescription* dataDescription, const Structure* structure) const
-{
-    StructureType type = structure->GetStructureType();
-    if ((type == kStructureMesh) || (type == kStructureMorph))
+    const TransformStructure* transformStructure = skinStructure->GetSkeletonStructure()->GetTransformStructure();
+    int32                     boneCount = transformStructure->GetTransformCount();
+
+    Transform3D* boneTransform = new Transform3D[boneCount];
+    for (machine a = 0; a < boneCount; a++)
     {
-        return (true);
+        Transform3D bindTransform = transformStructure->GetTransform(int32(a));
+        dataDescription->AdjustTransform(bindTransform);
+        boneTransform[a] = Inverse(bindTransform) * skinStructure->GetSkinTransform();
     }
 
-    return (OpenGexStructure::ValidateSubstructure(dataDescription, structure));
-}
+    delete[] boneBoundsArray;
+    boneBoundsArray = new BoundingBox[boneCount];
+    boneBoundsCount = boneCount;
 
-DataResult GeometryObjectStructure::ProcessData(DataDescription* dataDescription)
-{
-    DataResult result = OpenGexStructure::ProcessData(dataDescription);
-    if (result != kDataOkay)
+    for (machine a = 0; a < boneCount; a++)
     {
-        return (result);
+        boneBoundsArray[a].Clear();
     }
 
-    int32 meshCount = 0;
-    int32 skinCount = 0;
+    const BoneCountArrayStructure* boneCountArrayStructure = skinStructure->GetBoneCountArrayStructure();
+    const uint16*                  boneCountArray = boneCountArrayStructure->GetBoneCountArray();
+    const uint16*                  boneIndexArray = skinStructure->GetBoneIndexArrayStructure()->GetBoneIndexArray();
+    const float*                   boneWeightArray = skinStructure->GetBoneWeightArrayStructure()->GetBoneWeightArray();
 
-    Structure* structure = GetFirstSubnode();
-    while (structure)
+    for (const VertexArrayStructure* vertexArrayStructure : vertexArrayList)
     {
-        StructureType type = structure->GetStructureType();
-        if (type == kStructureMesh)
+        if ((vertexArrayStructure->GetAttribString() == "position") && (vertexArrayStructure->GetComponentCount() >= 3))
         {
-            MeshStructure* meshStructure = static_cast<MeshStructure*>(structure);
-            auto           it = meshMap.insert({meshStructure->GetKey(), meshStructure});
-            if (!it.second)
-            {
-                return (kDataOpenGexDuplicateLod);
-            }
+            const float* positionArray = static_cast<const float*>(vertexArrayStructure->GetVertexArrayData());
+            int32        positionStride = vertexArrayStructure->GetComponentCount();
+            int32        vertexCount = Min(vertexArrayStructure->GetVertexCount(), boneCountArrayStructure->GetVertexCount());
 
-            meshCount++;
-            skinCount += (meshStructure->GetSkinStructure() != nullptr);
-        }
-        else if (type == kStructureMorph)
-        {
-            MorphStructure* morphStructure = static_cast<MorphStructure*>(structure);
-            auto            it = morphMap.insert({morphStructure->GetKey(), morphStructure});
-            if (!it.second)
+            int32 influence = 0;
+            for (machine a = 0; a < vertexCount; a++)
             {
-                return (kDataOpenGexDuplicateMorph);
+                const float* p = positionArray + a * positionStride;
+                Point3D      position(p[0], p[1], p[2]);
+
+                int32 count = boneCountArray[a];
+                for (machine k = 0; k < count; k++)
+                {
+                    uint32 bone = boneIndexArray[influence + k];
+                    if ((bone < uint32(boneCount)) && (boneWeightArray[influence + k] > 0.0F))
+                    {
+                        boneBoundsArray[bone].Expand(boneTransform[bone] * position);
+                    }
+                }
+
+                influence += count;
             }
         }
-
-        structure = structure->GetNextSubnode();
     }
 
-    if (meshCount == 0)
-    {
-        return (kDataMissingSubstructure);
-    }
+    delete[] boneTransform;
+}
 
-    if ((skinCount != 0) && (skinCount != meshCount))
-    {
-        return (kDataOpenGexMissingLodSkin);
-    }
+void MeshStructure::CopyBounds(const MeshStructure* meshStructure)
+{
+    boundingBox = meshStructure->boundingBox;
+    boundingSphere = meshStructure->boundingSphere;
 
-    // Do application-specific object processing here.
+    int32 boneCount = meshStructure->boneBoundsCount;
+    if (boneCount != 0)
+    {
+        boneBoundsArray = new BoundingBox[boneCount];
+        boneBoundsCount = boneCount;
 
-    return (kDataOkay);
+        for (machine a = 0; a < boneCount; a++)
+        {
+            boneBoundsArray[a] = meshStructure->boneBoundsArray[a];
+        }
+    }
 }
 
-LightObjectStructure::LightObjectStructure() : ObjectStructure(kStructureLightObject)
+const VertexArrayStructure* MeshStructure::FindVertexArray(std::string_view attrib, uint32 index, uint32 morph) const
 {
-    shadowFlag = true;
+    for (const VertexArrayStructure* vertexArrayStructure : vertexArrayList)
+    {
+        if ((vertexArrayStructure->GetAttribString() == attrib) && (vertexArrayStructure->GetAttribIndex() == index) && (vertexArrayStructure->GetMorphIndex() == morph))
+        {
+            return (vertexArrayStructure);
+        }
+    }
+
+    return (nullptr);
 }
 
-LightObjectStructure::~LightObjectStructure()
+int32 MeshStructure::GetVertexCount(void) const
 {
+    const VertexArrayStructure* positionArrayStructure = FindVertexArray("position");
+    return ((positionArrayStructure) ? positionArrayStructure->GetVertexCount() : 0);
 }
 
-bool LightObjectStructure::ValidateProperty(const DataDescription* dataDescription, std::string_view identifier, DataType* type, void** value)
+bool MeshStructure::SkinVertices(const Transform3D* paletteArray, int32 paletteCount, float* positionArray, float* normalArray, float* tangentArray, ThreadPool* threadPool, int32 method) const
 {
-    if (identifier == "type")
+    if (!skinStructure)
     {
-        *type = kDataString;
-        *value = &typeString;
-        return (true);
+        return (false);
     }
 
-    if (identifier == "shadow")
+    int32 vertexCount = skinStructure->GetBoneCountArrayStructure()->GetVertexCount();
+
+    SkinningStream stream[3];
+    const char*    attrib[3] = {"position", "normal", "tangent"};
+    float*         outputArray[3] = {positionArray, normalArray, tangentArray};
+
+    for (machine a = 0; a < 3; a++)
     {
-        *type = kDataBool;
-        *value = &shadowFlag;
-        return (true);
+        stream[a].inputArray = nullptr;
+        stream[a].inputStride = 0;
+        stream[a].outputArray = outputArray[a];
+
+        const VertexArrayStructure* vertexArrayStructure = FindVertexArray(attrib[a]);
+        if ((outputArray[a]) && (vertexArrayStructure) && (vertexArrayStructure->GetComponentCount() >= 3))
+        {
+            if (vertexArrayStructure->GetVertexCount() != vertexCount)
+            {
+                return (false);
+            }
+
+            stream[a].inputArray = static_cast<const float*>(vertexArrayStructure->GetVertexArrayData());
+            stream[a].inputStride = vertexArrayStructure->GetComponentCount();
+        }
     }
 
-    return (false);
-}
+    const uint16* boneCountArray = skinStructure->GetBoneCountArrayStructure()->GetBoneCountArray();
+    const uint16* boneIndexArray = skinStructure->GetBoneIndexArrayStructure()->GetBoneIndexArray();
+    const float*  boneWeightArray = skinStructure->GetBoneWeightArrayStructure()->GetBoneWeightArray();
 
-bool LightObjectStructure::ValidateSubstructure(const DataDescription* dataDescription, const Structure* structure) const
-{
-    if ((structure->GetBaseStructureType() == kStructureAttrib) || (structure->GetStructureType() == kStructureAtten))
+    if (method == kSkinningDualQuaternion)
     {
-        return (true);
+        SkinVerticesDualQuaternion(paletteArray, paletteCount, boneCountArray, boneIndexArray, boneWeightArray, vertexCount, stream[0], stream[1], stream[2], threadPool);
+    }
+    else
+    {
+        OpenGEX::SkinVertices(paletteArray, paletteCount, boneCountArray, boneIndexArray, boneWeightArray, vertexCount, stream[0], stream[1], stream[2], threadPool);
     }
 
-    return (OpenGexStructure::ValidateSubstructure(dataDescription, structure));
+    return (true);
 }
 
-DataResult LightObjectStructure::ProcessData(DataDescription* dataDescription)
+void MeshStructure::BuildMorphTargets(const OpenGexDataDescription* dataDescription)
 {
-    DataResult result = OpenGexStructure::ProcessData(dataDescription);
-    if (result != kDataOkay)
-    {
-        return (result);
-    }
+    OPENGEX_PROFILE_ZONE("MeshStructure::BuildMorphTargets");
 
-    if (typeString == "infinite")
+    delete[] morphDeltaStorage;
+    delete[] morphRunStorage;
+    delete[] morphTargetArray;
+    morphTargetCount = 0;
+    morphTargetArray = nullptr;
+    morphRunStorage = nullptr;
+    morphDeltaStorage = nullptr;
+
+    morphStatistics.targetCount = 0;
+    morphStatistics.sparseTargetCount = 0;
+    morphStatistics.denseSize = 0;
+    morphStatistics.storedSize = 0;
+
+    int32 vertexCount = GetVertexCount();
+    if (vertexCount == 0)
     {
-        // Prepare to handle infinite light here.
+        return;
     }
-    else if (typeString == "point")
+
+    // Every morph index other than zero that has positions or normals becomes a target.
+
+    std::list<uint32> morphIndexList;
+    for (const VertexArrayStructure* vertexArrayStructure : vertexArrayList)
     {
-        // Prepare to handle point light here.
+        uint32 morph = vertexArrayStructure->GetMorphIndex();
+        if ((morph != 0) && (vertexArrayStructure->GetAttribIndex() == 0) && (vertexArrayStructure->GetComponentCount() >= 3) && (vertexArrayStructure->GetVertexCount() == vertexCount))
+        {
+            const std::string& attrib = vertexArrayStructure->GetAttribString();
+            if (((attrib == "position") || (attrib == "normal")) && (std::find(morphIndexList.begin(), morphIndexList.end(), morph) == morphIndexList.end()))
+            {
+                morphIndexList.push_back(morph);
+            }
+        }
     }
-    else if (typeString == "spot")
+
+    if (morphIndexList.empty())
     {
-        // Prepare to handle spot light here.
+        return;
     }
-    else
+
+    const std::unordered_map<MorphStructure::KeyType, MorphStructure*>* morphMap = nullptr;
+    const Structure*                                                     superNode = GetSuperNode();
+    if ((superNode) && (superNode->GetStructureType() == kStructureGeometryObject))
     {
-        return (kDataOpenGexUndefinedLightType);
+        morphMap = static_cast<const GeometryObjectStructure*>(superNode)->GetMorphMap();
     }
 
-    const Structure* structure = GetFirstSubnode();
-    while (structure)
-    {
-        StructureType type = structure->GetStructureType();
-        if (type == kStructureColor)
-        {
+    morphTargetCount = int32(morphIndexList.size());
+    morphTargetArray = new MorphTarget[morphTargetCount];
+
+    // Dense deltas are calculated one target at a time in scratch space. The first pass decides which targets
+    // are stored sparsely and how much space they need, and the second pass fills in the final storage.
+
+    float*        scratchStorage = new float[vertexCount * 6];
+    float*        positionScratch = scratchStorage;
+    float*        normalScratch = scratchStorage + vertexCount * 3;
+    const float** baseArray = new const float*[morphTargetCount * 4];
+    int32*        baseStride = new int32[morphTargetCount * 4];
+    int32*        storedVertexCount = new int32[morphTargetCount];
+
+    float sparseThreshold = dataDescription->GetMorphSparseThreshold();
+    int32 totalRunCount = 0;
+    int32 totalDeltaCount = 0;
+
+    auto calculateDeltas = [&](machine targetIndex) -> void {
+        const MorphTarget& target = morphTargetArray[targetIndex];
+        for (machine k = 0; k < 2; k++)
+        {
+            const float* targetArray = baseArray[targetIndex * 4 + k * 2];
+            const float* sourceArray = baseArray[targetIndex * 4 + k * 2 + 1];
+            if (((k == 0) ? target.positionDeltaArray : target.normalDeltaArray) == nullptr)
+            {
+                continue;
+            }
+
+            int32  targetStride = baseStride[targetIndex * 4 + k * 2];
+            int32  sourceStride = baseStride[targetIndex * 4 + k * 2 + 1];
+            float* delta = (k == 0) ? positionScratch : normalScratch;
+
+            for (machine a = 0; a < vertexCount; a++)
+            {
+                delta[a * 3] = targetArray[a * targetStride] - sourceArray[a * sourceStride];
+                delta[a * 3 + 1] = targetArray[a * targetStride + 1] - sourceArray[a * sourceStride + 1];
+                delta[a * 3 + 2] = targetArray[a * targetStride + 2] - sourceArray[a * sourceStride + 2];
+            }
+        }
+    };
+
+    machine targetIndex = 0;
+    for (uint32 morph : morphIndexList)
+    {
+        // A target is relative to the morph named by its base property. Without one, it is an absolute target,
+        // and its deltas are taken from morph 0. The weight of morph 0 is accounted for when targets are blended.
+
+        uint32 baseMorph = 0;
+        bool   absoluteFlag = true;
+        if (morphMap)
+        {
+            auto iterator = morphMap->find(morph);
+            if ((iterator != morphMap->end()) && (iterator->second->GetBaseFlag()))
+            {
+                baseMorph = iterator->second->GetBaseIndex();
+                absoluteFlag = false;
+            }
+        }
+
+        MorphTarget* target = &morphTargetArray[targetIndex];
+        target->morphIndex = morph;
+        target->absoluteFlag = absoluteFlag;
+        target->runCount = 0;
+        target->runArray = nullptr;
+        target->positionDeltaArray = nullptr;
+        target->normalDeltaArray = nullptr;
+
+        int32 attribCount = 0;
+        for (machine k = 0; k < 2; k++)
+        {
+            const char*                 attrib = (k == 0) ? "position" : "normal";
+            const VertexArrayStructure* targetArrayStructure = FindVertexArray(attrib, 0, morph);
+            const VertexArrayStructure* baseArrayStructure = FindVertexArray(attrib, 0, baseMorph);
+            if ((!baseArrayStructure) || (baseArrayStructure->GetVertexCount() != vertexCount) || (baseArrayStructure->GetComponentCount() < 3))
+            {
+                baseArrayStructure = FindVertexArray(attrib);
+            }
+
+            if ((!targetArrayStructure) || (targetArrayStructure->GetVertexCount() != vertexCount) || (targetArrayStructure->GetComponentCount() < 3) || (!baseArrayStructure) ||
+                (baseArrayStructure->GetVertexCount() != vertexCount) || (baseArrayStructure->GetComponentCount() < 3))
+            {
+                continue;
+            }
+
+            baseArray[targetIndex * 4 + k * 2] = static_cast<const float*>(targetArrayStructure->GetVertexArrayData());
+            baseArray[targetIndex * 4 + k * 2 + 1] = static_cast<const float*>(baseArrayStructure->GetVertexArrayData());
+            baseStride[targetIndex * 4 + k * 2] = targetArrayStructure->GetComponentCount();
+            baseStride[targetIndex * 4 + k * 2 + 1] = baseArrayStructure->GetComponentCount();
+
+            // Mark the attribute as present until the final location is known.
+
+            ((k == 0) ? target->positionDeltaArray : target->normalDeltaArray) = (k == 0) ? positionScratch : normalScratch;
+            attribCount++;
+        }
+
+        calculateDeltas(targetIndex);
+
+        int32 vertexTotal = 0;
+        int32 runCount = FindMorphRuns(target->positionDeltaArray, target->normalDeltaArray, vertexCount, nullptr, &vertexTotal);
+        if (float(vertexTotal) <= float(vertexCount) * sparseThreshold)
+        {
+            target->runCount = runCount;
+            storedVertexCount[targetIndex] = vertexTotal;
+            totalRunCount += runCount;
+            morphStatistics.sparseTargetCount++;
+        }
+        else
+        {
+            storedVertexCount[targetIndex] = vertexCount;
+        }
+
+        // A target that changes nothing keeps no deltas, since its run count of zero would otherwise mark it as dense.
+
+        if ((target->runCount == 0) && (storedVertexCount[targetIndex] == 0))
+        {
+            target->positionDeltaArray = nullptr;
+            target->normalDeltaArray = nullptr;
+        }
+
+        totalDeltaCount += storedVertexCount[targetIndex] * attribCount;
+        morphStatistics.denseSize += uint32(vertexCount * attribCount * 3 * sizeof(float));
+        targetIndex++;
+    }
+
+    morphRunStorage = new MorphRun[Max(totalRunCount, 1)];
+    morphDeltaStorage = new float[Max(totalDeltaCount * 3, 1)];
+
+    MorphRun* run = morphRunStorage;
+    float*    delta = morphDeltaStorage;
+
+    for (machine a = 0; a < morphTargetCount; a++)
+    {
+        MorphTarget* target = &morphTargetArray[a];
+        if ((!target->positionDeltaArray) && (!target->normalDeltaArray))
+        {
+            continue;
+        }
+
+        calculateDeltas(a);
+
+        int32 storedCount = storedVertexCount[a];
+        if (target->runCount != 0)
+        {
+            int32 vertexTotal = 0;
+            FindMorphRuns(target->positionDeltaArray, target->normalDeltaArray, vertexCount, run, &vertexTotal);
+            target->runArray = run;
+            run += target->runCount;
+        }
+
+        for (machine k = 0; k < 2; k++)
+        {
+            const float*& deltaArray = (k == 0) ? target->positionDeltaArray : target->normalDeltaArray;
+            if (!deltaArray)
+            {
+                continue;
+            }
+
+            if (target->runCount != 0)
+            {
+                CompactMorphDeltas(deltaArray, target->runArray, target->runCount, delta);
+            }
+            else
+            {
+                for (machine i = 0; i < vertexCount * 3; i++)
+                {
+                    delta[i] = deltaArray[i];
+                }
+            }
+
+            deltaArray = delta;
+            delta += storedCount * 3;
+        }
+    }
+
+    morphStatistics.targetCount = morphTargetCount;
+    morphStatistics.storedSize = uint32(totalDeltaCount * 3 * sizeof(float) + totalRunCount * sizeof(MorphRun));
+
+    delete[] storedVertexCount;
+    delete[] baseStride;
+    delete[] baseArray;
+    delete[] scratchStorage;
+}
+
+bool MeshStructure::BlendMorphTargets(const GeometryNodeStructure* geometryNodeStructure, float* positionArray, float* normalArray, ThreadPool* threadPool) const
+{
+    int32                       vertexCount = GetVertexCount();
+    const VertexArrayStructure* positionArrayStructure = FindVertexArray("position");
+    if ((vertexCount == 0) || (positionArrayStructure->GetComponentCount() != 3))
+    {
+        return (false);
+    }
+
+    const VertexArrayStructure* normalArrayStructure = FindVertexArray("normal");
+    if ((normalArrayStructure) && ((normalArrayStructure->GetVertexCount() != vertexCount) || (normalArrayStructure->GetComponentCount() != 3)))
+    {
+        normalArrayStructure = nullptr;
+    }
+
+    // Only targets with nonzero weights and stored deltas are passed to the blending function.
+
+    const MorphTarget** targetArray = new const MorphTarget*[Max(morphTargetCount, 1)];
+    float*              weightArray = new float[Max(morphTargetCount, 1)];
+    int32               activeCount = 0;
+    float               absoluteWeight = 0.0F;
+
+    for (machine a = 0; a < morphTargetCount; a++)
+    {
+        const MorphTarget&          target = morphTargetArray[a];
+        const MorphWeightStructure* morphWeightStructure = geometryNodeStructure->FindMorphWeightStructure(target.morphIndex);
+        if ((morphWeightStructure) && (morphWeightStructure->GetMorphWeight() != 0.0F))
+        {
+            float weight = morphWeightStructure->GetMorphWeight();
+            if (target.absoluteFlag)
+            {
+                absoluteWeight += weight;
+            }
+
+            if ((target.positionDeltaArray) || (target.normalDeltaArray))
+            {
+                targetArray[activeCount] = &target;
+                weightArray[activeCount] = weight;
+                activeCount++;
+            }
+        }
+    }
+
+    // An absolute target contributes its weight times its own vertices, which is its weighted delta plus the same
+    // weight times morph 0. When the node has a weight for morph 0, the base is therefore scaled by the sum of that
+    // weight and the weights of the absolute targets. Without one, morph 0 takes whatever weight the absolute
+    // targets leave, and the base is used as it is.
+
+    float                       baseWeight = 1.0F;
+    const MorphWeightStructure* baseWeightStructure = geometryNodeStructure->FindMorphWeightStructure(0);
+    if (baseWeightStructure)
+    {
+        baseWeight = baseWeightStructure->GetMorphWeight() + absoluteWeight;
+    }
+
+    MorphStream positionStream = {nullptr, positionArray};
+    MorphStream normalStream = {nullptr, normalArray};
+
+    if (positionArray)
+    {
+        positionStream.baseArray = static_cast<const float*>(positionArrayStructure->GetVertexArrayData());
+    }
+
+    if ((normalArray) && (normalArrayStructure))
+    {
+        normalStream.baseArray = static_cast<const float*>(normalArrayStructure->GetVertexArrayData());
+    }
+
+    OpenGEX::BlendMorphTargets(targetArray, weightArray, activeCount, vertexCount, positionStream, normalStream, threadPool, baseWeight);
+
+    delete[] weightArray;
+    delete[] targetArray;
+    return (true);
+}
+
+DataResult MeshStructure::WeldVertices(const OpenGexDataDescription* dataDescription, ThreadPool* threadPool)
+{
+    OPENGEX_PROFILE_ZONE("MeshStructure::WeldVertices");
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    int32 vertexCount = GetVertexCount();
+    if (vertexCount == 0)
+    {
+        return (kDataOpenGexPositionArrayRequired);
+    }
+
+    for (const VertexArrayStructure* vertexArrayStructure : vertexArrayList)
+    {
+        if (vertexArrayStructure->GetVertexCount() != vertexCount)
+        {
+            return (kDataOpenGexVertexCountMismatch);
+        }
+    }
+
+    if ((skinStructure) && (skinStructure->GetBoneCountArrayStructure()->GetVertexCount() != vertexCount))
+    {
+        return (kDataOpenGexVertexCountMismatch);
+    }
+
+    bool triangleFlag = ((meshPrimitive.empty()) || (meshPrimitive == "triangles"));
+    if ((indexArrayList.empty()) && (!triangleFlag))
+    {
+        // Without an index array, the vertex order defines the primitives, so only triangle lists can be welded.
+        return (kDataOkay);
+    }
+
+    int32 indexCount = 0;
+    for (const IndexArrayStructure* indexArrayStructure : indexArrayList)
+    {
+        indexCount += indexArrayStructure->GetIndexCount();
+    }
+
+    uint32* indexArray = new uint32[(indexArrayList.empty()) ? vertexCount : indexCount];
+
+    if (indexArrayList.empty())
+    {
+        indexCount = vertexCount / 3 * 3;
+        for (machine a = 0; a < indexCount; a++)
+        {
+            indexArray[a] = uint32(a);
+        }
+    }
+    else
+    {
+        uint32* index = indexArray;
+        for (const IndexArrayStructure* indexArrayStructure : indexArrayList)
+        {
+            indexArrayStructure->ReadIndexArray(index);
+
+            uint64 restartIndex = indexArrayStructure->GetRestartIndex();
+            for (machine a = 0; a < indexArrayStructure->GetIndexCount(); a++)
+            {
+                if ((index[a] >= uint32(vertexCount)) && ((restartIndex == 0) || (index[a] != restartIndex)))
+                {
+                    delete[] indexArray;
+                    return (kDataOpenGexIndexValueUnsupported);
+                }
+            }
+
+            index += indexArrayStructure->GetIndexCount();
+        }
+    }
+
+    // Every vertex array takes part in the comparison, including morph targets. Bone influences are
+    // packed into a fixed-width float array holding the count and then (index, weight) pairs.
+
+    int32          attributeCount = int32(vertexArrayList.size());
+    WeldAttribute* attributeArray = new WeldAttribute[attributeCount + 1];
+
+    int32 attributeIndex = 0;
+    for (const VertexArrayStructure* vertexArrayStructure : vertexArrayList)
+    {
+        WeldAttribute& attribute = attributeArray[attributeIndex++];
+        attribute.vertexArray = static_cast<const float*>(vertexArrayStructure->GetVertexArrayData());
+        attribute.componentCount = vertexArrayStructure->GetComponentCount();
+        attribute.epsilon = dataDescription->GetWeldEpsilon(vertexArrayStructure->GetAttribString());
+    }
+
+    float* influenceArray = nullptr;
+    if (skinStructure)
+    {
+        const uint16* boneCountArray = skinStructure->GetBoneCountArrayStructure()->GetBoneCountArray();
+        const uint16* boneIndexArray = skinStructure->GetBoneIndexArrayStructure()->GetBoneIndexArray();
+        const float*  boneWeightArray = skinStructure->GetBoneWeightArrayStructure()->GetBoneWeightArray();
+
+        int32 maxBoneCount = 0;
+        for (machine a = 0; a < vertexCount; a++)
+        {
+            maxBoneCount = Max(maxBoneCount, int32(boneCountArray[a]));
+        }
+
+        int32 influenceStride = maxBoneCount * 2 + 1;
+        influenceArray = new float[vertexCount * influenceStride];
+
+        int32 influence = 0;
+        for (machine a = 0; a < vertexCount; a++)
+        {
+            float* v = influenceArray + a * influenceStride;
+            int32  count = boneCountArray[a];
+
+            v[0] = float(count);
+            for (machine k = 0; k < maxBoneCount; k++)
+            {
+                bool used = (k < count);
+                v[k * 2 + 1] = (used) ? float(boneIndexArray[influence + k]) : 0.0F;
+                v[k * 2 + 2] = (used) ? boneWeightArray[influence + k] : 0.0F;
+            }
+
+            influence += count;
+        }
+
+        WeldAttribute& attribute = attributeArray[attributeCount++];
+        attribute.vertexArray = influenceArray;
+        attribute.componentCount = influenceStride;
+        attribute.epsilon = 0.0F;
+    }
+
+    uint32* remapArray = new uint32[vertexCount * 2];
+    uint32* vertexMap = remapArray + vertexCount;
+
+    int32 weldedCount = OpenGEX::WeldVertices(attributeArray, attributeCount, vertexCount, remapArray, vertexMap, threadPool);
+
+    delete[] influenceArray;
+    delete[] attributeArray;
+
+    if (weldedCount < vertexCount)
+    {
+        if (indexArrayList.empty())
+        {
+            for (machine a = 0; a < indexCount; a++)
+            {
+                indexArray[a] = remapArray[a];
+            }
+
+            // The new index array takes its default material and front face from itself.
+
+            IndexArrayStructure* indexArrayStructure = new IndexArrayStructure;
+            indexArrayStructure->CopyIndexArray(indexArrayStructure, indexCount, indexArray);
+            AppendSubnode(indexArrayStructure);
+            indexArrayList.push_back(indexArrayStructure);
+        }
+        else
+        {
+            // Indices only get smaller, so each index array keeps its current index size.
+
+            uint32* index = indexArray;
+            for (IndexArrayStructure* indexArrayStructure : indexArrayList)
+            {
+                uint64 restartIndex = indexArrayStructure->GetRestartIndex();
+                for (machine a = 0; a < indexArrayStructure->GetIndexCount(); a++)
+                {
+                    if ((restartIndex == 0) || (index[a] != restartIndex))
+                    {
+                        index[a] = remapArray[index[a]];
+                    }
+                }
+
+                indexArrayStructure->WriteIndexArray(index);
+                index += indexArrayStructure->GetIndexCount();
+            }
+        }
+
+        for (VertexArrayStructure* vertexArrayStructure : vertexArrayList)
+        {
+            vertexArrayStructure->RemapVertices(weldedCount, vertexMap);
+        }
+
+        if (skinStructure)
+        {
+            skinStructure->RemapVertices(weldedCount, vertexMap);
+        }
+    }
+
+    delete[] remapArray;
+    delete[] indexArray;
+
+    weldStatistics.originalVertexCount = vertexCount;
+    weldStatistics.weldedVertexCount = weldedCount;
+    weldStatistics.weldTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+    return (kDataOkay);
+}
+
+DataResult MeshStructure::GenerateTangents(ThreadPool* threadPool)
+{
+    OPENGEX_PROFILE_ZONE("MeshStructure::GenerateTangents");
+
+    if ((!meshPrimitive.empty()) && (meshPrimitive != "triangles"))
+    {
+        return (kDataOkay);
+    }
+
+    if ((FindVertexArray("tangent")) || (FindVertexArray("bitangent")))
+    {
+        // Tangents stored in the file are kept.
+        return (kDataOkay);
+    }
+
+    const VertexArrayStructure* positionArrayStructure = FindVertexArray("position");
+    const VertexArrayStructure* normalArrayStructure = FindVertexArray("normal");
+    const VertexArrayStructure* texcoordArrayStructure = FindVertexArray("texcoord");
+
+    if ((!positionArrayStructure) || (!normalArrayStructure) || (!texcoordArrayStructure))
+    {
+        return (kDataOkay);
+    }
+
+    if ((positionArrayStructure->GetComponentCount() < 3) || (normalArrayStructure->GetComponentCount() < 3) || (texcoordArrayStructure->GetComponentCount() < 2))
+    {
+        return (kDataOkay);
+    }
+
+    int32 vertexCount = positionArrayStructure->GetVertexCount();
+    if ((normalArrayStructure->GetVertexCount() != vertexCount) || (texcoordArrayStructure->GetVertexCount() != vertexCount))
+    {
+        return (kDataOpenGexVertexCountMismatch);
+    }
+
+    int32 indexCount = 0;
+    for (const IndexArrayStructure* indexArrayStructure : indexArrayList)
+    {
+        indexCount += indexArrayStructure->GetIndexCount() / 3 * 3;
+    }
+
+    if ((vertexCount == 0) || (indexCount == 0))
+    {
+        return (kDataOkay);
+    }
+
+    // Triangles from index arrays with clockwise front faces are reversed so that all of them are counterclockwise.
+
+    uint32* indexArray = new uint32[indexCount];
+    uint32* triangleArray = new uint32[indexCount];
+
+    int32 offset = 0;
+    for (const IndexArrayStructure* indexArrayStructure : indexArrayList)
+    {
+        int32 count = indexArrayStructure->GetIndexCount();
+        if (count < 3)
+        {
+            continue;
+        }
+
+        indexArrayStructure->ReadIndexArray(triangleArray);
+        count = count / 3 * 3;
+
+        bool clockwise = (indexArrayStructure->GetFrontFace() == "cw");
+        for (machine a = 0; a < count; a += 3)
+        {
+            uint32* triangle = indexArray + offset + a;
+            triangle[0] = triangleArray[a];
+            triangle[1] = triangleArray[a + (clockwise ? 2 : 1)];
+            triangle[2] = triangleArray[a + (clockwise ? 1 : 2)];
+        }
+
+        offset += count;
+    }
+
+    delete[] triangleArray;
+
+    for (machine a = 0; a < indexCount; a++)
+    {
+        if (indexArray[a] >= uint32(vertexCount))
+        {
+            delete[] indexArray;
+            return (kDataOpenGexIndexValueUnsupported);
+        }
+    }
+
+    VertexArrayStructure* tangentArrayStructure = new VertexArrayStructure;
+    VertexArrayStructure* bitangentArrayStructure = new VertexArrayStructure;
+    float*                tangentArray = tangentArrayStructure->AllocateVertexArray("tangent", vertexCount, 3);
+    float*                bitangentArray = bitangentArrayStructure->AllocateVertexArray("bitangent", vertexCount, 3);
+
+    OpenGEX::GenerateTangents(indexArray, indexCount, static_cast<const float*>(positionArrayStructure->GetVertexArrayData()), positionArrayStructure->GetComponentCount(),
+                              static_cast<const float*>(normalArrayStructure->GetVertexArrayData()), normalArrayStructure->GetComponentCount(),
+                              static_cast<const float*>(texcoordArrayStructure->GetVertexArrayData()), texcoordArrayStructure->GetComponentCount(), vertexCount, tangentArray,
+                              bitangentArray, threadPool);
+
+    delete[] indexArray;
+
+    // The new arrays become ordinary vertex arrays of the mesh, so later stages reorder and copy them like any other.
+
+    AppendSubnode(tangentArrayStructure);
+    AppendSubnode(bitangentArrayStructure);
+    vertexArrayList.push_back(tangentArrayStructure);
+    vertexArrayList.push_back(bitangentArrayStructure);
+
+    return (kDataOkay);
+}
+
+DataResult MeshStructure::OptimizeVertexCache(int32 cacheSize)
+{
+    OPENGEX_PROFILE_ZONE("MeshStructure::OptimizeVertexCache");
+
+    if ((!meshPrimitive.empty()) && (meshPrimitive != "triangles"))
+    {
+        // Only triangle lists are reordered.
+        return (kDataOkay);
+    }
+
+    int32 vertexCount = GetVertexCount();
+    if (vertexCount == 0)
+    {
+        return (kDataOpenGexPositionArrayRequired);
+    }
+
+    for (const VertexArrayStructure* vertexArrayStructure : vertexArrayList)
+    {
+        if (vertexArrayStructure->GetVertexCount() != vertexCount)
+        {
+            return (kDataOpenGexVertexCountMismatch);
+        }
+    }
+
+    if ((skinStructure) && (skinStructure->GetBoneCountArrayStructure()->GetVertexCount() != vertexCount))
+    {
+        return (kDataOpenGexVertexCountMismatch);
+    }
+
+    // Index arrays with a restart value can't be reordered as independent triangles, so meshes that use one keep their original order.
+
+    int32 indexCount = 0;
+    for (const IndexArrayStructure* indexArrayStructure : indexArrayList)
+    {
+        if (indexArrayStructure->GetRestartIndex() != 0)
+        {
+            return (kDataOkay);
+        }
+
+        indexCount += indexArrayStructure->GetIndexCount();
+    }
+
+    if (indexCount == 0)
+    {
+        return (kDataOkay);
+    }
+
+    uint32* indexArray = new uint32[indexCount * 2];
+    uint32* optimizedArray = indexArray + indexCount;
+
+    uint32* index = indexArray;
+    for (const IndexArrayStructure* indexArrayStructure : indexArrayList)
+    {
+        indexArrayStructure->ReadIndexArray(index);
+        index += indexArrayStructure->GetIndexCount();
+    }
+
+    for (machine a = 0; a < indexCount; a++)
+    {
+        if (indexArray[a] >= uint32(vertexCount))
+        {
+            // The cache simulation can't handle indices outside the vertex arrays, so the mesh is left unoptimized.
+
+            delete[] indexArray;
+            return (kDataOkay);
+        }
+    }
+
+    cacheSize = Min(Max(cacheSize, int32(kVertexCacheMinSize)), int32(kVertexCacheMaxSize));
+    AnalyzeVertexCache(indexArray, indexCount / 3, vertexCount, cacheSize, &originalCacheStatistics);
+
+    // Triangles are reordered within each index array so that material groups stay intact,
+    // and then vertices are renumbered in the order that the combined index stream fetches them.
+
+    int32 offset = 0;
+    for (const IndexArrayStructure* indexArrayStructure : indexArrayList)
+    {
+        int32 count = indexArrayStructure->GetIndexCount();
+        OptimizeTriangleOrder(indexArray + offset, count / 3, vertexCount, cacheSize, optimizedArray + offset);
+        offset += count;
+    }
+
+    uint32* vertexMap = new uint32[vertexCount];
+    OptimizeVertexOrder(optimizedArray, indexCount, vertexCount, vertexMap);
+
+    AnalyzeVertexCache(optimizedArray, indexCount / 3, vertexCount, cacheSize, &optimizedCacheStatistics);
+
+    offset = 0;
+    for (IndexArrayStructure* indexArrayStructure : indexArrayList)
+    {
+        indexArrayStructure->WriteIndexArray(optimizedArray + offset);
+        offset += indexArrayStructure->GetIndexCount();
+    }
+
+    for (VertexArrayStructure* vertexArrayStructure : vertexArrayList)
+    {
+        vertexArrayStructure->RemapVertices(vertexCount, vertexMap);
+    }
+
+    if (skinStructure)
+    {
+        skinStructure->RemapVertices(vertexCount, vertexMap);
+    }
+
+    delete[] vertexMap;
+    delete[] indexArray;
+    return (kDataOkay);
+}
+
+DataResult MeshStructure::GenerateMeshlets(int32 maxVertexCount, int32 maxTriangleCount)
+{
+    OPENGEX_PROFILE_ZONE("MeshStructure::GenerateMeshlets");
+
+    if ((!meshPrimitive.empty()) && (meshPrimitive != "triangles"))
+    {
+        // Only triangle lists are split into meshlets.
+        return (kDataOkay);
+    }
+
+    const VertexArrayStructure* positionArrayStructure = FindVertexArray("position");
+    if (!positionArrayStructure)
+    {
+        return (kDataOpenGexPositionArrayRequired);
+    }
+
+    int32 vertexCount = positionArrayStructure->GetVertexCount();
+    int32 positionStride = positionArrayStructure->GetComponentCount();
+    if (positionStride < 3)
+    {
+        // Meshlet bounds are three-dimensional.
+        return (kDataOkay);
+    }
+
+    const float* positionArray = static_cast<const float*>(positionArrayStructure->GetVertexArrayData());
+
+    int32 indexCount = 0;
+    for (const IndexArrayStructure* indexArrayStructure : indexArrayList)
+    {
+        indexCount += indexArrayStructure->GetIndexCount();
+    }
+
+    if (indexCount == 0)
+    {
+        return (kDataOkay);
+    }
+
+    uint32* indexArray = new uint32[indexCount];
+
+    uint32* index = indexArray;
+    for (const IndexArrayStructure* indexArrayStructure : indexArrayList)
+    {
+        indexArrayStructure->ReadIndexArray(index);
+        index += indexArrayStructure->GetIndexCount();
+    }
+
+    for (machine a = 0; a < indexCount; a++)
+    {
+        if (indexArray[a] >= uint32(vertexCount))
+        {
+            delete[] indexArray;
+            return (kDataOpenGexIndexValueUnsupported);
+        }
+    }
+
+    // Meshlets are built into worst-case sized arrays first, one index array at a time so that
+    // each meshlet has a single material, and then packed into one allocation.
+
+    Meshlet* tempMeshletArray = new Meshlet[indexCount / 3 + 1];
+    uint32*  tempVertexArray = new uint32[indexCount];
+    uint8*   tempTriangleArray = new uint8[indexCount];
+
+    int32 meshletCount = 0;
+    int32 vertexTotal = 0;
+    int32 triangleTotal = 0;
+    int32 offset = 0;
+
+    for (const IndexArrayStructure* indexArrayStructure : indexArrayList)
+    {
+        int32 triangleCount = indexArrayStructure->GetIndexCount() / 3;
+        int32 count = BuildMeshlets(indexArray + offset, triangleCount, positionArray, positionStride, vertexCount, maxVertexCount, maxTriangleCount,
+                                    tempMeshletArray + meshletCount, tempVertexArray + vertexTotal, tempTriangleArray + triangleTotal * 3);
+
+        // The offsets returned for each index array accumulate from zero, so the totals of the previous arrays are added once.
+
+        uint32 materialIndex = indexArrayStructure->GetMaterialIndex();
+        int32  vertexBase = vertexTotal;
+        int32  triangleBase = triangleTotal;
+
+        for (machine a = 0; a < count; a++)
+        {
+            Meshlet* meshlet = &tempMeshletArray[meshletCount + a];
+            meshlet->vertexOffset += vertexBase;
+            meshlet->triangleOffset += triangleBase;
+            meshlet->materialIndex = materialIndex;
+            vertexTotal += meshlet->vertexCount;
+            triangleTotal += meshlet->triangleCount;
+        }
+
+        meshletCount += count;
+        offset += indexArrayStructure->GetIndexCount();
+    }
+
+    delete[] meshletStorage;
+    meshletStorage = new char[meshletCount * sizeof(Meshlet) + vertexTotal * 4 + triangleTotal * 3];
+
+    meshletData.meshletCount = meshletCount;
+    meshletData.vertexCount = vertexTotal;
+    meshletData.triangleCount = triangleTotal;
+    meshletData.meshletArray = reinterpret_cast<Meshlet*>(meshletStorage);
+    meshletData.vertexArray = reinterpret_cast<uint32*>(meshletData.meshletArray + meshletCount);
+    meshletData.triangleArray = reinterpret_cast<uint8*>(meshletData.vertexArray + vertexTotal);
+
+    for (machine a = 0; a < meshletCount; a++)
+    {
+        meshletData.meshletArray[a] = tempMeshletArray[a];
+    }
+
+    for (machine a = 0; a < vertexTotal; a++)
+    {
+        meshletData.vertexArray[a] = tempVertexArray[a];
+    }
+
+    for (machine a = 0; a < triangleTotal * 3; a++)
+    {
+        meshletData.triangleArray[a] = tempTriangleArray[a];
+    }
+
+    delete[] tempTriangleArray;
+    delete[] tempVertexArray;
+    delete[] tempMeshletArray;
+    delete[] indexArray;
+    return (kDataOkay);
+}
+
+DataResult MeshStructure::GenerateLods(const OpenGexDataDescription* dataDescription, ProcessFlags flags, ThreadPool* threadPool)
+{
+    OPENGEX_PROFILE_ZONE("MeshStructure::GenerateLods");
+
+    if ((!meshPrimitive.empty()) && (meshPrimitive != "triangles"))
+    {
+        // Only triangle lists are simplified.
+        return (kDataOkay);
+    }
+
+    const Structure* superNode = GetSuperNode();
+    if ((!superNode) || (superNode->GetStructureType() != kStructureGeometryObject))
+    {
+        return (kDataOkay);
+    }
+
+    // The chain is generated from the most detailed mesh in the geometry object, and levels already present in the file are kept.
+
+    const auto* meshMap = static_cast<const GeometryObjectStructure*>(superNode)->GetMeshMap();
+    for (const auto& entry : *meshMap)
+    {
+        if (entry.first < meshLevel)
+        {
+            return (kDataOkay);
+        }
+    }
+
+    const VertexArrayStructure* positionArrayStructure = FindVertexArray("position");
+    if (!positionArrayStructure)
+    {
+        return (kDataOpenGexPositionArrayRequired);
+    }
+
+    int32 vertexCount = positionArrayStructure->GetVertexCount();
+    int32 positionStride = positionArrayStructure->GetComponentCount();
+    if (positionStride < 3)
+    {
+        return (kDataOkay);
+    }
+
+    for (const VertexArrayStructure* vertexArrayStructure : vertexArrayList)
+    {
+        if (vertexArrayStructure->GetVertexCount() != vertexCount)
+        {
+            return (kDataOpenGexVertexCountMismatch);
+        }
+    }
+
+    if ((skinStructure) && (skinStructure->GetBoneCountArrayStructure()->GetVertexCount() != vertexCount))
+    {
+        return (kDataOpenGexVertexCountMismatch);
+    }
+
+    int32 indexCount = 0;
+    for (const IndexArrayStructure* indexArrayStructure : indexArrayList)
+    {
+        indexCount += indexArrayStructure->GetIndexCount() / 3 * 3;
+    }
+
+    if (indexCount == 0)
+    {
+        return (kDataOkay);
+    }
+
+    // All index arrays are simplified together so that they stay connected, and each triangle
+    // is tagged with the index array that it came from so that material boundaries are preserved.
+
+    uint32* indexArray = new uint32[indexCount * 2];
+    uint32* outputIndexArray = indexArray + indexCount;
+    uint32* groupArray = new uint32[indexCount / 3 * 2];
+    uint32* outputGroupArray = groupArray + indexCount / 3;
+
+    int32  offset = 0;
+    uint32 group = 0;
+    for (const IndexArrayStructure* indexArrayStructure : indexArrayList)
+    {
+        int32   count = indexArrayStructure->GetIndexCount();
+        uint32* data = new uint32[count];
+        indexArrayStructure->ReadIndexArray(data);
+
+        count = count / 3 * 3;
+        for (machine a = 0; a < count; a++)
+        {
+            indexArray[offset + a] = data[a];
+        }
+
+        for (machine a = 0; a < count / 3; a++)
+        {
+            groupArray[offset / 3 + a] = group;
+        }
+
+        delete[] data;
+        offset += count;
+        group++;
+    }
+
+    for (machine a = 0; a < indexCount; a++)
+    {
+        if (indexArray[a] >= uint32(vertexCount))
+        {
+            delete[] groupArray;
+            delete[] indexArray;
+            return (kDataOpenGexIndexValueUnsupported);
+        }
+    }
+
+    const float* positionArray = static_cast<const float*>(positionArrayStructure->GetVertexArrayData());
+    int32        lodCount = dataDescription->GetLodCount();
+    float        lodRatio = dataDescription->GetLodRatio();
+
+    DataResult result = kDataOkay;
+    int32      previousCount = indexCount;
+    float      ratio = 1.0F;
+
+    for (machine level = 1; level <= lodCount; level++)
+    {
+        ratio *= lodRatio;
+
+        int32 targetCount = int32(float(indexCount / 3) * ratio) * 3;
+        if (targetCount < 3)
+        {
+            break;
+        }
+
+        uint32 key = meshLevel + uint32(level);
+        if (meshMap->find(key) != meshMap->end())
+        {
+            continue;
+        }
+
+        // Each level is simplified from the full mesh so that its error is measured against the original surface.
+
+        float error;
+        int32 count = SimplifyMesh(indexArray, groupArray, indexCount, positionArray, positionStride, vertexCount, targetCount, outputIndexArray, outputGroupArray, &error);
+        if (count >= previousCount)
+        {
+            break;
+        }
+
+        previousCount = count;
+
+        MeshStructure* meshStructure = CreateLodMesh(key, outputIndexArray, outputGroupArray, count, vertexCount, error);
+        result = meshStructure->ProcessMesh(dataDescription, flags & ~(kProcessWeldVertices | kProcessGenerateTangents | kProcessGenerateLods), threadPool);
+        if (result != kDataOkay)
+        {
+            delete meshStructure;
+            break;
+        }
+
+        generatedMeshList.push_back(meshStructure);
+    }
+
+    delete[] groupArray;
+    delete[] indexArray;
+    return (result);
+}
+
+MeshStructure* MeshStructure::CreateLodMesh(uint32 level, uint32* indexArray, const uint32* groupArray, int32 indexCount, int32 vertexCount, float error) const
+{
+    MeshStructure* meshStructure = new MeshStructure;
+    meshStructure->meshLevel = level;
+    meshStructure->meshPrimitive = meshPrimitive;
+    meshStructure->lodError = error;
+
+    // The simplified mesh uses a subset of the original vertices, so the original bounds still enclose it.
+
+    meshStructure->CopyBounds(this);
+
+    // Only the vertices still referenced are kept, in the order that the simplified triangles use them.
+
+    uint32* vertexMap = new uint32[vertexCount];
+    OptimizeVertexOrder(indexArray, indexCount, vertexCount, vertexMap);
+
+    int32 count = 0;
+    for (machine a = 0; a < indexCount; a++)
+    {
+        count = Max(count, int32(indexArray[a] + 1));
+    }
+
+    for (const VertexArrayStructure* vertexArrayStructure : vertexArrayList)
+    {
+        VertexArrayStructure* lodArrayStructure = new VertexArrayStructure;
+        lodArrayStructure->CopyVertexArray(vertexArrayStructure, count, vertexMap);
+        meshStructure->AppendSubnode(lodArrayStructure);
+        meshStructure->vertexArrayList.push_back(lodArrayStructure);
+    }
+
+    uint32* lodIndexArray = new uint32[indexCount];
+
+    uint32 group = 0;
+    for (const IndexArrayStructure* indexArrayStructure : indexArrayList)
+    {
+        int32 lodIndexCount = 0;
+        for (machine a = 0; a < indexCount / 3; a++)
+        {
+            if (groupArray[a] == group)
+            {
+                lodIndexArray[lodIndexCount] = indexArray[a * 3];
+                lodIndexArray[lodIndexCount + 1] = indexArray[a * 3 + 1];
+                lodIndexArray[lodIndexCount + 2] = indexArray[a * 3 + 2];
+                lodIndexCount += 3;
+            }
+        }
+
+        if (lodIndexCount != 0)
+        {
+            IndexArrayStructure* lodArrayStructure = new IndexArrayStructure;
+            lodArrayStructure->CopyIndexArray(indexArrayStructure, lodIndexCount, lodIndexArray);
+            meshStructure->AppendSubnode(lodArrayStructure);
+            meshStructure->indexArrayList.push_back(lodArrayStructure);
+        }
+
+        group++;
+    }
+
+    if (skinStructure)
+    {
+        SkinStructure* lodSkinStructure = new SkinStructure;
+        lodSkinStructure->CopySkin(skinStructure, count, vertexMap);
+        meshStructure->AppendSubnode(lodSkinStructure);
+        meshStructure->skinStructure = lodSkinStructure;
+    }
+
+    delete[] lodIndexArray;
+    delete[] vertexMap;
+    return (meshStructure);
+}
+
+DataResult MeshStructure::ProcessMesh(const OpenGexDataDescription* dataDescription, ProcessFlags flags, ThreadPool* threadPool)
+{
+    OPENGEX_PROFILE_ZONE("MeshStructure::ProcessMesh");
+
+    if (flags & kProcessWeldVertices)
+    {
+        DataResult result = WeldVertices(dataDescription, threadPool);
+        if (result != kDataOkay)
+        {
+            return (result);
+        }
+    }
+
+    if (flags & kProcessGenerateTangents)
+    {
+        DataResult result = GenerateTangents(threadPool);
+        if (result != kDataOkay)
+        {
+            return (result);
+        }
+    }
+
+    if (flags & kProcessGenerateLods)
+    {
+        DataResult result = GenerateLods(dataDescription, flags, threadPool);
+        if (result != kDataOkay)
+        {
+            return (result);
+        }
+    }
+
+    if (flags & kProcessOptimizeVertexCache)
+    {
+        DataResult result = OptimizeVertexCache(dataDescription->GetVertexCacheSize());
+        if (result != kDataOkay)
+        {
+            return (result);
+        }
+    }
+
+    if (flags & kProcessNarrowIndexArrays)
+    {
+        int32 vertexCount = GetVertexCount();
+        int32 minIndexSize = dataDescription->GetMinIndexSize();
+
+        for (IndexArrayStructure* indexArrayStructure : indexArrayList)
+        {
+            indexArrayStructure->NarrowIndexArray(vertexCount, minIndexSize);
+        }
+    }
+
+    if ((flags & kProcessPackSkinInfluences) && (skinStructure))
+    {
+        DataResult result = skinStructure->PackInfluences(dataDescription->GetSkinPackFormat(), threadPool);
+        if (result != kDataOkay)
+        {
+            return (result);
+        }
+    }
+
+    if (flags & kProcessBuildMeshlets)
+    {
+        DataResult result = GenerateMeshlets(dataDescription->GetMeshletVertexCount(), dataDescription->GetMeshletTriangleCount());
+        if (result != kDataOkay)
+        {
+            return (result);
+        }
+    }
+
+    return (kDataOkay);
+}
+
+void MeshStructure::AttachGeneratedMeshes(OpenGexDataDescription* dataDescription)
+{
+    GeometryObjectStructure* geometryObjectStructure = static_cast<GeometryObjectStructure*>(GetSuperNode());
+
+    for (MeshStructure* meshStructure : generatedMeshList)
+    {
+        geometryObjectStructure->InsertMesh(meshStructure);
+        dataDescription->AddMesh(meshStructure);
+    }
+
+    generatedMeshList.clear();
+}
+
+void MeshStructure::AccountMemory(MemoryAccount* account) const
+{
+    if (meshletStorage)
+    {
+        uint64 size = uint64(meshletData.meshletCount) * sizeof(Meshlet) + uint64(meshletData.vertexCount) * 4 + uint64(meshletData.triangleCount) * 3;
+        account->AddProcessedData(kStructureMesh, this, "meshlet", size, false);
+    }
+
+    if (boneBoundsArray)
+    {
+        account->AddProcessedData(kStructureMesh, this, "bone bounds", uint64(boneBoundsCount) * sizeof(BoundingBox), false);
+    }
+
+    if (morphTargetArray)
+    {
+        account->AddProcessedData(kStructureMesh, this, "morph target", uint64(morphTargetCount) * sizeof(MorphTarget) + morphStatistics.storedSize, false);
+    }
+}
+
+ObjectStructure::ObjectStructure(StructureType type) : OpenGexStructure(type)
+{
+    SetBaseStructureType(kStructureObject);
+}
+
+ObjectStructure::~ObjectStructure()
+{
+}
+
+GeometryObjectStructure::GeometryObjectStructure() : ObjectStructure(kStructureGeometryObject)
+{
+    visibleFlag = true;
+    shadowFlag = true;
+    motionBlurFlag = true;
+}
+
+GeometryObjectStructure::~GeometryObjectStructure()
+{
+    meshMap.clear();
+}
+
+bool GeometryObjectStructure::ValidateProperty(const DataDescription* dataDescription, std::string_view identifier, DataType* type, void** value)
+{
+    if (identifier == "visible")
+    {
+        *type = kDataBool;
+        *value = &visibleFlag;
+        return (true);
+    }
+
+    if (identifier == "shadow")
+    {
+        *type = kDataBool;
+        *value = &shadowFlag;
+        return (true);
+    }
+
+    if (identifier == "motion_blur")
+    {
+        *type = kDataBool;
+        *value = &motionBlurFlag;
+        return (true);
+    }
+
+    return (false);
+}
+
+bool GeometryObjectStructure::ValidateSubstructure(const DataDescription* dataDescription, const Structure* structure) const
+{
+    StructureType type = structure->GetStructureType();
+    if ((type == kStructureMesh) || (type == kStructureMorph))
+    {
+        return (true);
+    }
+
+    return (OpenGexStructure::ValidateSubstructure(dataDescription, structure));
+}
+
+DataResult GeometryObjectStructure::ProcessData(DataDescription* dataDescription)
+{
+    OPENGEX_PROFILE_ZONE("GeometryObjectStructure::ProcessData");
+
+    DataResult result = OpenGexStructure::ProcessData(dataDescription);
+    if (result != kDataOkay)
+    {
+        return (result);
+    }
+
+    int32 meshCount = 0;
+    int32 skinCount = 0;
+
+    Structure* structure = GetFirstSubnode();
+    while (structure)
+    {
+        StructureType type = structure->GetStructureType();
+        if (type == kStructureMesh)
+        {
+            MeshStructure* meshStructure = static_cast<MeshStructure*>(structure);
+            auto           it = meshMap.insert({meshStructure->GetKey(), meshStructure});
+            if (!it.second)
+            {
+                return (kDataOpenGexDuplicateLod);
+            }
+
+            meshCount++;
+            skinCount += (meshStructure->GetSkinStructure() != nullptr);
+        }
+        else if (type == kStructureMorph)
+        {
+            MorphStructure* morphStructure = static_cast<MorphStructure*>(structure);
+            auto            it = morphMap.insert({morphStructure->GetKey(), morphStructure});
+            if (!it.second)
+            {
+                return (kDataOpenGexDuplicateMorph);
+            }
+        }
+
+        structure = structure->GetNextSubnode();
+    }
+
+    if (meshCount == 0)
+    {
+        return (kDataMissingSubstructure);
+    }
+
+    if ((skinCount != 0) && (skinCount != meshCount))
+    {
+        return (kDataOpenGexMissingLodSkin);
+    }
+
+    // Do application-specific object processing here.
+
+    return (kDataOkay);
+}
+
+void GeometryObjectStructure::InsertMesh(MeshStructure* meshStructure)
+{
+    AppendSubnode(meshStructure);
+    meshMap.insert({meshStructure->GetKey(), meshStructure});
+}
+
+const MeshStructure* GeometryObjectStructure::GetBaseMesh(void) const
+{
+    const MeshStructure* baseMesh = nullptr;
+    for (const auto& entry : meshMap)
+    {
+        if ((!baseMesh) || (entry.first < baseMesh->GetKey()))
+        {
+            baseMesh = entry.second;
+        }
+    }
+
+    return (baseMesh);
+}
+
+LightObjectStructure::LightObjectStructure() : ObjectStructure(kStructureLightObject)
+{
+    shadowFlag = true;
+}
+
+LightObjectStructure::~LightObjectStructure()
+{
+}
+
+bool LightObjectStructure::ValidateProperty(const DataDescription* dataDescription, std::string_view identifier, DataType* type, void** value)
+{
+    if (identifier == "type")
+    {
+        *type = kDataString;
+        *value = &typeString;
+        return (true);
+    }
+
+    if (identifier == "shadow")
+    {
+        *type = kDataBool;
+        *value = &shadowFlag;
+        return (true);
+    }
+
+    return (false);
+}
+
+bool LightObjectStructure::ValidateSubstructure(const DataDescription* dataDescription, const Structure* structure) const
+{
+    if ((structure->GetBaseStructureType() == kStructureAttrib) || (structure->GetStructureType() == kStructureAtten))
+    {
+        return (true);
+    }
+
+    return (OpenGexStructure::ValidateSubstructure(dataDescription, structure));
+}
+
+DataResult LightObjectStructure::ProcessData(DataDescription* dataDescription)
+{
+    OPENGEX_PROFILE_ZONE("LightObjectStructure::ProcessData");
+
+    DataResult result = OpenGexStructure::ProcessData(dataDescription);
+    if (result != kDataOkay)
+    {
+        return (result);
+    }
+
+    if (typeString == "infinite")
+    {
+        // Prepare to handle infinite light here.
+    }
+    else if (typeString == "point")
+    {
+        // Prepare to handle point light here.
+    }
+    else if (typeString == "spot")
+    {
+        // Prepare to handle spot light here.
+    }
+    else
+    {
+        return (kDataOpenGexUndefinedLightType);
+    }
+
+    const Structure* structure = GetFirstSubnode();
+    while (structure)
+    {
+        StructureType type = structure->GetStructureType();
+        if (type == kStructureColor)
+        {
             const ColorStructure* colorStructure = static_cast<const ColorStructure*>(structure);
             if (colorStructure->GetAttribString() == "light")
             {
@@ -2567,6 +4660,8 @@ bool CameraObjectStructure::ValidateSubstructure(const DataDescription* dataDesc
 
 DataResult CameraObjectStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("CameraObjectStructure::ProcessData");
+
     DataResult result = OpenGexStructure::ProcessData(dataDescription);
     if (result != kDataOkay)
     {
@@ -2665,6 +4760,8 @@ bool ParamStructure::ValidateSubstructure(const DataDescription* dataDescription
 
 DataResult ParamStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("ParamStructure::ProcessData");
+
     const Structure* structure = GetFirstSubnode();
     if (!structure)
     {
@@ -2711,6 +4808,8 @@ bool ColorStructure::ValidateSubstructure(const DataDescription* dataDescription
 
 DataResult ColorStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("ColorStructure::ProcessData");
+
     const Structure* structure = GetFirstSubnode();
     if (!structure)
     {
@@ -2774,6 +4873,8 @@ bool SpectrumStructure::ValidateSubstructure(const DataDescription* dataDescript
 
 DataResult SpectrumStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("SpectrumStructure::ProcessData");
+
     // Process spectrum here.
 
     return (kDataOkay);
@@ -2855,6 +4956,8 @@ bool TextureStructure::ValidateSubstructure(const DataDescription* dataDescripti
 
 DataResult TextureStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("TextureStructure::ProcessData");
+
     DataResult result = AttribStructure::ProcessData(dataDescription);
     if (result != kDataOkay)
     {
@@ -2954,6 +5057,8 @@ bool AttenStructure::ValidateSubstructure(const DataDescription* dataDescription
 
 DataResult AttenStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("AttenStructure::ProcessData");
+
     DataResult result = OpenGexStructure::ProcessData(dataDescription);
     if (result != kDataOkay)
     {
@@ -3078,6 +5183,8 @@ bool MaterialStructure::ValidateSubstructure(const DataDescription* dataDescript
 
 DataResult MaterialStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("MaterialStructure::ProcessData");
+
     DataResult result = OpenGexStructure::ProcessData(dataDescription);
     if (result != kDataOkay)
     {
@@ -3130,6 +5237,8 @@ bool KeyStructure::ValidateSubstructure(const DataDescription* dataDescription,
 
 DataResult KeyStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("KeyStructure::ProcessData");
+
     DataResult result = OpenGexStructure::ProcessData(dataDescription);
     if (result != kDataOkay)
     {
@@ -3207,6 +5316,8 @@ bool CurveStructure::ValidateSubstructure(const DataDescription* dataDescription
 
 DataResult CurveStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("CurveStructure::ProcessData");
+
     DataResult result = OpenGexStructure::ProcessData(dataDescription);
     if (result != kDataOkay)
     {
@@ -3357,6 +5468,8 @@ TimeStructure::~TimeStructure()
 
 DataResult TimeStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("TimeStructure::ProcessData");
+
     DataResult result = CurveStructure::ProcessData(dataDescription);
     if (result != kDataOkay)
     {
@@ -3467,6 +5580,8 @@ ValueStructure::~ValueStructure()
 
 DataResult ValueStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("ValueStructure::ProcessData");
+
     DataResult result = CurveStructure::ProcessData(dataDescription);
     if (result != kDataOkay)
     {
@@ -3646,12 +5761,14 @@ bool TrackStructure::ValidateSubstructure(const DataDescription* dataDescription
 
 DataResult TrackStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("TrackStructure::ProcessData");
+
     if (targetRef.GetGlobalRefFlag())
     {
         return (kDataOpenGexTargetRefNotLocal);
     }
 
-    Structure* target = GetSuperNode()->GetSuperNode()->FindStructure(targetRef);
+    Structure* target = static_cast<OpenGexDataDescription*>(dataDescription)->GetNameIndex()->FindStructure(targetRef, GetSuperNode()->GetSuperNode());
     if (!target)
     {
         return (kDataBrokenReference);
@@ -3719,6 +5836,8 @@ DataResult TrackStructure::ProcessData(DataDescription* dataDescription)
 
 void TrackStructure::UpdateAnimation(const OpenGexDataDescription* dataDescription, float time) const
 {
+    OPENGEX_PROFILE_ZONE("TrackStructure::UpdateAnimation");
+
     float param;
 
     int32 index = timeStructure->CalculateInterpolationParameter(time, &param);
@@ -3777,6 +5896,8 @@ bool AnimationStructure::ValidateSubstructure(const DataDescription* dataDescrip
 
 DataResult AnimationStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("AnimationStructure::ProcessData");
+
     DataResult result = OpenGexStructure::ProcessData(dataDescription);
     if (result != kDataOkay)
     {
@@ -3821,6 +5942,8 @@ Range<float> AnimationStructure::GetAnimationTimeRange(void) const
 
 void AnimationStructure::UpdateAnimation(const OpenGexDataDescription* dataDescription, float time) const
 {
+    OPENGEX_PROFILE_ZONE("AnimationStructure::UpdateAnimation");
+
     if (beginFlag)
     {
         time = Fmax(time, beginTime);
@@ -3871,6 +5994,8 @@ bool ClipStructure::ValidateSubstructure(const DataDescription* dataDescription,
 
 DataResult ClipStructure::ProcessData(DataDescription* dataDescription)
 {
+    OPENGEX_PROFILE_ZONE("ClipStructure::ProcessData");
+
     DataResult result = OpenGexStructure::ProcessData(dataDescription);
     if (result != kDataOkay)
     {
@@ -3919,15 +6044,50 @@ OpenGexDataDescription::OpenGexDataDescription()
     greenChromaticity.Set(0.3F, 0.6F);
     blueChromaticity.Set(0.15F, 0.06F);
     whiteChromaticity.Set(0.3127F, 0.329F);
+
+    processFlags = 0;
+    vertexCacheSize = kVertexCacheDefaultSize;
+    minIndexSize = 1;
+    meshletVertexCount = kMeshletDefaultVertexCount;
+    meshletTriangleCount = kMeshletDefaultTriangleCount;
+    lodCount = kLodDefaultCount;
+    lodRatio = 0.5F;
+    threadPool = nullptr;
+    loadMonitor = nullptr;
+
+    incrementalFlag = false;
+    processStage = kProcessStageDone;
+    processStructure = nullptr;
+    processedParent = nullptr;
+    processMeshCount = 0;
+
+    skinPackFormat.influenceCount = kSkinDefaultInfluenceCount;
+    skinPackFormat.indexSize = 1;
+    skinPackFormat.weightFormat = kSkinWeightUnorm8;
+    skinPackFormat.planarFlag = false;
+    skinPackFormat.compactPaletteFlag = true;
+
+    morphSparseThreshold = 0.25F;
 }
 
 OpenGexDataDescription::~OpenGexDataDescription()
 {
+    for (Skeleton* skeleton : skeletonList)
+    {
+        delete skeleton;
+    }
+
     animationList.clear();
+    meshList.clear();
 }
 
 Structure* OpenGexDataDescription::CreateStructure(std::string_view identifier) const
 {
+    if (loadMonitor)
+    {
+        loadMonitor->AddStructure();
+    }
+
     if (identifier == "Metric")
     {
         return (new MetricStructure);
@@ -4073,90 +6233,413 @@ Structure* OpenGexDataDescription::CreateStructure(std::string_view identifier)
         return (new ColorStructure);
     }
 
-    if (identifier == "Spectrum")
+    if (identifier == "Spectrum")
+    {
+        return (new SpectrumStructure);
+    }
+
+    if (identifier == "Texture")
+    {
+        return (new TextureStructure);
+    }
+
+    if (identifier == "Atten")
+    {
+        return (new AttenStructure);
+    }
+
+    if (identifier == "Material")
+    {
+        return (new MaterialStructure);
+    }
+
+    if (identifier == "Key")
+    {
+        return (new KeyStructure);
+    }
+
+    if (identifier == "Time")
+    {
+        return (new TimeStructure);
+    }
+
+    if (identifier == "Value")
+    {
+        return (new ValueStructure);
+    }
+
+    if (identifier == "Track")
+    {
+        return (new TrackStructure);
+    }
+
+    if (identifier == "Animation")
+    {
+        return (new AnimationStructure);
+    }
+
+    if (identifier == "Clip")
+    {
+        return (new ClipStructure);
+    }
+
+    return (nullptr);
+}
+
+bool OpenGexDataDescription::ValidateTopLevelStructure(const Structure* structure) const
+{
+    // Rejecting the next structure is the only way to stop the parser, and ProcessText() reports the cancellation.
+
+    if ((loadMonitor) && (loadMonitor->GetCancelFlag()))
+    {
+        return (false);
+    }
+
+    StructureType type = structure->GetBaseStructureType();
+    if ((type == kStructureNode) || (type == kStructureObject))
+    {
+        return (true);
+    }
+
+    type = structure->GetStructureType();
+    return ((type == kStructureMetric) || (type == kStructureMaterial) || (type == kStructureClip));
+}
+
+DataResult OpenGexDataDescription::ProcessText(const char* text)
+{
+    OPENGEX_PROFILE_ZONE("OpenGexDataDescription::ProcessText");
+
+    DataResult result = DataDescription::ProcessText(text);
+    if ((result != kDataOkay) && (loadMonitor) && (loadMonitor->GetCancelFlag()))
+    {
+        result = kDataOpenGexLoadCancelled;
+    }
+
+    return (result);
+}
+
+DataResult OpenGexDataDescription::ProcessFile(const char* fileName)
+{
+    char*  text = nullptr;
+    uint64 size = 0;
+
+    DataResult result = LoadTextFile(fileName, &text, &size);
+    if (result == kDataOkay)
+    {
+        result = ProcessText(text);
+        delete[] text;
+    }
+
+    return (result);
+}
+
+DataResult OpenGexDataDescription::ProcessData(void)
+{
+    OPENGEX_PROFILE_ZONE("OpenGexDataDescription::ProcessData");
+
+    if (loadMonitor)
+    {
+        loadMonitor->FinishParse();
+    }
+
+    colorInitFlag = false;
+    meshList.clear();
+    geometryNodeList.clear();
+
+    for (Skeleton* skeleton : skeletonList)
+    {
+        delete skeleton;
+    }
+
+    skeletonList.clear();
+
+    nameIndex.Clear();
+    nameIndex.BuildStructureNames(GetRootStructure());
+
+    processStage = kProcessStageStructures;
+    processStructure = GetFirstStepStructure(GetRootStructure()->GetFirstSubnode());
+
+    if (incrementalFlag)
     {
-        return (new SpectrumStructure);
+        return (kDataOkay);
     }
 
-    if (identifier == "Texture")
+    DataResult result = DataDescription::ProcessData();
+    if (result == kDataOkay)
     {
-        return (new TextureStructure);
+        result = ProcessMeshes();
     }
 
-    if (identifier == "Atten")
+    if ((result == kDataOkay) && (loadMonitor))
     {
-        return (new AttenStructure);
+        result = (loadMonitor->GetCancelFlag()) ? DataResult(kDataOpenGexLoadCancelled) : DataResult(kDataOkay);
+        loadMonitor->SetLoadStage(kLoadStageFinish);
     }
 
-    if (identifier == "Material")
+    if (result == kDataOkay)
     {
-        return (new MaterialStructure);
+        for (MeshStructure* meshStructure : meshList)
+        {
+            meshStructure->BuildMorphTargets(this);
+        }
+
+        FinishProcessing();
     }
 
-    if (identifier == "Key")
+    processStage = kProcessStageDone;
+    return (result);
+}
+
+void OpenGexDataDescription::FinishProcessing(void)
+{
+    BuildSkeletons();
+
+    // Substructures are processed before the structures containing them, so named nodes are added here in file order.
+
+    const Structure* root = GetRootStructure();
+    Structure*       node = root->GetFirstSubnode();
+    while (node)
     {
-        return (new KeyStructure);
+        if ((node->GetBaseStructureType() == kStructureNode) && (!static_cast<NodeStructure*>(node)->GetNodeName().empty()))
+        {
+            AddNamedNode(static_cast<NodeStructure*>(node));
+        }
+
+        node = node->GetNextNode(root);
     }
 
-    if (identifier == "Time")
+    Structure* structure = GetRootStructure()->GetFirstSubnode();
+    while (structure)
     {
-        return (new TimeStructure);
+        if (structure->GetBaseStructureType() == kStructureNode)
+        {
+            static_cast<NodeStructure*>(structure)->UpdateNodeTransforms(this);
+        }
+
+        structure = structure->GetNextSubnode();
     }
 
-    if (identifier == "Value")
+    UpdateSkeletonPalettes();
+    UpdateNodeBounds();
+}
+
+bool OpenGexDataDescription::GetStepSubstructureFlag(const Structure* structure)
+{
+    // These structures call the base ProcessData() before doing anything else, so processing their substructures
+    // as separate steps and then the structure itself gives the same order as the one-shot path.
+
+    StructureType type = structure->GetStructureType();
+    return ((structure->GetBaseStructureType() == kStructureNode) || (type == kStructureGeometryObject) || (type == kStructureMesh));
+}
+
+Structure* OpenGexDataDescription::GetFirstStepStructure(Structure* structure)
+{
+    // Returns the first structure to process in a post-order walk that only descends into stepped structures.
+
+    while ((structure) && (GetStepSubstructureFlag(structure)) && (structure->GetFirstSubnode()))
     {
-        return (new ValueStructure);
+        structure = structure->GetFirstSubnode();
     }
 
-    if (identifier == "Track")
+    return (structure);
+}
+
+DataResult OpenGexDataDescription::ProcessStep(void)
+{
+    // Each step does the same work as one iteration of a loop in the one-shot path, in the same order.
+
+    if (processStage == kProcessStageStructures)
     {
-        return (new TrackStructure);
+        if (processStructure)
+        {
+            Structure* structure = processStructure;
+
+            // After the last substructure, the next step is the super node, whose substructures have all been processed.
+
+            Structure* next = structure->GetNextSubnode();
+            if (next)
+            {
+                processStructure = GetFirstStepStructure(next);
+            }
+            else
+            {
+                Structure* superNode = structure->GetSuperNode();
+                processStructure = (superNode != GetRootStructure()) ? superNode : nullptr;
+            }
+
+            processedParent = (GetStepSubstructureFlag(structure)) ? structure : nullptr;
+            DataResult result = structure->ProcessData(this);
+            processedParent = nullptr;
+
+            return (result);
+        }
+
+        processStage = kProcessStageMeshes;
+        processMeshIterator = meshList.begin();
+        processMeshCount = int32(meshList.size());
+
+        if (loadMonitor)
+        {
+            loadMonitor->SetLoadStage(kLoadStageMeshes);
+            loadMonitor->SetMeshCount((processFlags != 0) ? processMeshCount : 0);
+        }
     }
+    else if (processStage == kProcessStageMeshes)
+    {
+        if ((processFlags != 0) && (processMeshIterator != meshList.end()))
+        {
+            if ((loadMonitor) && (loadMonitor->GetCancelFlag()))
+            {
+                return (kDataOpenGexLoadCancelled);
+            }
 
-    if (identifier == "Animation")
+            DataResult result = (*processMeshIterator)->ProcessMesh(this, processFlags, threadPool);
+            ++processMeshIterator;
+
+            if (loadMonitor)
+            {
+                loadMonitor->AddProcessedMesh();
+            }
+
+            return (result);
+        }
+
+        if ((processFlags & kProcessGenerateLods) && (processMeshCount != 0))
+        {
+            // Generated meshes are appended to the mesh list, so only the meshes that were processed are visited.
+
+            auto iterator = meshList.begin();
+            for (machine a = 0; a < processMeshCount; a++)
+            {
+                (*iterator++)->AttachGeneratedMeshes(this);
+            }
+        }
+
+        if (loadMonitor)
+        {
+            loadMonitor->SetLoadStage(kLoadStageFinish);
+        }
+
+        processStage = kProcessStageMorphTargets;
+        processMeshIterator = meshList.begin();
+    }
+    else if (processStage == kProcessStageMorphTargets)
     {
-        return (new AnimationStructure);
+        if (processMeshIterator != meshList.end())
+        {
+            (*processMeshIterator++)->BuildMorphTargets(this);
+        }
+        else
+        {
+            processStage = kProcessStageFinish;
+        }
     }
-
-    if (identifier == "Clip")
+    else if (processStage == kProcessStageFinish)
     {
-        return (new ClipStructure);
+        FinishProcessing();
+        processStage = kProcessStageDone;
     }
 
-    return (nullptr);
+    return (kDataOkay);
 }
 
-bool OpenGexDataDescription::ValidateTopLevelStructure(const Structure* structure) const
+DataResult OpenGexDataDescription::ProcessDataSlice(float timeBudget)
 {
-    StructureType type = structure->GetBaseStructureType();
-    if ((type == kStructureNode) || (type == kStructureObject))
+    OPENGEX_PROFILE_ZONE("OpenGexDataDescription::ProcessDataSlice");
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    while (processStage != kProcessStageDone)
     {
-        return (true);
+        DataResult result = ProcessStep();
+        if (result != kDataOkay)
+        {
+            processStage = kProcessStageDone;
+            return (result);
+        }
+
+        if ((processStage != kProcessStageDone) && (std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count() >= timeBudget))
+        {
+            return (kDataOpenGexProcessingIncomplete);
+        }
     }
 
-    type = structure->GetStructureType();
-    return ((type == kStructureMetric) || (type == kStructureMaterial) || (type == kStructureClip));
+    return (kDataOkay);
 }
 
-DataResult OpenGexDataDescription::ProcessData(void)
+DataResult OpenGexDataDescription::ProcessMeshes(void)
 {
-    colorInitFlag = false;
+    OPENGEX_PROFILE_ZONE("OpenGexDataDescription::ProcessMeshes");
 
-    DataResult result = DataDescription::ProcessData();
-    if (result == kDataOkay)
+    if ((processFlags == 0) || (meshList.empty()))
     {
-        Structure* structure = GetRootStructure()->GetFirstSubnode();
-        while (structure)
+        return (kDataOkay);
+    }
+
+    // Each mesh only touches its own substructures, so meshes are processed in parallel.
+    // Results are kept per mesh so that the reported error doesn't depend on thread timing.
+
+    int32           meshCount = int32(meshList.size());
+    MeshStructure** meshArray = new MeshStructure*[meshCount];
+    DataResult*     resultArray = new DataResult[meshCount];
+
+    int32 meshIndex = 0;
+    for (MeshStructure* meshStructure : meshList)
+    {
+        meshArray[meshIndex++] = meshStructure;
+    }
+
+    if (loadMonitor)
+    {
+        loadMonitor->SetLoadStage(kLoadStageMeshes);
+        loadMonitor->SetMeshCount(meshCount);
+    }
+
+    // Without a thread pool, meshes are processed one at a time on the calling thread.
+
+    ProcessFlags flags = processFlags;
+    ThreadPool*  pool = threadPool;
+    LoadMonitor* monitor = loadMonitor;
+
+    ParallelForBlocks(pool, meshCount, 1, [this, flags, pool, monitor, meshArray, resultArray](int32 begin, int32 end) {
+        for (machine index = begin; index < end; index++)
         {
-            if (structure->GetBaseStructureType() == kStructureNode)
+            if ((monitor) && (monitor->GetCancelFlag()))
             {
-                static_cast<NodeStructure*>(structure)->UpdateNodeTransforms(this);
+                resultArray[index] = kDataOpenGexLoadCancelled;
+                continue;
             }
 
-            structure = structure->GetNextSubnode();
+            resultArray[index] = meshArray[index]->ProcessMesh(this, flags, pool);
+            if (monitor)
+            {
+                monitor->AddProcessedMesh();
+            }
+        }
+    });
+
+    DataResult result = kDataOkay;
+    for (machine a = 0; a < meshCount; a++)
+    {
+        if (resultArray[a] != kDataOkay)
+        {
+            result = resultArray[a];
+            break;
+        }
+    }
+
+    if ((result == kDataOkay) && (flags & kProcessGenerateLods))
+    {
+        // Generated meshes are added to the structure tree here, after all worker threads are done with it.
+
+        for (machine a = 0; a < meshCount; a++)
+        {
+            meshArray[a]->AttachGeneratedMeshes(this);
         }
     }
 
+    delete[] resultArray;
+    delete[] meshArray;
     return (result);
 }
 
@@ -4206,6 +6689,186 @@ void OpenGexDataDescription::ConvertColor(ColorRGB& color)
     v = colorMatrix * v;
 }
 
+void OpenGexDataDescription::BuildSkeletons(void)
+{
+    OPENGEX_PROFILE_ZONE("OpenGexDataDescription::BuildSkeletons");
+
+    // Every skin has its own Skeleton structure, but skins bound to the same bones with the same bind pose
+    // are given the same runtime skeleton so that its palette is only calculated once per update.
+
+    std::unordered_multimap<uint32, Skeleton*> skeletonMap;
+
+    for (MeshStructure* meshStructure : meshList)
+    {
+        SkinStructure* skinStructure = meshStructure->GetSkinStructure();
+        if (!skinStructure)
+        {
+            continue;
+        }
+
+        const SkeletonStructure*        skeletonStructure = skinStructure->GetSkeletonStructure();
+        const BoneNodeStructure* const* boneNodeArray = skeletonStructure->GetBoneRefArrayStructure()->GetBoneNodeArray();
+        const TransformStructure*       transformStructure = skeletonStructure->GetTransformStructure();
+        int32                           boneCount = transformStructure->GetTransformCount();
+
+        const Transform3D** boneTransformArray = new const Transform3D*[Max(boneCount, 1)];
+        Transform3D*        inverseBindArray = new Transform3D[Max(boneCount, 1)];
+
+        for (machine a = 0; a < boneCount; a++)
+        {
+            Transform3D bindTransform = transformStructure->GetTransform(int32(a));
+            AdjustTransform(bindTransform);
+
+            boneTransformArray[a] = &boneNodeArray[a]->GetWorldTransform();
+            inverseBindArray[a] = Inverse(bindTransform) * skinStructure->GetSkinTransform();
+        }
+
+        Skeleton* skeleton = new Skeleton(boneCount, boneTransformArray, inverseBindArray);
+        Skeleton* sharedSkeleton = nullptr;
+
+        delete[] inverseBindArray;
+        delete[] boneTransformArray;
+
+        auto range = skeletonMap.equal_range(skeleton->GetHashValue());
+        for (auto iterator = range.first; iterator != range.second; ++iterator)
+        {
+            if (iterator->second->Matches(skeleton))
+            {
+                sharedSkeleton = iterator->second;
+                break;
+            }
+        }
+
+        if (sharedSkeleton)
+        {
+            delete skeleton;
+            skeleton = sharedSkeleton;
+        }
+        else
+        {
+            skeletonMap.emplace(skeleton->GetHashValue(), skeleton);
+            skeletonList.push_back(skeleton);
+        }
+
+        skinStructure->SetSkeleton(skeleton);
+    }
+}
+
+void OpenGexDataDescription::GetMemoryReport(MemoryReport* report) const
+{
+    *report = MemoryReport{};
+    MemoryAccount account(report);
+
+    const Structure* root = GetRootStructure();
+    const Structure* structure = root->GetFirstSubnode();
+    while (structure)
+    {
+        // Data belongs to the nearest enclosing mesh, if any.
+
+        const MeshStructure* meshStructure = nullptr;
+        for (const Structure* node = structure; node != root; node = node->GetSuperNode())
+        {
+            if (node->GetStructureType() == kStructureMesh)
+            {
+                meshStructure = static_cast<const MeshStructure*>(node);
+                break;
+            }
+        }
+
+        switch (structure->GetStructureType())
+        {
+        case kStructureVertexArray:
+
+            static_cast<const VertexArrayStructure*>(structure)->AccountMemory(&account, meshStructure);
+            break;
+
+        case kStructureIndexArray:
+
+            static_cast<const IndexArrayStructure*>(structure)->AccountMemory(&account, meshStructure);
+            break;
+
+        case kStructureBoneRefArray:
+
+            static_cast<const BoneRefArrayStructure*>(structure)->AccountMemory(&account, meshStructure);
+            break;
+
+        case kStructureBoneCountArray:
+
+            static_cast<const BoneCountArrayStructure*>(structure)->AccountMemory(&account, meshStructure);
+            break;
+
+        case kStructureBoneIndexArray:
+
+            static_cast<const BoneIndexArrayStructure*>(structure)->AccountMemory(&account, meshStructure);
+            break;
+
+        case kStructureBoneWeightArray:
+
+            static_cast<const BoneWeightArrayStructure*>(structure)->AccountMemory(&account, meshStructure);
+            break;
+
+        case kStructureSkin:
+
+            static_cast<const SkinStructure*>(structure)->AccountMemory(&account, meshStructure);
+            break;
+
+        case kStructureMesh:
+
+            static_cast<const MeshStructure*>(structure)->AccountMemory(&account);
+            break;
+
+        default:
+        {
+            // Primitive data in the structures handled above is accounted for by those structures.
+
+            if (structure->GetBaseStructureType() == kStructurePrimitive)
+            {
+                StructureType type = structure->GetSuperNode()->GetStructureType();
+                if ((type != kStructureVertexArray) && (type != kStructureIndexArray) && (type != kStructureBoneRefArray) && (type != kStructureBoneCountArray) &&
+                    (type != kStructureBoneIndexArray) && (type != kStructureBoneWeightArray))
+                {
+                    account.AddParserData(type, meshStructure, std::string_view(), GetPrimitiveDataSize(structure), false);
+                }
+            }
+
+            break;
+        }
+        }
+
+        structure = structure->GetNextNode(root);
+    }
+
+    for (const Skeleton* skeleton : skeletonList)
+    {
+        uint64 size = uint64(skeleton->GetBoneCount()) * (sizeof(const Transform3D*) + sizeof(Transform3D) * 2);
+        account.AddProcessedData(kStructureSkeleton, nullptr, "skeleton", size, false);
+    }
+}
+
+CompactScene* OpenGexDataDescription::CreateCompactScene(void)
+{
+    OPENGEX_PROFILE_ZONE("OpenGexDataDescription::CreateCompactScene");
+
+    CompactScene* scene = new CompactScene(this);
+
+    // Everything below refers to structures in the tree, so it's released along with the tree.
+
+    animationList.clear();
+    meshList.clear();
+    geometryNodeList.clear();
+    nameIndex.Clear();
+
+    GetRootStructure()->PurgeSubtree();
+
+    for (Skeleton* skeleton : skeletonList)
+    {
+        delete skeleton;
+    }
+
+    skeletonList.clear();
+    return (scene);
+}
+
 Range<float> OpenGexDataDescription::GetAnimationTimeRange(int32 clip) const
 {
     Range<float> timeRange(0.0F, 0.0F);
@@ -4239,6 +6902,8 @@ Range<float> OpenGexDataDescription::GetAnimationTimeRange(int32 clip) const
 
 void OpenGexDataDescription::UpdateAnimation(int32 clip, float time) const
 {
+    OPENGEX_PROFILE_ZONE("OpenGexDataDescription::UpdateAnimation");
+
     time /= timeScale;
 
     for (const AnimationStructure* animationStructure : animationList)
@@ -4258,4 +6923,29 @@ void OpenGexDataDescription::UpdateAnimation(int32 clip, float time) const
         }
         structure = structure->GetNextSubnode();
     }
+
+    UpdateSkeletonPalettes();
+    UpdateNodeBounds();
+}
+
+void OpenGexDataDescription::UpdateNodeBounds(void) const
+{
+    OPENGEX_PROFILE_ZONE("OpenGexDataDescription::UpdateNodeBounds");
+
+    // Skinned nodes depend on bone transforms anywhere in the scene, so bounds are updated after all transforms.
+
+    for (GeometryNodeStructure* geometryNodeStructure : geometryNodeList)
+    {
+        geometryNodeStructure->UpdateWorldBounds();
+    }
+}
+
+void OpenGexDataDescription::UpdateSkeletonPalettes(void) const
+{
+    OPENGEX_PROFILE_ZONE("OpenGexDataDescription::UpdateSkeletonPalettes");
+
+    for (Skeleton* skeleton : skeletonList)
+    {
+        skeleton->UpdatePalette();
+    }
 }
@@ -9,6 +9,26 @@
 #ifndef OpenGEX_h
 #define OpenGEX_h
 
+#include "OpenGEXArena.h"
+#include "OpenGEXBatch.h"
+#include "OpenGEXBounds.h"
+#include "OpenGEXCompression.h"
+#include "OpenGEXFileReader.h"
+#include "OpenGEXLoader.h"
+#include "OpenGEXMemory.h"
+#include "OpenGEXMeshlet.h"
+#include "OpenGEXMorph.h"
+#include "OpenGEXNameIndex.h"
+#include "OpenGEXProfile.h"
+#include "OpenGEXScene.h"
+#include "OpenGEXSimplify.h"
+#include "OpenGEXSkeleton.h"
+#include "OpenGEXSkinPack.h"
+#include "OpenGEXSkinning.h"
+#include "OpenGEXTangent.h"
+#include "OpenGEXThreadPool.h"
+#include "OpenGEXVertexCache.h"
+#include "OpenGEXWeld.h"
 #include "TSColor.h"
 #include "TSOpenDDL.h"
 #include "TSQuaternion.h"
@@ -101,7 +121,35 @@ namespace OpenGEX
         kDataOpenGexInvalidKeyKind = 'ivkk',
         kDataOpenGexInvalidCurveType = 'ivct',
         kDataOpenGexKeyCountMismatch = 'kycm',
-        kDataOpenGexEmptyKeyStructure = 'emky'
+        kDataOpenGexEmptyKeyStructure = 'emky',
+        kDataOpenGexBonePaletteUnsupported = 'bpus',
+        kDataOpenGexLoadCancelled = 'cncl',
+        kDataOpenGexProcessingIncomplete = 'incp',
+        kDataOpenGexFileUnreadable = 'furd',
+        kDataOpenGexCompressionUnsupported = 'cmus',
+        kDataOpenGexDecompressionFailed = 'dcmp'
+    };
+
+    typedef uint32 ProcessFlags;
+
+    enum : ProcessFlags
+    {
+        kProcessOptimizeVertexCache = 1 << 0,
+        kProcessNarrowIndexArrays = 1 << 1,
+        kProcessBuildMeshlets = 1 << 2,
+        kProcessGenerateLods = 1 << 3,
+        kProcessGenerateTangents = 1 << 4,
+        kProcessWeldVertices = 1 << 5,
+        kProcessPackSkinInfluences = 1 << 6
+    };
+
+    enum
+    {
+        kProcessStageStructures,
+        kProcessStageMeshes,
+        kProcessStageMorphTargets,
+        kProcessStageFinish,
+        kProcessStageDone
     };
 
     inline std::string DataResultToString(DataResult result)
@@ -172,6 +220,18 @@ namespace OpenGEX
             return "Key count mismatch";
         case kDataOpenGexEmptyKeyStructure:
             return "Empty key structure";
+        case kDataOpenGexBonePaletteUnsupported:
+            return "Bone palette unsupported";
+        case kDataOpenGexLoadCancelled:
+            return "Load cancelled";
+        case kDataOpenGexProcessingIncomplete:
+            return "Processing incomplete";
+        case kDataOpenGexFileUnreadable:
+            return "File unreadable";
+        case kDataOpenGexCompressionUnsupported:
+            return "Compression unsupported";
+        case kDataOpenGexDecompressionFailed:
+            return "Decompression failed";
         default:
             return Terathon::DataResultToString(result);
         }
@@ -182,6 +242,7 @@ namespace OpenGEX
     class GeometryObjectStructure;
     class LightObjectStructure;
     class CameraObjectStructure;
+    class GeometryNodeStructure;
     class OpenGexDataDescription;
 
     class OpenGexStructure : public Structure
@@ -191,6 +252,8 @@ namespace OpenGEX
 
     public:
         ~OpenGexStructure();
+
+        DataResult ProcessData(DataDescription* dataDescription) override;
     };
 
     class MetricStructure : public OpenGexStructure
@@ -427,6 +490,7 @@ namespace OpenGEX
         Transform3D nodeTransform;
         Transform3D objectTransform;
         Transform3D inverseObjectTransform;
+        Transform3D worldTransform;
 
         virtual const ObjectStructure* GetObjectStructure(void) const;
 
@@ -439,6 +503,11 @@ namespace OpenGEX
         NodeStructure();
         ~NodeStructure();
 
+        const std::string& GetNodeName(void) const
+        {
+            return (nodeName);
+        }
+
         const Transform3D& GetNodeTransform(void) const
         {
             return (nodeTransform);
@@ -454,6 +523,11 @@ namespace OpenGEX
             return (inverseObjectTransform);
         }
 
+        const Transform3D& GetWorldTransform(void) const
+        {
+            return (worldTransform);
+        }
+
         bool       ValidateSubstructure(const DataDescription* dataDescription, const Structure* structure) const override;
         DataResult ProcessData(DataDescription* dataDescription) override;
 
@@ -478,6 +552,11 @@ namespace OpenGEX
         Array<const MaterialStructure*, 4> materialStructureArray;
         std::list<MorphWeightStructure*>   morphWeightList;
 
+        std::unordered_map<uint32, const MorphWeightStructure*> morphWeightMap;
+
+        BoundingBox    worldBoundingBox;
+        BoundingSphere worldBoundingSphere;
+
         const ObjectStructure* GetObjectStructure(void) const override;
 
     public:
@@ -489,6 +568,16 @@ namespace OpenGEX
             return (geometryObjectStructure);
         }
 
+        int32 GetMaterialCount(void) const
+        {
+            return (materialStructureArray.GetArrayElementCount());
+        }
+
+        const MaterialStructure* GetMaterialStructure(int32 index) const
+        {
+            return (materialStructureArray[index]);
+        }
+
         bool       ValidateProperty(const DataDescription* dataDescription, std::string_view identifier, DataType* type, void** value) override;
         bool       ValidateSubstructure(const DataDescription* dataDescription, const Structure* structure) const override;
         DataResult ProcessData(DataDescription* dataDescription) override;
@@ -499,6 +588,18 @@ namespace OpenGEX
         {
             return morphWeightList;
         }
+
+        const BoundingBox& GetWorldBoundingBox(void) const
+        {
+            return (worldBoundingBox);
+        }
+
+        const BoundingSphere& GetWorldBoundingSphere(void) const
+        {
+            return (worldBoundingSphere);
+        }
+
+        void UpdateWorldBounds(void);
     };
 
     class LightNodeStructure : public NodeStructure
@@ -514,6 +615,11 @@ namespace OpenGEX
         LightNodeStructure();
         ~LightNodeStructure();
 
+        const LightObjectStructure* GetLightObjectStructure(void) const
+        {
+            return (lightObjectStructure);
+        }
+
         bool       ValidateProperty(const DataDescription* dataDescription, std::string_view identifier, DataType* type, void** value) override;
         bool       ValidateSubstructure(const DataDescription* dataDescription, const Structure* structure) const override;
         DataResult ProcessData(DataDescription* dataDescription) override;
@@ -530,6 +636,11 @@ namespace OpenGEX
         CameraNodeStructure();
         ~CameraNodeStructure();
 
+        const CameraObjectStructure* GetCameraObjectStructure(void) const
+        {
+            return (cameraObjectStructure);
+        }
+
         bool       ValidateSubstructure(const DataDescription* dataDescription, const Structure* structure) const override;
         DataResult ProcessData(DataDescription* dataDescription) override;
     };
@@ -587,6 +698,15 @@ namespace OpenGEX
         bool       ValidateProperty(const DataDescription* dataDescription, std::string_view identifier, DataType* type, void** value) override;
         bool       ValidateSubstructure(const DataDescription* dataDescription, const Structure* structure) const override;
         DataResult ProcessData(DataDescription* dataDescription) override;
+
+        void RemapVertices(int32 count, const uint32* vertexMap);
+        void CopyVertexArray(const VertexArrayStructure* vertexArrayStructure, int32 count, const uint32* vertexMap);
+
+        // Replaces the contents with a new, uninitialized array of float components that the caller fills in.
+
+        float* AllocateVertexArray(std::string_view attrib, int32 count, int32 components);
+
+        void AccountMemory(MemoryAccount* account, const MeshStructure* meshStructure) const;
     };
 
     class IndexArrayStructure : public OpenGexStructure
@@ -597,6 +717,7 @@ namespace OpenGEX
         std::string frontFace;
 
         int32       indexCount;
+        int32       indexSize;
         char*       arrayStorage;
         const void* indexArrayData;
 
@@ -624,6 +745,16 @@ namespace OpenGEX
             return (frontFace);
         }
 
+        int32 GetIndexSize(void) const
+        {
+            return (indexSize);
+        }
+
+        DataType GetIndexType(void) const
+        {
+            return ((indexSize == 1) ? kDataUInt8 : ((indexSize == 2) ? kDataUInt16 : ((indexSize == 4) ? kDataUInt32 : kDataUInt64)));
+        }
+
         const void* GetIndexArrayData(void) const
         {
             return (indexArrayData);
@@ -632,6 +763,13 @@ namespace OpenGEX
         bool       ValidateProperty(const DataDescription* dataDescription, std::string_view identifier, DataType* type, void** value) override;
         bool       ValidateSubstructure(const DataDescription* dataDescription, const Structure* structure) const override;
         DataResult ProcessData(DataDescription* dataDescription) override;
+
+        void ReadIndexArray(uint32* indexArray) const;
+        void WriteIndexArray(const uint32* indexArray);
+        void NarrowIndexArray(int32 vertexCount, int32 minIndexSize);
+        void CopyIndexArray(const IndexArrayStructure* indexArrayStructure, int32 count, const uint32* indexArray);
+
+        void AccountMemory(MemoryAccount* account, const MeshStructure* meshStructure) const;
     };
 
     class BoneRefArrayStructure : public OpenGexStructure
@@ -656,6 +794,8 @@ namespace OpenGEX
 
         bool       ValidateSubstructure(const DataDescription* dataDescription, const Structure* structure) const override;
         DataResult ProcessData(DataDescription* dataDescription) override;
+
+        void AccountMemory(MemoryAccount* account, const MeshStructure* meshStructure) const;
     };
 
     class BoneCountArrayStructure : public OpenGexStructure
@@ -681,6 +821,10 @@ namespace OpenGEX
 
         bool       ValidateSubstructure(const DataDescription* dataDescription, const Structure* structure) const override;
         DataResult ProcessData(DataDescription* dataDescription) override;
+
+        void SetBoneCountArray(int32 count, uint16* array);
+
+        void AccountMemory(MemoryAccount* account, const MeshStructure* meshStructure) const;
     };
 
     class BoneIndexArrayStructure : public OpenGexStructure
@@ -706,6 +850,10 @@ namespace OpenGEX
 
         bool       ValidateSubstructure(const DataDescription* dataDescription, const Structure* structure) const override;
         DataResult ProcessData(DataDescription* dataDescription) override;
+
+        void SetBoneIndexArray(int32 count, uint16* array);
+
+        void AccountMemory(MemoryAccount* account, const MeshStructure* meshStructure) const;
     };
 
     class BoneWeightArrayStructure : public OpenGexStructure
@@ -713,6 +861,7 @@ namespace OpenGEX
     private:
         int32        boneWeightCount;
         const float* boneWeightArray;
+        float*       arrayStorage;
 
     public:
         BoneWeightArrayStructure();
@@ -730,6 +879,10 @@ namespace OpenGEX
 
         bool       ValidateSubstructure(const DataDescription* dataDescription, const Structure* structure) const override;
         DataResult ProcessData(DataDescription* dataDescription) override;
+
+        void SetBoneWeightArray(int32 count, float* array);
+
+        void AccountMemory(MemoryAccount* account, const MeshStructure* meshStructure) const;
     };
 
     class SkeletonStructure : public OpenGexStructure
@@ -761,10 +914,15 @@ namespace OpenGEX
     private:
         Transform3D skinTransform;
 
-        const SkeletonStructure*        skeletonStructure;
-        const BoneCountArrayStructure*  boneCountArrayStructure;
-        const BoneIndexArrayStructure*  boneIndexArrayStructure;
-        const BoneWeightArrayStructure* boneWeightArrayStructure;
+        const SkeletonStructure*  skeletonStructure;
+        BoneCountArrayStructure*  boneCountArrayStructure;
+        BoneIndexArrayStructure*  boneIndexArrayStructure;
+        BoneWeightArrayStructure* boneWeightArrayStructure;
+
+        char*          packedStorage;
+        PackedSkinData packedSkinData;
+
+        const Skeleton* skeleton;
 
     public:
         SkinStructure();
@@ -775,8 +933,54 @@ namespace OpenGEX
             return (skinTransform);
         }
 
+        const SkeletonStructure* GetSkeletonStructure(void) const
+        {
+            return (skeletonStructure);
+        }
+
+        const BoneCountArrayStructure* GetBoneCountArrayStructure(void) const
+        {
+            return (boneCountArrayStructure);
+        }
+
+        const BoneIndexArrayStructure* GetBoneIndexArrayStructure(void) const
+        {
+            return (boneIndexArrayStructure);
+        }
+
+        const BoneWeightArrayStructure* GetBoneWeightArrayStructure(void) const
+        {
+            return (boneWeightArrayStructure);
+        }
+
+        // The runtime skeleton is assigned after the data has been processed, and it may be shared with other skins.
+
+        const Skeleton* GetSkeleton(void) const
+        {
+            return (skeleton);
+        }
+
+        void SetSkeleton(const Skeleton* runtimeSkeleton)
+        {
+            skeleton = runtimeSkeleton;
+        }
+
+        // The packed influences are only available after the kProcessPackSkinInfluences stage. Otherwise, the vertex count is zero.
+
+        const PackedSkinData& GetPackedSkinData(void) const
+        {
+            return (packedSkinData);
+        }
+
         bool       ValidateSubstructure(const DataDescription* dataDescription, const Structure* structure) const override;
         DataResult ProcessData(DataDescription* dataDescription) override;
+
+        void RemapVertices(int32 count, const uint32* vertexMap);
+        void CopySkin(const SkinStructure* skinStructure, int32 count, const uint32* vertexMap);
+
+        DataResult PackInfluences(const SkinPackFormat& format, ThreadPool* threadPool);
+
+        void AccountMemory(MemoryAccount* account, const MeshStructure* meshStructure) const;
     };
 
     class MorphStructure : public OpenGexStructure
@@ -823,10 +1027,42 @@ namespace OpenGEX
     class MeshStructure : public OpenGexStructure
     {
     private:
-        uint32                          meshLevel;
-        std::string                     meshPrimitive;
-        std::list<IndexArrayStructure*> indexArrayList;
-        SkinStructure*                  skinStructure;
+        uint32                           meshLevel;
+        std::string                      meshPrimitive;
+        std::list<VertexArrayStructure*> vertexArrayList;
+        std::list<IndexArrayStructure*>  indexArrayList;
+        SkinStructure*                   skinStructure;
+
+        WeldStatistics        weldStatistics;
+        VertexCacheStatistics originalCacheStatistics;
+        VertexCacheStatistics optimizedCacheStatistics;
+
+        char*       meshletStorage;
+        MeshletData meshletData;
+
+        float                     lodError;
+        std::list<MeshStructure*> generatedMeshList;
+
+        BoundingBox    boundingBox;
+        BoundingSphere boundingSphere;
+        int32          boneBoundsCount;
+        BoundingBox*   boneBoundsArray;
+
+        int32           morphTargetCount;
+        MorphTarget*    morphTargetArray;
+        MorphRun*       morphRunStorage;
+        float*          morphDeltaStorage;
+        MorphStatistics morphStatistics;
+
+        void CalculateBounds(const OpenGexDataDescription* dataDescription);
+        void CopyBounds(const MeshStructure* meshStructure);
+
+        DataResult     WeldVertices(const OpenGexDataDescription* dataDescription, ThreadPool* threadPool);
+        DataResult     GenerateTangents(ThreadPool* threadPool);
+        DataResult     OptimizeVertexCache(int32 cacheSize);
+        DataResult     GenerateMeshlets(int32 maxVertexCount, int32 maxTriangleCount);
+        DataResult     GenerateLods(const OpenGexDataDescription* dataDescription, ProcessFlags flags, ThreadPool* threadPool);
+        MeshStructure* CreateLodMesh(uint32 level, uint32* indexArray, const uint32* groupArray, int32 indexCount, int32 vertexCount, float error) const;
 
     public:
         typedef uint32 KeyType;
@@ -839,6 +1075,16 @@ namespace OpenGEX
             return (meshLevel);
         }
 
+        const std::string& GetMeshPrimitive(void) const
+        {
+            return (meshPrimitive);
+        }
+
+        const std::list<VertexArrayStructure*>* GetVertexArrayList(void) const
+        {
+            return (&vertexArrayList);
+        }
+
         const std::list<IndexArrayStructure*>* GetIndexArrayList(void) const
         {
             return (&indexArrayList);
@@ -849,9 +1095,98 @@ namespace OpenGEX
             return (skinStructure);
         }
 
+        const WeldStatistics& GetWeldStatistics(void) const
+        {
+            return (weldStatistics);
+        }
+
+        const VertexCacheStatistics& GetOriginalCacheStatistics(void) const
+        {
+            return (originalCacheStatistics);
+        }
+
+        const VertexCacheStatistics& GetOptimizedCacheStatistics(void) const
+        {
+            return (optimizedCacheStatistics);
+        }
+
+        const MeshletData& GetMeshletData(void) const
+        {
+            return (meshletData);
+        }
+
+        float GetLodError(void) const
+        {
+            return (lodError);
+        }
+
+        const BoundingBox& GetBoundingBox(void) const
+        {
+            return (boundingBox);
+        }
+
+        const BoundingSphere& GetBoundingSphere(void) const
+        {
+            return (boundingSphere);
+        }
+
+        // Bone bounds are boxes in the space of each skeleton bone at bind time, enclosing every vertex,
+        // including morph targets, that the bone influences. Bones without influences have empty boxes.
+
+        int32 GetBoneBoundsCount(void) const
+        {
+            return (boneBoundsCount);
+        }
+
+        const BoundingBox* GetBoneBoundsArray(void) const
+        {
+            return (boneBoundsArray);
+        }
+
+        // Morph targets are stored as deltas from their base positions and normals, and they are only available
+        // after the data has been processed. Targets changing at most the sparse threshold fraction of the vertices
+        // are stored sparsely.
+
+        int32 GetMorphTargetCount(void) const
+        {
+            return (morphTargetCount);
+        }
+
+        const MorphTarget* GetMorphTargetArray(void) const
+        {
+            return (morphTargetArray);
+        }
+
+        const MorphStatistics& GetMorphStatistics(void) const
+        {
+            return (morphStatistics);
+        }
+
         bool       ValidateProperty(const DataDescription* dataDescription, std::string_view identifier, DataType* type, void** value) override;
         bool       ValidateSubstructure(const DataDescription* dataDescription, const Structure* structure) const override;
         DataResult ProcessData(DataDescription* dataDescription) override;
+
+        const VertexArrayStructure* FindVertexArray(std::string_view attrib, uint32 index = 0, uint32 morph = 0) const;
+        int32                       GetVertexCount(void) const;
+
+        // Skins the base positions, normals, and tangents of the mesh into arrays of three floats per vertex.
+        // Any output array can be null, and an attribute that the mesh doesn't have is left untouched.
+        // The method is kSkinningLinearBlend or kSkinningDualQuaternion. Returns false if the mesh has no skin or its vertex counts don't match.
+
+        bool SkinVertices(const Transform3D* paletteArray, int32 paletteCount, float* positionArray, float* normalArray, float* tangentArray, ThreadPool* threadPool,
+                          int32 method = kSkinningLinearBlend) const;
+
+        // Blends the morph targets of the mesh using the weights of a geometry node into arrays of three floats
+        // per vertex, including the weight of morph 0 when the node has one. Either output array can be null.
+        // Returns false if the mesh has no three-component base positions.
+
+        bool BlendMorphTargets(const GeometryNodeStructure* geometryNodeStructure, float* positionArray, float* normalArray, ThreadPool* threadPool) const;
+
+        DataResult ProcessMesh(const OpenGexDataDescription* dataDescription, ProcessFlags flags, ThreadPool* threadPool);
+        void       AttachGeneratedMeshes(OpenGexDataDescription* dataDescription);
+        void       BuildMorphTargets(const OpenGexDataDescription* dataDescription);
+
+        void AccountMemory(MemoryAccount* account) const;
     };
 
     class ObjectStructure : public OpenGexStructure
@@ -890,6 +1225,9 @@ namespace OpenGEX
         bool       ValidateProperty(const DataDescription* dataDescription, std::string_view identifier, DataType* type, void** value) override;
         bool       ValidateSubstructure(const DataDescription* dataDescription, const Structure* structure) const override;
         DataResult ProcessData(DataDescription* dataDescription) override;
+
+        void                 InsertMesh(MeshStructure* meshStructure);
+        const MeshStructure* GetBaseMesh(void) const;
     };
 
     class LightObjectStructure : public ObjectStructure
@@ -902,6 +1240,11 @@ namespace OpenGEX
         LightObjectStructure();
         ~LightObjectStructure();
 
+        const std::string& GetTypeString(void) const
+        {
+            return (typeString);
+        }
+
         bool GetShadowFlag(void) const
         {
             return (shadowFlag);
@@ -1379,8 +1722,43 @@ namespace OpenGEX
         bool     colorInitFlag;
         Matrix3D colorMatrix;
 
-        std::list<AnimationStructure*> animationList;
+        ProcessFlags processFlags;
+        int32        vertexCacheSize;
+        int32        minIndexSize;
+        int32        meshletVertexCount;
+        int32        meshletTriangleCount;
+        int32        lodCount;
+        float        lodRatio;
+        ThreadPool*  threadPool;
+        LoadMonitor* loadMonitor;
+
+        bool                                incrementalFlag;
+        int32                               processStage;
+        Structure*                          processStructure;
+        const Structure*                    processedParent;
+        std::list<MeshStructure*>::iterator processMeshIterator;
+        int32                               processMeshCount;
+
+        SkinPackFormat                         skinPackFormat;
+        std::unordered_map<std::string, float> weldEpsilonMap;
+        float                                  morphSparseThreshold;
+
+        std::list<AnimationStructure*>    animationList;
+        std::list<MeshStructure*>         meshList;
+        std::list<GeometryNodeStructure*> geometryNodeList;
+        std::list<Skeleton*>              skeletonList;
+
+        NameIndex nameIndex;
+
+        DataResult ProcessMeshes(void);
+        void       BuildSkeletons(void);
+        void       FinishProcessing(void);
+        DataResult ProcessStep(void);
+
+        static bool       GetStepSubstructureFlag(const Structure* structure);
+        static Structure* GetFirstStepStructure(Structure* structure);
 
+    protected:
         DataResult ProcessData(void) override;
 
     public:
@@ -1477,6 +1855,164 @@ namespace OpenGEX
             whiteChromaticity = chromaticity;
         }
 
+        ProcessFlags GetProcessFlags(void) const
+        {
+            return (processFlags);
+        }
+
+        void SetProcessFlags(ProcessFlags flags)
+        {
+            processFlags = flags;
+        }
+
+        int32 GetVertexCacheSize(void) const
+        {
+            return (vertexCacheSize);
+        }
+
+        // The simulated cache size is clamped to [kVertexCacheMinSize, kVertexCacheMaxSize].
+
+        void SetVertexCacheSize(int32 size)
+        {
+            vertexCacheSize = Min(Max(size, int32(kVertexCacheMinSize)), int32(kVertexCacheMaxSize));
+        }
+
+        int32 GetMinIndexSize(void) const
+        {
+            return (minIndexSize);
+        }
+
+        void SetMinIndexSize(int32 size)
+        {
+            minIndexSize = size;
+        }
+
+        int32 GetMeshletVertexCount(void) const
+        {
+            return (meshletVertexCount);
+        }
+
+        int32 GetMeshletTriangleCount(void) const
+        {
+            return (meshletTriangleCount);
+        }
+
+        void SetMeshletSize(int32 vertexCount, int32 triangleCount)
+        {
+            meshletVertexCount = vertexCount;
+            meshletTriangleCount = triangleCount;
+        }
+
+        int32 GetLodCount(void) const
+        {
+            return (lodCount);
+        }
+
+        float GetLodRatio(void) const
+        {
+            return (lodRatio);
+        }
+
+        void SetLodChain(int32 count, float ratio)
+        {
+            lodCount = count;
+            lodRatio = ratio;
+        }
+
+        // The weld epsilon of an attribute is the size of the cells that its components are snapped to when
+        // vertices are compared. Attributes without an epsilon, including bone influences, must match exactly.
+
+        float GetWeldEpsilon(const std::string& attrib) const
+        {
+            auto iterator = weldEpsilonMap.find(attrib);
+            return ((iterator != weldEpsilonMap.end()) ? iterator->second : 0.0F);
+        }
+
+        void SetWeldEpsilon(const std::string& attrib, float epsilon)
+        {
+            weldEpsilonMap[attrib] = epsilon;
+        }
+
+        const SkinPackFormat& GetSkinPackFormat(void) const
+        {
+            return (skinPackFormat);
+        }
+
+        void SetSkinPackFormat(const SkinPackFormat& format)
+        {
+            skinPackFormat = format;
+        }
+
+        // Morph targets that change at most this fraction of the vertices in a mesh are stored sparsely.
+        // A threshold of zero stores every target densely.
+
+        float GetMorphSparseThreshold(void) const
+        {
+            return (morphSparseThreshold);
+        }
+
+        void SetMorphSparseThreshold(float threshold)
+        {
+            morphSparseThreshold = threshold;
+        }
+
+        // Meshes, and the work inside each mesh, are processed in parallel on the thread pool. Without one, all of the
+        // processing is done on the calling thread, so no threads are started for small loads.
+
+        ThreadPool* GetThreadPool(void) const
+        {
+            return (threadPool);
+        }
+
+        void SetThreadPool(ThreadPool* pool)
+        {
+            threadPool = pool;
+        }
+
+        // In incremental mode, ProcessText() only parses the text and prepares for processing, which is then done by calls
+        // to ProcessDataSlice(). Each call works until the time budget in milliseconds is used up, finishing at least one
+        // step, and returns kDataOpenGexProcessingIncomplete until the last step is done. Meshes are processed one at a
+        // time instead of in parallel, but the order of the work and the results are the same as in the one-shot path.
+        // A step can't be split, so the budget can be overrun by the largest step. While structures are processed, nodes,
+        // geometry objects, and meshes are stepped into, so a step is one of their substructures or the work that a node,
+        // geometry object, or mesh does after its substructures. Any other structure is one step together with everything
+        // inside it, and the largest of these is usually a single vertex or index array. Afterwards, a step is one mesh.
+
+        bool GetIncrementalFlag(void) const
+        {
+            return (incrementalFlag);
+        }
+
+        void SetIncrementalFlag(bool incremental)
+        {
+            incrementalFlag = incremental;
+        }
+
+        int32 GetProcessStage(void) const
+        {
+            return (processStage);
+        }
+
+        DataResult ProcessDataSlice(float timeBudget);
+
+        // Returns true while a structure is being processed by a step after its substructures were processed by earlier steps.
+        // The ProcessData() functions of structures that are stepped into then skip their substructures.
+
+        bool GetSubstructuresProcessed(const Structure* structure) const
+        {
+            return (structure == processedParent);
+        }
+
+        LoadMonitor* GetLoadMonitor(void) const
+        {
+            return (loadMonitor);
+        }
+
+        void SetLoadMonitor(LoadMonitor* monitor)
+        {
+            loadMonitor = monitor;
+        }
+
         void AddAnimation(AnimationStructure* structure)
         {
             animationList.push_back(structure);
@@ -1487,6 +2023,64 @@ namespace OpenGEX
             return (&animationList);
         }
 
+        void AddMesh(MeshStructure* structure)
+        {
+            meshList.push_back(structure);
+        }
+
+        const std::list<MeshStructure*>* GetMeshList(void) const
+        {
+            return (&meshList);
+        }
+
+        void AddGeometryNode(GeometryNodeStructure* structure)
+        {
+            geometryNodeList.push_back(structure);
+        }
+
+        const std::list<GeometryNodeStructure*>* GetGeometryNodeList(void) const
+        {
+            return (&geometryNodeList);
+        }
+
+        const std::list<Skeleton*>* GetSkeletonList(void) const
+        {
+            return (&skeletonList);
+        }
+
+        // The name index holds every structure name in the file and the names of all nodes. Structure names are
+        // added before any structure is processed, so references are resolved through it, and node names are
+        // added in file order once processing has finished.
+
+        const NameIndex* GetNameIndex(void) const
+        {
+            return (&nameIndex);
+        }
+
+        void AddNamedNode(NodeStructure* structure)
+        {
+            nameIndex.AddObjectName(structure->GetNodeName(), structure);
+        }
+
+        // Returns the first node in the file with the given name, or nullptr if there isn't one.
+
+        NodeStructure* FindNode(std::string_view name) const
+        {
+            return (static_cast<NodeStructure*>(nameIndex.FindObjectName(name)));
+        }
+
+        // Parses and processes the text. DataDescription::ProcessText isn't virtual, so this function hides it rather
+        // than overriding it. It adds a profiling zone around the base version so that the whole load is covered, and
+        // the time spent parsing is the part not covered by ProcessData. It also reports a load cancelled during parsing
+        // as kDataOpenGexLoadCancelled. A call made through a pointer or reference to the DataDescription base goes
+        // straight to the base version, which isn't profiled and reports a cancelled parse as an invalid structure.
+
+        DataResult ProcessText(const char* text);
+
+        // Reads a file, which may be compressed with gzip or zstd, and then parses and processes its text.
+
+        DataResult ProcessFile(const char* fileName);
+
         Structure* CreateStructure(std::string_view identifier) const override;
         bool       ValidateTopLevelStructure(const Structure* structure) const override;
 
@@ -1495,6 +2089,19 @@ namespace OpenGEX
 
         Range<float> GetAnimationTimeRange(int32 clip) const;
         void         UpdateAnimation(int32 clip, float time) const;
+        void         UpdateNodeBounds(void) const;
+        void         UpdateSkeletonPalettes(void) const;
+
+        // Reports the bytes used by array data in the structure tree and the runtime skeletons. Parser data that is
+        // no longer used after processing and processed copies identical to parser data show what a compact
+        // representation would save.
+
+        void GetMemoryReport(MemoryReport* report) const;
+
+        // Moves the processed data into a new compact scene and then destroys the structure tree, leaving the description
+        // empty. The caller owns the scene, which remains valid after the description is deleted.
+
+        CompactScene* CreateCompactScene(void);
     };
 } // namespace OpenGEX
 
@@ -0,0 +1,331 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#include "OpenGEXArena.h"
+#include "OpenGEX.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace OpenGEX;
+
+namespace
+{
+    enum : uint32
+    {
+        kGeometryArenaTableTag = 'OGXA'
+    };
+
+    struct GeometryArenaHeader
+    {
+        uint32 tableTag;
+        uint32 tableVersion;
+        uint32 entryCount;
+        uint32 nameSize;
+        uint64 alignment;
+        uint64 dataSize;
+    };
+
+    GeometryArenaEntry MakeEntry(uint32 objectIndex, uint32 meshLevel, uint32 arrayType, uint32 elementCount, uint32 elementSize)
+    {
+        GeometryArenaEntry entry = {};
+        entry.objectIndex = objectIndex;
+        entry.meshLevel = meshLevel;
+        entry.arrayType = arrayType;
+        entry.elementCount = elementCount;
+        entry.elementSize = elementSize;
+        return (entry);
+    }
+
+    void AddPackedSkin(GeometryArenaEntry* entry, const PackedSkinData& packedSkinData, uint32 arrayType)
+    {
+        entry->arrayType = arrayType;
+        entry->elementCount = uint32(packedSkinData.vertexCount);
+
+        if (arrayType == kGeometryArraySkinIndex)
+        {
+            entry->elementSize = uint32(packedSkinData.influenceCount * packedSkinData.indexSize);
+        }
+        else
+        {
+            entry->elementSize = uint32(packedSkinData.influenceCount * GetSkinWeightSize(packedSkinData.weightFormat));
+        }
+    }
+} // namespace
+
+GeometryArena::GeometryArena(uint64 alignment)
+{
+    arenaAlignment = Max(alignment, uint64(1));
+    dataSize = 0;
+    nameTable.push_back(0);
+}
+
+GeometryArena::~GeometryArena()
+{
+}
+
+void GeometryArena::Clear(void)
+{
+    dataSize = 0;
+    entryArray.clear();
+    sourceArray.clear();
+
+    nameTable.clear();
+    nameTable.push_back(0);
+}
+
+uint32 GeometryArena::AddName(std::string_view name)
+{
+    // The table begins with an empty string, and the few attrib names in a scene are found by a linear search.
+
+    if (name.empty())
+    {
+        return (0);
+    }
+
+    machine offset = 1;
+    while (offset < machine(nameTable.size()))
+    {
+        const char* string = nameTable.c_str() + offset;
+        machine     length = strlen(string);
+        if (name == std::string_view(string, length))
+        {
+            return (uint32(offset));
+        }
+
+        offset += length + 1;
+    }
+
+    nameTable.append(name);
+    nameTable.push_back(0);
+    return (uint32(offset));
+}
+
+void GeometryArena::AddArray(const GeometryArenaEntry& entry, std::string_view name, const void* data)
+{
+    if ((!data) || (entry.elementCount == 0))
+    {
+        return;
+    }
+
+    GeometryArenaEntry& arenaEntry = entryArray.emplace_back(entry);
+    arenaEntry.nameOffset = AddName(name);
+    arenaEntry.size = uint64(entry.elementCount) * entry.elementSize;
+    arenaEntry.offset = (dataSize + (arenaAlignment - 1)) / arenaAlignment * arenaAlignment;
+
+    dataSize = arenaEntry.offset + arenaEntry.size;
+    sourceArray.push_back(data);
+}
+
+void GeometryArena::AddMesh(uint32 objectIndex, const MeshStructure* meshStructure)
+{
+    uint32 meshLevel = meshStructure->GetKey();
+
+    for (const VertexArrayStructure* vertexArrayStructure : *meshStructure->GetVertexArrayList())
+    {
+        GeometryArenaEntry entry = MakeEntry(objectIndex, meshLevel, kGeometryArrayVertex, uint32(vertexArrayStructure->GetVertexCount()),
+                                             uint32(vertexArrayStructure->GetComponentCount() * sizeof(float)));
+        entry.attribIndex = vertexArrayStructure->GetAttribIndex();
+        entry.morphIndex = vertexArrayStructure->GetMorphIndex();
+        AddArray(entry, vertexArrayStructure->GetAttribString(), vertexArrayStructure->GetVertexArrayData());
+    }
+
+    for (const IndexArrayStructure* indexArrayStructure : *meshStructure->GetIndexArrayList())
+    {
+        GeometryArenaEntry entry = MakeEntry(objectIndex, meshLevel, kGeometryArrayIndex, indexArrayStructure->GetIndexCount(), uint32(indexArrayStructure->GetIndexSize()));
+        entry.attribIndex = indexArrayStructure->GetMaterialIndex();
+        AddArray(entry, std::string_view(), indexArrayStructure->GetIndexArrayData());
+    }
+
+    const SkinStructure* skinStructure = meshStructure->GetSkinStructure();
+    if (skinStructure)
+    {
+        const PackedSkinData& packedSkinData = skinStructure->GetPackedSkinData();
+        GeometryArenaEntry    entry = MakeEntry(objectIndex, meshLevel, kGeometryArraySkinIndex, 0, 0);
+
+        AddPackedSkin(&entry, packedSkinData, kGeometryArraySkinIndex);
+        AddArray(entry, std::string_view(), packedSkinData.boneIndexArray);
+        AddPackedSkin(&entry, packedSkinData, kGeometryArraySkinWeight);
+        AddArray(entry, std::string_view(), packedSkinData.boneWeightArray);
+    }
+}
+
+void GeometryArena::AddMesh(uint32 objectIndex, const SceneMesh& mesh)
+{
+    for (machine a = 0; a < mesh.vertexArrayCount; a++)
+    {
+        const SceneVertexArray& vertexArray = mesh.vertexArray[a];
+
+        GeometryArenaEntry entry = MakeEntry(objectIndex, mesh.meshLevel, kGeometryArrayVertex, uint32(vertexArray.vertexCount), uint32(vertexArray.componentCount * sizeof(float)));
+        entry.attribIndex = vertexArray.attribIndex;
+        entry.morphIndex = vertexArray.morphIndex;
+        AddArray(entry, vertexArray.attrib, vertexArray.vertexArray);
+    }
+
+    for (machine a = 0; a < mesh.indexArrayCount; a++)
+    {
+        const SceneIndexArray& indexArray = mesh.indexArray[a];
+
+        GeometryArenaEntry entry = MakeEntry(objectIndex, mesh.meshLevel, kGeometryArrayIndex, uint32(indexArray.indexCount), uint32(indexArray.indexSize));
+        entry.attribIndex = indexArray.materialIndex;
+        AddArray(entry, std::string_view(), indexArray.indexArray);
+    }
+
+    if (mesh.skin)
+    {
+        const PackedSkinData& packedSkinData = mesh.skin->packedSkinData;
+        GeometryArenaEntry    entry = MakeEntry(objectIndex, mesh.meshLevel, kGeometryArraySkinIndex, 0, 0);
+
+        AddPackedSkin(&entry, packedSkinData, kGeometryArraySkinIndex);
+        AddArray(entry, std::string_view(), packedSkinData.boneIndexArray);
+        AddPackedSkin(&entry, packedSkinData, kGeometryArraySkinWeight);
+        AddArray(entry, std::string_view(), packedSkinData.boneWeightArray);
+    }
+}
+
+void GeometryArena::AddGeometryObject(uint32 objectIndex, const GeometryObjectStructure* geometryObjectStructure)
+{
+    std::vector<const MeshStructure*> meshStructureArray;
+    for (const auto& entry : *geometryObjectStructure->GetMeshMap())
+    {
+        meshStructureArray.push_back(entry.second);
+    }
+
+    std::sort(meshStructureArray.begin(), meshStructureArray.end(), [](const MeshStructure* a, const MeshStructure* b) { return (a->GetKey() < b->GetKey()); });
+
+    for (const MeshStructure* meshStructure : meshStructureArray)
+    {
+        AddMesh(objectIndex, meshStructure);
+    }
+}
+
+void GeometryArena::AddScene(const OpenGexDataDescription* dataDescription)
+{
+    uint32 objectIndex = 0;
+
+    const Structure* root = dataDescription->GetRootStructure();
+    const Structure* structure = root->GetFirstSubnode();
+    while (structure)
+    {
+        if (structure->GetStructureType() == kStructureGeometryObject)
+        {
+            AddGeometryObject(objectIndex++, static_cast<const GeometryObjectStructure*>(structure));
+        }
+
+        structure = structure->GetNextNode(root);
+    }
+}
+
+void GeometryArena::AddScene(const CompactScene* scene)
+{
+    int32 objectCount = scene->GetGeometryObjectCount();
+    for (machine a = 0; a < objectCount; a++)
+    {
+        const SceneGeometryObject& geometryObject = scene->GetGeometryObject(int32(a));
+        for (machine b = 0; b < geometryObject.meshCount; b++)
+        {
+            AddMesh(uint32(a), geometryObject.meshArray[b]);
+        }
+    }
+}
+
+const GeometryArenaEntry* GeometryArena::FindEntry(uint32 objectIndex, uint32 meshLevel, uint32 arrayType, std::string_view attrib, uint32 index, uint32 morph) const
+{
+    for (const GeometryArenaEntry& entry : entryArray)
+    {
+        if ((entry.objectIndex == objectIndex) && (entry.meshLevel == meshLevel) && (entry.arrayType == arrayType) && (entry.attribIndex == index) && (entry.morphIndex == morph) &&
+            (attrib == nameTable.c_str() + entry.nameOffset))
+        {
+            return (&entry);
+        }
+    }
+
+    return (nullptr);
+}
+
+bool GeometryArena::WriteData(void* destination) const
+{
+    if (sourceArray.size() != entryArray.size())
+    {
+        return (false);
+    }
+
+    char*  data = static_cast<char*>(destination);
+    uint64 position = 0;
+
+    for (machine a = 0; a < machine(entryArray.size()); a++)
+    {
+        const GeometryArenaEntry& entry = entryArray[a];
+
+        memset(data + position, 0, entry.offset - position);
+        memcpy(data + entry.offset, sourceArray[a], entry.size);
+        position = entry.offset + entry.size;
+    }
+
+    return (true);
+}
+
+void GeometryArena::WriteTable(std::string* output) const
+{
+    GeometryArenaHeader header;
+    header.tableTag = kGeometryArenaTableTag;
+    header.tableVersion = kGeometryArenaTableVersion;
+    header.entryCount = uint32(entryArray.size());
+    header.nameSize = uint32(nameTable.size());
+    header.alignment = arenaAlignment;
+    header.dataSize = dataSize;
+
+    output->append(reinterpret_cast<const char*>(&header), sizeof(GeometryArenaHeader));
+    output->append(reinterpret_cast<const char*>(entryArray.data()), entryArray.size() * sizeof(GeometryArenaEntry));
+    output->append(nameTable);
+}
+
+bool GeometryArena::ReadTable(const void* data, machine size)
+{
+    const char* input = static_cast<const char*>(data);
+    if (size < machine(sizeof(GeometryArenaHeader)))
+    {
+        return (false);
+    }
+
+    GeometryArenaHeader header;
+    memcpy(&header, input, sizeof(GeometryArenaHeader));
+
+    // A written table always has a nonzero alignment, since the constructor clamps it, so zero means the table is corrupt.
+
+    if ((header.tableTag != kGeometryArenaTableTag) || (header.tableVersion != kGeometryArenaTableVersion) || (header.alignment == 0) || (header.nameSize == 0) ||
+        (uint64(size) != sizeof(GeometryArenaHeader) + uint64(header.entryCount) * sizeof(GeometryArenaEntry) + header.nameSize))
+    {
+        return (false);
+    }
+
+    const char* names = input + sizeof(GeometryArenaHeader) + machine(header.entryCount) * sizeof(GeometryArenaEntry);
+    if (names[header.nameSize - 1] != 0)
+    {
+        return (false);
+    }
+
+    Clear();
+    arenaAlignment = header.alignment;
+    dataSize = header.dataSize;
+
+    entryArray.resize(header.entryCount);
+    memcpy(entryArray.data(), input + sizeof(GeometryArenaHeader), machine(header.entryCount) * sizeof(GeometryArenaEntry));
+    nameTable.assign(names, header.nameSize);
+
+    for (const GeometryArenaEntry& entry : entryArray)
+    {
+        if ((entry.nameOffset >= header.nameSize) || (entry.offset + entry.size > dataSize))
+        {
+            Clear();
+            return (false);
+        }
+    }
+
+    return (true);
+}
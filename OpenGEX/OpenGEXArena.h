@@ -0,0 +1,139 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#ifndef OpenGEXArena_h
+#define OpenGEXArena_h
+
+#include "TSPlatform.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Terathon;
+
+namespace OpenGEX
+{
+    class CompactScene;
+    class GeometryObjectStructure;
+    class MeshStructure;
+    class OpenGexDataDescription;
+    struct SceneMesh;
+
+    enum
+    {
+        kGeometryArenaAlignment = 256,
+        kGeometryArenaTableVersion = 1
+    };
+
+    enum
+    {
+        kGeometryArrayVertex,
+        kGeometryArrayIndex,
+        kGeometryArraySkinIndex,
+        kGeometryArraySkinWeight
+    };
+
+    // The location of one array in the arena. The name is the attrib string of a vertex array, given as an offset into
+    // the name table, and it is empty for other arrays. For index arrays, the attrib index holds the material index.
+    // Entries have a fixed size so that the table can be stored in a file and read back on any platform with the same
+    // byte order.
+
+    struct GeometryArenaEntry
+    {
+        uint32 objectIndex;
+        uint32 meshLevel;
+        uint32 arrayType;
+        uint32 nameOffset;
+        uint32 attribIndex;
+        uint32 morphIndex;
+        uint32 elementCount;
+        uint32 elementSize;
+        uint64 offset;
+        uint64 size;
+    };
+
+    // Lays out the processed vertex arrays, index arrays, and packed skin influences of a scene or of individual
+    // geometry objects in one block, with every array starting at a multiple of the alignment. Adding geometry only
+    // records where its arrays go, and the data is copied when the arena is written, so the structures or compact
+    // scene that it came from must still exist at that time. The destination can be a mapped staging buffer.
+
+    class GeometryArena
+    {
+    private:
+        uint64 arenaAlignment;
+        uint64 dataSize;
+
+        std::vector<GeometryArenaEntry> entryArray;
+        std::vector<const void*>        sourceArray;
+        std::string                     nameTable;
+
+        uint32 AddName(std::string_view name);
+        void   AddArray(const GeometryArenaEntry& entry, std::string_view name, const void* data);
+        void   AddMesh(uint32 objectIndex, const MeshStructure* meshStructure);
+        void   AddMesh(uint32 objectIndex, const SceneMesh& mesh);
+
+    public:
+        explicit GeometryArena(uint64 alignment = kGeometryArenaAlignment);
+        ~GeometryArena();
+
+        uint64 GetAlignment(void) const
+        {
+            return (arenaAlignment);
+        }
+
+        // The number of bytes needed to hold the whole arena.
+
+        uint64 GetDataSize(void) const
+        {
+            return (dataSize);
+        }
+
+        int32 GetEntryCount(void) const
+        {
+            return (int32(entryArray.size()));
+        }
+
+        const GeometryArenaEntry& GetEntry(int32 index) const
+        {
+            return (entryArray[index]);
+        }
+
+        const char* GetEntryName(int32 index) const
+        {
+            return (nameTable.c_str() + entryArray[index].nameOffset);
+        }
+
+        void Clear(void);
+
+        // Meshes are added in increasing order of level. Scenes add every geometry object in the order they appear in
+        // the file, which is also the order of the geometry objects in a compact scene, using that order as the object index.
+
+        void AddGeometryObject(uint32 objectIndex, const GeometryObjectStructure* geometryObjectStructure);
+        void AddScene(const OpenGexDataDescription* dataDescription);
+        void AddScene(const CompactScene* scene);
+
+        // Returns the entry for an array, or nullptr if the arena doesn't have one. For index arrays, the attrib is empty and the index is the material index.
+
+        const GeometryArenaEntry* FindEntry(uint32 objectIndex, uint32 meshLevel, uint32 arrayType, std::string_view attrib = std::string_view(), uint32 index = 0,
+                                            uint32 morph = 0) const;
+
+        // Copies every array into the destination, which must hold GetDataSize() bytes. Padding between arrays is zeroed.
+        // Returns false if the table was read from serialized data and no longer knows where the arrays come from.
+
+        bool WriteData(void* destination) const;
+
+        // The serialized table holds a header, the entries, and the name table. Reading a table replaces the contents of
+        // the arena, and it returns false if the data isn't a complete table of the current version.
+
+        void WriteTable(std::string* output) const;
+        bool ReadTable(const void* data, machine size);
+    };
+} // namespace OpenGEX
+
+#endif
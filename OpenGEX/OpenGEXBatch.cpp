@@ -0,0 +1,255 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#include "OpenGEXBatch.h"
+#include "OpenGEX.h"
+
+#include <algorithm>
+#include <chrono>
+
+using namespace OpenGEX;
+
+BatchLoader::BatchLoader(ThreadPool* pool, uint64 budget)
+{
+    localPool = (pool) ? nullptr : new ThreadPool;
+    threadPool = (pool) ? pool : localPool;
+    fileReader = nullptr;
+
+    memoryBudget = budget;
+    memoryFactor = 4.0F;
+    compactFlag = false;
+
+    loadedCount = 0;
+    residentSize = 0;
+    peakResidentSize = 0;
+    activeCount = 0;
+
+    batchStatistics = BatchStatistics{};
+}
+
+BatchLoader::~BatchLoader()
+{
+    for (BatchFileResult& fileResult : fileResultArray)
+    {
+        delete fileResult.compactScene;
+        delete fileResult.dataDescription;
+    }
+
+    delete localPool;
+}
+
+void BatchLoader::AddFile(const char* fileName)
+{
+    BatchFileResult& fileResult = fileResultArray.emplace_back();
+    fileResult.fileName = fileName;
+    fileResult.result = kDataOkay;
+    fileResult.fileSize = 0;
+    fileResult.loadTime = 0.0F;
+    fileResult.dataDescription = nullptr;
+    fileResult.compactScene = nullptr;
+}
+
+int32 BatchLoader::AddTextureName(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(batchMutex);
+
+    auto iterator = textureIndexMap.find(name);
+    if (iterator != textureIndexMap.end())
+    {
+        return (iterator->second);
+    }
+
+    int32 index = int32(textureNameArray.size());
+    textureNameArray.push_back(name);
+    textureIndexMap.emplace(name, index);
+    return (index);
+}
+
+void BatchLoader::LoadFile(BatchFileResult* fileResult, FileRead* fileRead, uint64 estimatedSize)
+{
+    OPENGEX_PROFILE_ZONE("BatchLoader::LoadFile");
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    char*      buffer = nullptr;
+    uint64     size = 0;
+    DataResult result = kDataOpenGexFileUnreadable;
+
+    if (fileReader)
+    {
+        // A compressed file arrives from the reader as it is stored, so it is decompressed here.
+
+        char*  data = nullptr;
+        uint64 dataSize = 0;
+
+        if ((fileRead) && (fileReader->FinishRead(fileRead, &data, &dataSize)))
+        {
+            if (GetCompressionFormat(data, dataSize) == kCompressionNone)
+            {
+                buffer = data;
+                size = dataSize;
+                result = kDataOkay;
+            }
+            else
+            {
+                result = DecompressText(data, dataSize, &buffer, &size);
+                delete[] data;
+            }
+        }
+    }
+    else
+    {
+        result = LoadTextFile(fileResult->fileName.c_str(), &buffer, &size);
+    }
+
+    if (result != kDataOkay)
+    {
+        fileResult->result = result;
+    }
+    else
+    {
+        OpenGexDataDescription* dataDescription = new OpenGexDataDescription;
+        dataDescription->SetThreadPool(threadPool);
+        if (setupFunction)
+        {
+            setupFunction(dataDescription);
+        }
+
+        fileResult->fileSize = size;
+        fileResult->result = dataDescription->ProcessText(buffer);
+        delete[] buffer;
+
+        if (fileResult->result == kDataOkay)
+        {
+            // Texture names are collected before the tree can be released by compaction.
+
+            const Structure* root = dataDescription->GetRootStructure();
+            const Structure* structure = root->GetFirstSubnode();
+            while (structure)
+            {
+                if (structure->GetStructureType() == kStructureTexture)
+                {
+                    int32               index = AddTextureName(static_cast<const TextureStructure*>(structure)->GetTextureName());
+                    std::vector<int32>& textureIndexArray = fileResult->textureIndexArray;
+
+                    if (std::find(textureIndexArray.begin(), textureIndexArray.end(), index) == textureIndexArray.end())
+                    {
+                        textureIndexArray.push_back(index);
+                    }
+                }
+
+                structure = structure->GetNextNode(root);
+            }
+
+            if (compactFlag)
+            {
+                fileResult->compactScene = dataDescription->CreateCompactScene();
+                delete dataDescription;
+                dataDescription = nullptr;
+            }
+        }
+
+        fileResult->dataDescription = dataDescription;
+    }
+
+    fileResult->loadTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+    {
+        std::lock_guard<std::mutex> lock(batchMutex);
+        residentSize -= estimatedSize;
+        activeCount--;
+    }
+
+    batchCondition.notify_all();
+}
+
+void BatchLoader::Load(void)
+{
+    OPENGEX_PROFILE_ZONE("BatchLoader::Load");
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    int32 firstIndex = loadedCount;
+    int32 fileCount = int32(fileResultArray.size());
+
+    residentSize = 0;
+    peakResidentSize = 0;
+    activeCount = 0;
+
+    // Without worker threads, submitted jobs would never run, so the files are loaded by the calling thread.
+
+    bool inlineFlag = (threadPool->GetThreadCount() == 0);
+
+    for (machine a = firstIndex; a < fileCount; a++)
+    {
+        BatchFileResult* fileResult = &fileResultArray[a];
+        uint64           estimatedSize = uint64(double(GetTextFileSize(fileResult->fileName.c_str())) * memoryFactor);
+
+        {
+            std::unique_lock<std::mutex> lock(batchMutex);
+            batchCondition.wait(lock, [this, estimatedSize] { return ((activeCount == 0) || (residentSize + estimatedSize <= memoryBudget)); });
+
+            residentSize += estimatedSize;
+            peakResidentSize = Max(peakResidentSize, residentSize);
+            activeCount++;
+        }
+
+        FileRead* fileRead = (fileReader) ? fileReader->BeginRead(fileResult->fileName.c_str()) : nullptr;
+
+        if (inlineFlag)
+        {
+            LoadFile(fileResult, fileRead, estimatedSize);
+        }
+        else
+        {
+            threadPool->SubmitJob([this, fileResult, fileRead, estimatedSize] { LoadFile(fileResult, fileRead, estimatedSize); });
+        }
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(batchMutex);
+        batchCondition.wait(lock, [this] { return (activeCount == 0); });
+    }
+
+    loadedCount = fileCount;
+
+    BatchStatistics& statistics = batchStatistics;
+    statistics = BatchStatistics{};
+    statistics.fileCount = fileCount - firstIndex;
+    statistics.peakResidentSize = peakResidentSize;
+    statistics.wallTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+    for (machine a = firstIndex; a < fileCount; a++)
+    {
+        const BatchFileResult& fileResult = fileResultArray[a];
+        statistics.failedCount += (fileResult.result != kDataOkay);
+        statistics.totalSize += fileResult.fileSize;
+        statistics.totalLoadTime += fileResult.loadTime;
+    }
+
+    if (statistics.wallTime > 0.0F)
+    {
+        double seconds = double(statistics.wallTime) * 0.001;
+        statistics.bytesPerSecond = double(statistics.totalSize) / seconds;
+        statistics.filesPerSecond = double(statistics.fileCount) / seconds;
+    }
+}
+
+OpenGexDataDescription* BatchLoader::ReleaseDataDescription(int32 index)
+{
+    OpenGexDataDescription* dataDescription = fileResultArray[index].dataDescription;
+    fileResultArray[index].dataDescription = nullptr;
+    return (dataDescription);
+}
+
+CompactScene* BatchLoader::ReleaseCompactScene(int32 index)
+{
+    CompactScene* scene = fileResultArray[index].compactScene;
+    fileResultArray[index].compactScene = nullptr;
+    return (scene);
+}
@@ -0,0 +1,165 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#ifndef OpenGEXBatch_h
+#define OpenGEXBatch_h
+
+#include "OpenGEXThreadPool.h"
+#include "TSOpenDDL.h"
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace Terathon;
+
+namespace OpenGEX
+{
+    class CompactScene;
+    class FileRead;
+    class FileReader;
+    class OpenGexDataDescription;
+
+    // Texture indexes refer to the texture name table of the loader, which holds each name found in any file once.
+    // The description or compact scene belongs to the loader until it is released.
+
+    struct BatchFileResult
+    {
+        std::string             fileName;
+        DataResult              result;
+        uint64                  fileSize;
+        float                   loadTime;
+        OpenGexDataDescription* dataDescription;
+        CompactScene*           compactScene;
+        std::vector<int32>      textureIndexArray;
+    };
+
+    // Times are in milliseconds. The resident size is the estimated memory of the files being loaded at the same time.
+
+    struct BatchStatistics
+    {
+        int32  fileCount;
+        int32  failedCount;
+        uint64 totalSize;
+        uint64 peakResidentSize;
+        float  wallTime;
+        float  totalLoadTime;
+        double bytesPerSecond;
+        double filesPerSecond;
+    };
+
+    // Reads, parses, and processes many files with one thread pool, which is also used for the mesh processing of every
+    // description. If no pool is given, the loader creates its own. A file is only started when the estimated memory of
+    // the files in progress, the text size times the memory factor, fits in the budget. One file is always allowed to
+    // load so that a file larger than the budget isn't stuck. With the compact flag, each description is replaced by a
+    // compact scene as soon as it has been processed, which releases its structure tree. Files compressed with gzip or
+    // zstd are decompressed, and their text size is the one recorded in the file.
+    //
+    // With a file reader, each file starts reading as soon as it is admitted, so reads of files waiting for a
+    // worker overlap the parsing and processing of the files ahead of them.
+
+    class BatchLoader
+    {
+    private:
+        ThreadPool* threadPool;
+        ThreadPool* localPool;
+        FileReader* fileReader;
+        uint64      memoryBudget;
+        float       memoryFactor;
+        bool        compactFlag;
+
+        std::function<void(OpenGexDataDescription*)> setupFunction;
+
+        std::vector<BatchFileResult>           fileResultArray;
+        int32                                  loadedCount;
+        std::vector<std::string>               textureNameArray;
+        std::unordered_map<std::string, int32> textureIndexMap;
+
+        std::mutex              batchMutex;
+        std::condition_variable batchCondition;
+        uint64                  residentSize;
+        uint64                  peakResidentSize;
+        int32                   activeCount;
+
+        BatchStatistics batchStatistics;
+
+        void  LoadFile(BatchFileResult* fileResult, FileRead* fileRead, uint64 estimatedSize);
+        int32 AddTextureName(const std::string& name);
+
+    public:
+        BatchLoader(ThreadPool* pool, uint64 budget);
+        ~BatchLoader();
+
+        BatchLoader(const BatchLoader&) = delete;
+        BatchLoader& operator=(const BatchLoader&) = delete;
+
+        void SetMemoryFactor(float factor)
+        {
+            memoryFactor = factor;
+        }
+
+        void SetCompactFlag(bool compact)
+        {
+            compactFlag = compact;
+        }
+
+        // The file reader isn't owned by the loader. Without one, each file is read with fread by the job loading it.
+
+        void SetFileReader(FileReader* reader)
+        {
+            fileReader = reader;
+        }
+
+        // The setup function configures each new description before it loads. It is called on a worker thread.
+
+        void SetSetupFunction(const std::function<void(OpenGexDataDescription*)>& setup)
+        {
+            setupFunction = setup;
+        }
+
+        void AddFile(const char* fileName);
+
+        // Loads every file added since the last call and returns when they have all finished.
+        // The statistics cover the files loaded by the last call.
+
+        void Load(void);
+
+        int32 GetFileCount(void) const
+        {
+            return (int32(fileResultArray.size()));
+        }
+
+        const BatchFileResult& GetFileResult(int32 index) const
+        {
+            return (fileResultArray[index]);
+        }
+
+        int32 GetTextureCount(void) const
+        {
+            return (int32(textureNameArray.size()));
+        }
+
+        const std::string& GetTextureName(int32 index) const
+        {
+            return (textureNameArray[index]);
+        }
+
+        const BatchStatistics& GetStatistics(void) const
+        {
+            return (batchStatistics);
+        }
+
+        OpenGexDataDescription* ReleaseDataDescription(int32 index);
+        CompactScene*           ReleaseCompactScene(int32 index);
+    };
+} // namespace OpenGEX
+
+#endif
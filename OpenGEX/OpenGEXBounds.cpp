@@ -0,0 +1,136 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#include "OpenGEXBounds.h"
+
+using namespace OpenGEX;
+
+void OpenGEX::ExpandBoundingBox(BoundingBox* box, const float* positionArray, int32 positionStride, int32 vertexCount)
+{
+    machine a = 0;
+
+#ifdef TERATHON_SSE
+
+    if (vertexCount >= 2)
+    {
+        // Each position is loaded as one vector. The fourth lane holds whatever follows the position and is ignored.
+        // With three components, the last position is handled by the scalar loop so that nothing past the end is read.
+
+        __m128 vmin = _mm_setr_ps(box->min.x, box->min.y, box->min.z, 0.0F);
+        __m128 vmax = _mm_setr_ps(box->max.x, box->max.y, box->max.z, 0.0F);
+
+        machine count = (positionStride >= 4) ? vertexCount : vertexCount - 1;
+        for (; a < count; a++)
+        {
+            __m128 p = _mm_loadu_ps(positionArray + a * positionStride);
+            vmin = _mm_min_ps(vmin, p);
+            vmax = _mm_max_ps(vmax, p);
+        }
+
+        alignas(16) float lane[8];
+        _mm_store_ps(lane, vmin);
+        _mm_store_ps(lane + 4, vmax);
+
+        box->min.Set(lane[0], lane[1], lane[2]);
+        box->max.Set(lane[4], lane[5], lane[6]);
+    }
+
+#endif
+
+    Point3D pmin = box->min;
+    Point3D pmax = box->max;
+
+    for (; a < vertexCount; a++)
+    {
+        const float* p = positionArray + a * positionStride;
+        pmin.Set(Fmin(pmin.x, p[0]), Fmin(pmin.y, p[1]), Fmin(pmin.z, p[2]));
+        pmax.Set(Fmax(pmax.x, p[0]), Fmax(pmax.y, p[1]), Fmax(pmax.z, p[2]));
+    }
+
+    box->min = pmin;
+    box->max = pmax;
+}
+
+float OpenGEX::CalculateMaxSquaredDistance(const Point3D& center, const float* positionArray, int32 positionStride, int32 vertexCount)
+{
+    float   maxDistance = 0.0F;
+    machine a = 0;
+
+#ifdef TERATHON_SSE
+
+    if (vertexCount >= 2)
+    {
+        // The fourth lane of the center is matched against itself so that it contributes nothing.
+
+        __m128 c = _mm_setr_ps(center.x, center.y, center.z, 0.0F);
+        __m128 mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+        __m128 m = _mm_setzero_ps();
+
+        machine count = (positionStride >= 4) ? vertexCount : vertexCount - 1;
+        for (; a < count; a++)
+        {
+            __m128 d = _mm_and_ps(_mm_sub_ps(_mm_loadu_ps(positionArray + a * positionStride), c), mask);
+            d = _mm_mul_ps(d, d);
+            d = _mm_add_ps(d, _mm_shuffle_ps(d, d, _MM_SHUFFLE(2, 3, 0, 1)));
+            d = _mm_add_ps(d, _mm_shuffle_ps(d, d, _MM_SHUFFLE(1, 0, 3, 2)));
+            m = _mm_max_ss(m, d);
+        }
+
+        _mm_store_ss(&maxDistance, m);
+    }
+
+#endif
+
+    for (; a < vertexCount; a++)
+    {
+        const float* p = positionArray + a * positionStride;
+        float        x = p[0] - center.x;
+        float        y = p[1] - center.y;
+        float        z = p[2] - center.z;
+        maxDistance = Fmax(maxDistance, x * x + y * y + z * z);
+    }
+
+    return (maxDistance);
+}
+
+void OpenGEX::UnionBoundingBox(BoundingBox* box, const BoundingBox& other)
+{
+    box->min.Set(Fmin(box->min.x, other.min.x), Fmin(box->min.y, other.min.y), Fmin(box->min.z, other.min.z));
+    box->max.Set(Fmax(box->max.x, other.max.x), Fmax(box->max.y, other.max.y), Fmax(box->max.z, other.max.z));
+}
+
+void OpenGEX::TransformBoundingBox(const Transform3D& transform, const BoundingBox& box, BoundingBox* result)
+{
+    if (box.Empty())
+    {
+        result->Clear();
+        return;
+    }
+
+    // Transform the center and add the extents projected onto each axis by the absolute values of the matrix entries.
+
+    Point3D  center = transform * box.GetCenter();
+    Vector3D extent = (box.max - box.min) * 0.5F;
+
+    float ex = Fabs(transform(0, 0)) * extent.x + Fabs(transform(0, 1)) * extent.y + Fabs(transform(0, 2)) * extent.z;
+    float ey = Fabs(transform(1, 0)) * extent.x + Fabs(transform(1, 1)) * extent.y + Fabs(transform(1, 2)) * extent.z;
+    float ez = Fabs(transform(2, 0)) * extent.x + Fabs(transform(2, 1)) * extent.y + Fabs(transform(2, 2)) * extent.z;
+
+    result->min.Set(center.x - ex, center.y - ey, center.z - ez);
+    result->max.Set(center.x + ex, center.y + ey, center.z + ez);
+}
+
+void OpenGEX::TransformBoundingSphere(const Transform3D& transform, const BoundingSphere& sphere, BoundingSphere* result)
+{
+    float sx = transform(0, 0) * transform(0, 0) + transform(1, 0) * transform(1, 0) + transform(2, 0) * transform(2, 0);
+    float sy = transform(0, 1) * transform(0, 1) + transform(1, 1) * transform(1, 1) + transform(2, 1) * transform(2, 1);
+    float sz = transform(0, 2) * transform(0, 2) + transform(1, 2) * transform(1, 2) + transform(2, 2) * transform(2, 2);
+
+    result->center = transform * sphere.center;
+    result->radius = sphere.radius * Sqrt(Fmax(sx, sy, sz));
+}
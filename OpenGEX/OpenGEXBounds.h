@@ -0,0 +1,73 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#ifndef OpenGEXBounds_h
+#define OpenGEXBounds_h
+
+#include "TSMatrix4D.h"
+
+using namespace Terathon;
+
+namespace OpenGEX
+{
+    struct BoundingBox
+    {
+        Point3D min;
+        Point3D max;
+
+        // An empty box has min greater than max, so that any point expands it.
+
+        void Clear(void)
+        {
+            min.Set(Math::infinity, Math::infinity, Math::infinity);
+            max.Set(Math::minus_infinity, Math::minus_infinity, Math::minus_infinity);
+        }
+
+        void Expand(const Point3D& p)
+        {
+            min.Set(Fmin(min.x, p.x), Fmin(min.y, p.y), Fmin(min.z, p.z));
+            max.Set(Fmax(max.x, p.x), Fmax(max.y, p.y), Fmax(max.z, p.z));
+        }
+
+        bool Empty(void) const
+        {
+            return (min.x > max.x);
+        }
+
+        Point3D GetCenter(void) const
+        {
+            return ((min + max) * 0.5F);
+        }
+    };
+
+    struct BoundingSphere
+    {
+        Point3D center;
+        float   radius;
+    };
+
+    // Enlarges a box so that it contains every position in an array.
+
+    void ExpandBoundingBox(BoundingBox* box, const float* positionArray, int32 positionStride, int32 vertexCount);
+
+    // Returns the largest squared distance from center to any position in an array.
+
+    float CalculateMaxSquaredDistance(const Point3D& center, const float* positionArray, int32 positionStride, int32 vertexCount);
+
+    void UnionBoundingBox(BoundingBox* box, const BoundingBox& other);
+
+    // Calculates the axis-aligned box containing a transformed box. An empty box stays empty.
+
+    void TransformBoundingBox(const Transform3D& transform, const BoundingBox& box, BoundingBox* result);
+
+    // Calculates a sphere containing a transformed sphere, using the largest scale of the transform.
+
+    void TransformBoundingSphere(const Transform3D& transform, const BoundingSphere& sphere, BoundingSphere* result);
+} // namespace OpenGEX
+
+#endif
@@ -0,0 +1,595 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#include "OpenGEXCompression.h"
+#include "OpenGEX.h"
+
+#include <cstdio>
+#include <cstring>
+
+#ifdef OPENGEX_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef OPENGEX_ZSTD
+#include <zstd.h>
+#endif
+
+using namespace OpenGEX;
+
+namespace
+{
+    enum
+    {
+        kFrameHeaderSize = 18,
+        kGzipTrailerSize = 4
+    };
+
+    // The largest ratio of text size to compressed size that each format can reach. Deflate needs at least one bit for
+    // every 258 bytes, and the smallest zstd block is a 3-byte header and 1 byte repeated 128 KiB times. These limit
+    // the damage of a corrupt size in the compressed data, and the buffer still grows if the text turns out larger.
+
+    constexpr uint64 kDeflateMaxRatio = 1032;
+    constexpr uint64 kZstdMaxRatio = 32768;
+
+    // Compressed data comes either from a file, which is read one chunk at a time, or from memory.
+
+    class TextSource
+    {
+    private:
+        FILE*       sourceFile;
+        const char* sourceData;
+        uint64      sourceSize;
+        uint64      sourcePosition;
+        char*       chunkStorage;
+
+    public:
+        explicit TextSource(FILE* file)
+        {
+            sourceFile = file;
+            sourceData = nullptr;
+            sourceSize = 0;
+            sourcePosition = 0;
+            chunkStorage = new char[kCompressionChunkSize];
+        }
+
+        TextSource(const void* data, uint64 size)
+        {
+            sourceFile = nullptr;
+            sourceData = static_cast<const char*>(data);
+            sourceSize = size;
+            sourcePosition = 0;
+            chunkStorage = nullptr;
+        }
+
+        ~TextSource()
+        {
+            delete[] chunkStorage;
+        }
+
+        TextSource(const TextSource&) = delete;
+        TextSource& operator=(const TextSource&) = delete;
+
+        // Returns the size of the next piece of input, which is never larger than a chunk, or zero at the end.
+
+        uint64 Read(const char** data)
+        {
+            if (sourceFile)
+            {
+                *data = chunkStorage;
+                return (fread(chunkStorage, 1, kCompressionChunkSize, sourceFile));
+            }
+
+            uint64 size = Min(sourceSize - sourcePosition, uint64(kCompressionChunkSize));
+            *data = sourceData + sourcePosition;
+            sourcePosition += size;
+            return (size);
+        }
+
+        bool GetErrorFlag(void) const
+        {
+            return ((sourceFile) && (ferror(sourceFile) != 0));
+        }
+    };
+
+    // The text buffer always has room for a zero terminator after its capacity.
+
+    class TextBuffer
+    {
+    private:
+        char*  textStorage;
+        uint64 textCapacity;
+        uint64 textSize;
+
+    public:
+        explicit TextBuffer(uint64 capacity)
+        {
+            textStorage = new char[capacity + 1];
+            textCapacity = capacity;
+            textSize = 0;
+        }
+
+        ~TextBuffer()
+        {
+            delete[] textStorage;
+        }
+
+        TextBuffer(const TextBuffer&) = delete;
+        TextBuffer& operator=(const TextBuffer&) = delete;
+
+        char* GetEnd(void) const
+        {
+            return (textStorage + textSize);
+        }
+
+        uint64 GetAvailableSize(void) const
+        {
+            return (textCapacity - textSize);
+        }
+
+        void AddSize(uint64 size)
+        {
+            textSize += size;
+        }
+
+        // Only called when the recorded size was missing or wrong.
+
+        void Grow(void)
+        {
+            uint64 capacity = textCapacity + Max(textCapacity >> 1, uint64(kCompressionChunkSize));
+            char*  storage = new char[capacity + 1];
+            memcpy(storage, textStorage, textSize);
+
+            delete[] textStorage;
+            textStorage = storage;
+            textCapacity = capacity;
+        }
+
+        void Release(char** text, uint64* size)
+        {
+            textStorage[textSize] = 0;
+            *text = textStorage;
+            *size = textSize;
+            textStorage = nullptr;
+        }
+    };
+
+    // Returns the text size recorded by the compressed data, or the fallback size if there isn't one. The gzip trailer
+    // only holds the size modulo 2^32, and it only covers the last member of a file with several members.
+
+    uint64 GetRecordedSize(int32 format, const char* header, uint64 headerSize, const char* trailer, uint64 fallbackSize)
+    {
+#ifdef OPENGEX_ZSTD
+
+        if (format == kCompressionZstd)
+        {
+            unsigned long long size = ZSTD_getFrameContentSize(header, size_t(headerSize));
+            return (((size != ZSTD_CONTENTSIZE_UNKNOWN) && (size != ZSTD_CONTENTSIZE_ERROR)) ? Min(uint64(size), fallbackSize * kZstdMaxRatio) : fallbackSize);
+        }
+
+#endif
+
+        if ((format == kCompressionGzip) && (trailer))
+        {
+            const unsigned char* byte = reinterpret_cast<const unsigned char*>(trailer);
+            return (Min(uint64(byte[0]) | (uint64(byte[1]) << 8) | (uint64(byte[2]) << 16) | (uint64(byte[3]) << 24), fallbackSize * kDeflateMaxRatio));
+        }
+
+        (void) header;
+        (void) headerSize;
+        return (fallbackSize);
+    }
+
+#ifdef OPENGEX_ZLIB
+
+    DataResult InflateText(TextSource* source, TextBuffer* buffer)
+    {
+        z_stream stream;
+        memset(&stream, 0, sizeof(z_stream));
+
+        // A window size of 15 plus 16 accepts only the gzip wrapper.
+
+        if (inflateInit2(&stream, 15 + 16) != Z_OK)
+        {
+            return (kDataOpenGexDecompressionFailed);
+        }
+
+        int         status = Z_OK;
+        bool        endFlag = false;
+        char        carryByte = 0;
+        const char* pendingData = nullptr;
+        uint64      pendingSize = 0;
+
+        for (;;)
+        {
+            if ((stream.avail_in == 0) && (!endFlag))
+            {
+                const char* data = pendingData;
+                uint64      size = pendingSize;
+
+                if (data)
+                {
+                    pendingData = nullptr;
+                }
+                else
+                {
+                    size = source->Read(&data);
+                    endFlag = (size == 0);
+                }
+
+                stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+                stream.avail_in = uInt(size);
+            }
+
+            if (status == Z_STREAM_END)
+            {
+                // Another member may follow. Anything else after the end of a member, such as padding, is ignored.
+                // When the input ends between the two bytes of the magic number, the next piece is read to check the
+                // second byte, and the first byte is copied because reading may overwrite it. Inflate is given the
+                // copied byte by itself, and then the piece that was read.
+
+                if ((stream.avail_in == 1) && (!endFlag))
+                {
+                    carryByte = char(stream.next_in[0]);
+                    pendingSize = source->Read(&pendingData);
+                    endFlag = (pendingSize == 0);
+
+                    if ((endFlag) || (uint8(carryByte) != 0x1F) || (uint8(pendingData[0]) != 0x8B))
+                    {
+                        break;
+                    }
+
+                    stream.next_in = reinterpret_cast<Bytef*>(&carryByte);
+                }
+                else if ((stream.avail_in < 2) || (stream.next_in[0] != 0x1F) || (stream.next_in[1] != 0x8B))
+                {
+                    break;
+                }
+
+                inflateReset(&stream);
+            }
+
+            // The output is limited so that its size fits in a uInt.
+
+            uInt available = uInt(Min(buffer->GetAvailableSize(), uint64(1) << 30));
+            stream.next_out = reinterpret_cast<Bytef*>(buffer->GetEnd());
+            stream.avail_out = available;
+
+            status = inflate(&stream, Z_NO_FLUSH);
+            buffer->AddSize(available - stream.avail_out);
+
+            if (status == Z_BUF_ERROR)
+            {
+                // No progress was possible because the buffer is full or because more input is needed.
+                // Running out of input before the end of the stream means that the data is truncated.
+
+                if (available == 0)
+                {
+                    buffer->Grow();
+                }
+                else if (endFlag)
+                {
+                    break;
+                }
+
+                status = Z_OK;
+            }
+            else if ((status != Z_OK) && (status != Z_STREAM_END))
+            {
+                break;
+            }
+        }
+
+        inflateEnd(&stream);
+        return (((status == Z_STREAM_END) && (!source->GetErrorFlag())) ? DataResult(kDataOkay) : DataResult(kDataOpenGexDecompressionFailed));
+    }
+
+#endif
+
+#ifdef OPENGEX_ZSTD
+
+    DataResult DecompressZstdText(TextSource* source, TextBuffer* buffer)
+    {
+        ZSTD_DStream* stream = ZSTD_createDStream();
+        if ((!stream) || (ZSTD_isError(ZSTD_initDStream(stream))))
+        {
+            ZSTD_freeDStream(stream);
+            return (kDataOpenGexDecompressionFailed);
+        }
+
+        ZSTD_inBuffer input = {nullptr, 0, 0};
+        size_t        status = 1;
+        bool          endFlag = false;
+        bool          success = true;
+
+        for (;;)
+        {
+            if ((input.pos == input.size) && (!endFlag))
+            {
+                const char* data = nullptr;
+                uint64      size = source->Read(&data);
+
+                endFlag = (size == 0);
+                input = {data, size_t(size), 0};
+            }
+
+            // A zero status means that a frame has ended and its output has been flushed.
+            // The stream starts a new frame if more input follows.
+
+            if ((endFlag) && (status == 0))
+            {
+                break;
+            }
+
+            ZSTD_outBuffer output = {buffer->GetEnd(), size_t(buffer->GetAvailableSize()), 0};
+            size_t         position = input.pos;
+
+            status = ZSTD_decompressStream(stream, &output, &input);
+            if (ZSTD_isError(status))
+            {
+                success = false;
+                break;
+            }
+
+            buffer->AddSize(output.pos);
+
+            if ((output.pos == 0) && (input.pos == position))
+            {
+                // No progress was possible because the buffer is full or because the data is truncated.
+
+                if (output.size != 0)
+                {
+                    success = false;
+                    break;
+                }
+
+                buffer->Grow();
+            }
+        }
+
+        ZSTD_freeDStream(stream);
+        return (((success) && (status == 0) && (!source->GetErrorFlag())) ? DataResult(kDataOkay) : DataResult(kDataOpenGexDecompressionFailed));
+    }
+
+#endif
+
+    DataResult Decompress(int32 format, TextSource* source, uint64 recordedSize, char** text, uint64* size)
+    {
+        DataResult result = kDataOpenGexCompressionUnsupported;
+        TextBuffer buffer(recordedSize);
+
+#ifdef OPENGEX_ZLIB
+
+        if (format == kCompressionGzip)
+        {
+            result = InflateText(source, &buffer);
+        }
+
+#endif
+
+#ifdef OPENGEX_ZSTD
+
+        if (format == kCompressionZstd)
+        {
+            result = DecompressZstdText(source, &buffer);
+        }
+
+#endif
+
+        (void) format;
+        (void) source;
+
+        if (result == kDataOkay)
+        {
+            buffer.Release(text, size);
+        }
+
+        return (result);
+    }
+
+    // The long used by fseek and ftell is 32 bits on Windows, so the 64-bit forms are used to handle files of 2 GB or more.
+
+    inline bool SeekFile(FILE* file, uint64 offset, int origin)
+    {
+#ifdef _WIN32
+        return (_fseeki64(file, int64(offset), origin) == 0);
+#else
+        return (fseeko(file, off_t(offset), origin) == 0);
+#endif
+    }
+
+    bool GetFileLength(FILE* file, uint64* length)
+    {
+        if (!SeekFile(file, 0, SEEK_END))
+        {
+            return (false);
+        }
+
+#ifdef _WIN32
+        int64 size = _ftelli64(file);
+#else
+        int64 size = int64(ftello(file));
+#endif
+
+        if ((size < 0) || (!SeekFile(file, 0, SEEK_SET)))
+        {
+            return (false);
+        }
+
+        *length = uint64(size);
+        return (true);
+    }
+
+    // Reads the beginning and, for gzip, the end of a file and returns its format and the recorded text size.
+    // The file is left at its beginning.
+
+    int32 ReadFileFormat(FILE* file, uint64 fileSize, uint64* recordedSize)
+    {
+        char   header[kFrameHeaderSize];
+        uint64 headerSize = fread(header, 1, kFrameHeaderSize, file);
+        int32  format = GetCompressionFormat(header, headerSize);
+
+        char  trailer[kGzipTrailerSize];
+        char* trailerPointer = nullptr;
+        if ((format == kCompressionGzip) && (fileSize >= kGzipTrailerSize))
+        {
+            if ((SeekFile(file, fileSize - kGzipTrailerSize, SEEK_SET)) && (fread(trailer, 1, kGzipTrailerSize, file) == kGzipTrailerSize))
+            {
+                trailerPointer = trailer;
+            }
+        }
+
+        SeekFile(file, 0, SEEK_SET);
+
+        *recordedSize = GetRecordedSize(format, header, headerSize, trailerPointer, fileSize);
+        return (format);
+    }
+} // namespace
+
+int32 OpenGEX::GetCompressionFormat(const void* data, uint64 size)
+{
+    const unsigned char* byte = static_cast<const unsigned char*>(data);
+
+    if ((size >= 2) && (byte[0] == 0x1F) && (byte[1] == 0x8B))
+    {
+        return (kCompressionGzip);
+    }
+
+    if ((size >= 4) && (byte[0] == 0x28) && (byte[1] == 0xB5) && (byte[2] == 0x2F) && (byte[3] == 0xFD))
+    {
+        return (kCompressionZstd);
+    }
+
+    return (kCompressionNone);
+}
+
+bool OpenGEX::GetCompressionSupport(int32 format)
+{
+#ifdef OPENGEX_ZLIB
+
+    if (format == kCompressionGzip)
+    {
+        return (true);
+    }
+
+#endif
+
+#ifdef OPENGEX_ZSTD
+
+    if (format == kCompressionZstd)
+    {
+        return (true);
+    }
+
+#endif
+
+    return (format == kCompressionNone);
+}
+
+uint64 OpenGEX::GetTextFileSize(const char* fileName)
+{
+    FILE* file = fopen(fileName, "rb");
+    if (!file)
+    {
+        return (0);
+    }
+
+    uint64 fileSize = 0;
+    uint64 size = 0;
+    if (GetFileLength(file, &fileSize))
+    {
+        ReadFileFormat(file, fileSize, &size);
+    }
+
+    fclose(file);
+    return (size);
+}
+
+DataResult OpenGEX::LoadTextFile(const char* fileName, char** text, uint64* size)
+{
+    OPENGEX_PROFILE_ZONE("LoadTextFile");
+
+    *text = nullptr;
+    *size = 0;
+
+    FILE* file = fopen(fileName, "rb");
+    if (!file)
+    {
+        return (kDataOpenGexFileUnreadable);
+    }
+
+    uint64 fileSize = 0;
+    if (!GetFileLength(file, &fileSize))
+    {
+        fclose(file);
+        return (kDataOpenGexFileUnreadable);
+    }
+
+    uint64     recordedSize = 0;
+    int32      format = ReadFileFormat(file, fileSize, &recordedSize);
+    DataResult result = kDataOkay;
+
+    if (format == kCompressionNone)
+    {
+        char* buffer = new char[fileSize + 1];
+        if (fread(buffer, 1, fileSize, file) == fileSize)
+        {
+            buffer[fileSize] = 0;
+            *text = buffer;
+            *size = fileSize;
+        }
+        else
+        {
+            delete[] buffer;
+            result = kDataOpenGexFileUnreadable;
+        }
+    }
+    else if (!GetCompressionSupport(format))
+    {
+        result = kDataOpenGexCompressionUnsupported;
+    }
+    else
+    {
+        TextSource source(file);
+        result = Decompress(format, &source, recordedSize, text, size);
+    }
+
+    fclose(file);
+    return (result);
+}
+
+DataResult OpenGEX::DecompressText(const void* data, uint64 dataSize, char** text, uint64* size)
+{
+    OPENGEX_PROFILE_ZONE("DecompressText");
+
+    *text = nullptr;
+    *size = 0;
+
+    int32 format = GetCompressionFormat(data, dataSize);
+    if (format == kCompressionNone)
+    {
+        char* buffer = new char[dataSize + 1];
+        memcpy(buffer, data, dataSize);
+        buffer[dataSize] = 0;
+
+        *text = buffer;
+        *size = dataSize;
+        return (kDataOkay);
+    }
+
+    if (!GetCompressionSupport(format))
+    {
+        return (kDataOpenGexCompressionUnsupported);
+    }
+
+    const char* trailer = (dataSize >= kGzipTrailerSize) ? static_cast<const char*>(data) + (dataSize - kGzipTrailerSize) : nullptr;
+    uint64      recordedSize = GetRecordedSize(format, static_cast<const char*>(data), Min(dataSize, uint64(kFrameHeaderSize)), trailer, dataSize);
+
+    TextSource source(data, dataSize);
+    return (Decompress(format, &source, recordedSize, text, size));
+}
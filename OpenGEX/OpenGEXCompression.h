@@ -0,0 +1,55 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#ifndef OpenGEXCompression_h
+#define OpenGEXCompression_h
+
+#include "TSOpenDDL.h"
+
+using namespace Terathon;
+
+namespace OpenGEX
+{
+    enum
+    {
+        kCompressionNone,
+        kCompressionGzip,
+        kCompressionZstd
+    };
+
+    enum
+    {
+        kCompressionChunkSize = 1 << 20
+    };
+
+    // Identifies gzip and zstd data by the magic number at its beginning. Anything else is treated as plain text.
+
+    int32 GetCompressionFormat(const void* data, uint64 size);
+
+    // Returns true if the library was built with the decompressor for a format. Plain text is always supported.
+
+    bool GetCompressionSupport(int32 format);
+
+    // Returns the size of the text in a file without decompressing it, taken from the zstd frame header or the gzip
+    // trailer. When the header doesn't record the size, this is the size of the file.
+
+    uint64 GetTextFileSize(const char* fileName);
+
+    // Reads a file into a zero-terminated buffer that is released with delete[], decompressing it if it is compressed.
+    // The compressed file is read in chunks and decompressed as it arrives, so it is never held in memory as a whole.
+    // The parser needs all of the text at once, so the text goes into one buffer allocated with the size recorded in
+    // the file, and the buffer only grows when no size is recorded or the recorded size is wrong.
+
+    DataResult LoadTextFile(const char* fileName, char** text, uint64* size);
+
+    // Decompresses data that is already in memory in the same way. Plain text is copied.
+
+    DataResult DecompressText(const void* data, uint64 dataSize, char** text, uint64* size);
+} // namespace OpenGEX
+
+#endif
@@ -0,0 +1,96 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#include "OpenGEXConvert.h"
+
+using namespace OpenGEX;
+
+uint32 OpenGEX::CalculateMaxIndex(const uint32* indexArray, machine count)
+{
+    uint32  maxIndex = 0;
+    machine a = 0;
+
+#ifdef TERATHON_SSE
+
+    if (count >= 4)
+    {
+        // SSE2 has no unsigned 32-bit max, so the values are biased into signed range and selected with a compare mask.
+
+        const __m128i bias = _mm_set1_epi32(int32(0x80000000));
+        __m128i       m = bias;
+
+        for (; a + 4 <= count; a += 4)
+        {
+            __m128i v = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(indexArray + a)), bias);
+            __m128i mask = _mm_cmpgt_epi32(v, m);
+            m = _mm_or_si128(_mm_and_si128(mask, v), _mm_andnot_si128(mask, m));
+        }
+
+        alignas(16) uint32 lane[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lane), _mm_xor_si128(m, bias));
+        maxIndex = Max(Max(lane[0], lane[1]), Max(lane[2], lane[3]));
+    }
+
+#endif
+
+    for (; a < count; a++)
+    {
+        maxIndex = Max(maxIndex, indexArray[a]);
+    }
+
+    return (maxIndex);
+}
+
+void OpenGEX::ConvertIndexArray(const uint32* input, machine count, uint16* output)
+{
+    machine a = 0;
+
+#ifdef TERATHON_SSE
+
+    // Values are shifted into signed 16-bit range so that the saturating pack is exact, and then shifted back.
+
+    const __m128i bias32 = _mm_set1_epi32(0x8000);
+    const __m128i bias16 = _mm_set1_epi16(int16(0x8000));
+
+    for (; a + 8 <= count; a += 8)
+    {
+        __m128i v0 = _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + a)), bias32);
+        __m128i v1 = _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + a + 4)), bias32);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + a), _mm_add_epi16(_mm_packs_epi32(v0, v1), bias16));
+    }
+
+#endif
+
+    for (; a < count; a++)
+    {
+        output[a] = uint16(input[a]);
+    }
+}
+
+void OpenGEX::ConvertIndexArray(const uint32* input, machine count, uint8* output)
+{
+    machine a = 0;
+
+#ifdef TERATHON_SSE
+
+    for (; a + 16 <= count; a += 16)
+    {
+        const __m128i* data = reinterpret_cast<const __m128i*>(input + a);
+
+        __m128i v0 = _mm_packs_epi32(_mm_loadu_si128(data), _mm_loadu_si128(data + 1));
+        __m128i v1 = _mm_packs_epi32(_mm_loadu_si128(data + 2), _mm_loadu_si128(data + 3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + a), _mm_packus_epi16(v0, v1));
+    }
+
+#endif
+
+    for (; a < count; a++)
+    {
+        output[a] = uint8(input[a]);
+    }
+}
@@ -0,0 +1,28 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#ifndef OpenGEXConvert_h
+#define OpenGEXConvert_h
+
+#include "TSMath.h"
+
+using namespace Terathon;
+
+namespace OpenGEX
+{
+    // Returns the largest value in an index array.
+
+    uint32 CalculateMaxIndex(const uint32* indexArray, machine count);
+
+    // Narrow 32-bit indexes to 16 or 8 bits. Every input value must fit in the output type.
+
+    void ConvertIndexArray(const uint32* input, machine count, uint16* output);
+    void ConvertIndexArray(const uint32* input, machine count, uint8* output);
+} // namespace OpenGEX
+
+#endif
@@ -0,0 +1,539 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#include "OpenGEXFileReader.h"
+#include "OpenGEXProfile.h"
+
+#include <cstdio>
+#include <cstring>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// IORING_OP_READ is an enumerator, so it can't be tested by the preprocessor. It was added to the header in the same
+// version as IORING_FEAT_RW_CUR_POS, which is tested instead. With older headers, reads fall back to the pread pool.
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) && defined(IORING_FEAT_RW_CUR_POS)
+#define OPENGEX_URING
+#endif
+#endif
+
+using namespace OpenGEX;
+
+namespace
+{
+    // The user data of the no-op that tells the completion thread to exit.
+
+    constexpr uint64 kExitUserData = ~uint64(0);
+
+    constexpr uint32 kFileReadAlignment = 4096;
+} // namespace
+
+FileRead::FileRead()
+{
+    fileDescriptor = -1;
+    fileSize = 0;
+    fileBuffer = nullptr;
+
+    remainingCount.store(0, std::memory_order_relaxed);
+    errorFlag.store(false, std::memory_order_relaxed);
+}
+
+FileRead::~FileRead()
+{
+#ifndef _WIN32
+
+    if (fileDescriptor >= 0)
+    {
+        close(fileDescriptor);
+    }
+
+#endif
+
+    delete[] fileBuffer;
+}
+
+FileReader::FileReader(int32 threadCount, uint32 chunk, int32 depth, bool uringFlag)
+{
+    readPool = nullptr;
+    chunkSize = Max((chunk + (kFileReadAlignment - 1)) & ~(kFileReadAlignment - 1), kFileReadAlignment);
+
+    queueDepth = 0;
+    inflightCount = 0;
+
+    ringDescriptor = -1;
+    for (machine a = 0; a < 3; a++)
+    {
+        ringStorage[a] = nullptr;
+        ringSize[a] = 0;
+    }
+
+    exitFlag = false;
+
+    if ((uringFlag) && (InitializeRing(Max(depth, 1))))
+    {
+        readerBackend = kFileReaderUring;
+        completeThread = std::thread(&FileReader::CompleteThread, this);
+    }
+    else
+    {
+        readerBackend = kFileReaderThreadPool;
+        readPool = new ThreadPool(Max(threadCount, 1));
+    }
+}
+
+FileReader::~FileReader()
+{
+    if (completeThread.joinable())
+    {
+        SubmitExit();
+        completeThread.join();
+    }
+
+    TerminateRing();
+    delete readPool;
+}
+
+bool FileReader::InitializeRing(int32 depth)
+{
+#ifdef OPENGEX_URING
+
+    io_uring_params params;
+    memset(&params, 0, sizeof(io_uring_params));
+
+    int descriptor = int(syscall(__NR_io_uring_setup, unsigned(depth), &params));
+    if (descriptor < 0)
+    {
+        return (false);
+    }
+
+    ringDescriptor = descriptor;
+    ringSize[0] = params.sq_off.array + params.sq_entries * sizeof(uint32);
+    ringSize[1] = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    ringSize[2] = params.sq_entries * sizeof(io_uring_sqe);
+
+    // With a single mapping, the completion ring shares the memory of the submission ring and isn't unmapped separately.
+
+    bool singleFlag = ((params.features & IORING_FEAT_SINGLE_MMAP) != 0);
+    if (singleFlag)
+    {
+        ringSize[0] = Max(ringSize[0], ringSize[1]);
+        ringSize[1] = 0;
+    }
+
+    void* storage = mmap(nullptr, ringSize[0], PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, descriptor, IORING_OFF_SQ_RING);
+    ringStorage[0] = (storage != MAP_FAILED) ? storage : nullptr;
+
+    if (singleFlag)
+    {
+        ringStorage[1] = ringStorage[0];
+    }
+    else
+    {
+        storage = mmap(nullptr, ringSize[1], PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, descriptor, IORING_OFF_CQ_RING);
+        ringStorage[1] = (storage != MAP_FAILED) ? storage : nullptr;
+    }
+
+    storage = mmap(nullptr, ringSize[2], PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, descriptor, IORING_OFF_SQES);
+    ringStorage[2] = (storage != MAP_FAILED) ? storage : nullptr;
+
+    if ((!ringStorage[0]) || (!ringStorage[1]) || (!ringStorage[2]))
+    {
+        TerminateRing();
+        return (false);
+    }
+
+    char* submitRing = static_cast<char*>(ringStorage[0]);
+    submitHead = reinterpret_cast<uint32*>(submitRing + params.sq_off.head);
+    submitTail = reinterpret_cast<uint32*>(submitRing + params.sq_off.tail);
+    submitMask = reinterpret_cast<uint32*>(submitRing + params.sq_off.ring_mask);
+    submitArray = reinterpret_cast<uint32*>(submitRing + params.sq_off.array);
+    submitEntryArray = ringStorage[2];
+
+    char* completeRing = static_cast<char*>(ringStorage[1]);
+    completeHead = reinterpret_cast<uint32*>(completeRing + params.cq_off.head);
+    completeTail = reinterpret_cast<uint32*>(completeRing + params.cq_off.tail);
+    completeMask = reinterpret_cast<uint32*>(completeRing + params.cq_off.ring_mask);
+    completeEntryArray = completeRing + params.cq_off.cqes;
+
+    // The completion ring is at least as large as the submission ring, so limiting the reads in flight
+    // to the number of submission entries means that completions can never overflow.
+
+    queueDepth = int32(params.sq_entries);
+    slotArray.resize(queueDepth);
+    freeSlotArray.resize(queueDepth);
+    for (machine a = 0; a < queueDepth; a++)
+    {
+        freeSlotArray[a] = int32(queueDepth - 1 - a);
+    }
+
+    return (true);
+
+#else
+
+    (void) depth;
+    return (false);
+
+#endif
+}
+
+void FileReader::TerminateRing(void)
+{
+#ifdef OPENGEX_URING
+
+    for (machine a = 0; a < 3; a++)
+    {
+        if ((ringStorage[a]) && (ringSize[a] != 0))
+        {
+            munmap(ringStorage[a], ringSize[a]);
+        }
+
+        ringStorage[a] = nullptr;
+    }
+
+    if (ringDescriptor >= 0)
+    {
+        close(ringDescriptor);
+        ringDescriptor = -1;
+    }
+
+#endif
+}
+
+void FileReader::SubmitChunks(void)
+{
+#ifdef OPENGEX_URING
+
+    // Called with the read mutex locked. Only this function and SubmitExit() write the submission tail.
+
+    io_uring_sqe* entryArray = static_cast<io_uring_sqe*>(submitEntryArray);
+    uint32        tail = *submitTail;
+    uint32        mask = *submitMask;
+
+    while ((!pendingQueue.empty()) && (inflightCount < queueDepth))
+    {
+        const ChunkRead& chunk = pendingQueue.front();
+
+        int32 slot = freeSlotArray.back();
+        freeSlotArray.pop_back();
+        slotArray[slot] = chunk;
+
+        uint32        index = tail & mask;
+        io_uring_sqe* entry = &entryArray[index];
+        memset(entry, 0, sizeof(io_uring_sqe));
+        entry->opcode = IORING_OP_READ;
+        entry->fd = chunk.fileRead->fileDescriptor;
+        entry->off = chunk.offset;
+        entry->addr = uint64(reinterpret_cast<uintptr_t>(chunk.fileRead->fileBuffer + chunk.offset));
+        entry->len = chunk.size;
+        entry->user_data = uint64(slot);
+
+        submitArray[index] = index;
+        tail++;
+
+        pendingQueue.pop_front();
+        inflightCount++;
+    }
+
+    __atomic_store_n(submitTail, tail, __ATOMIC_RELEASE);
+
+    // Entries that the kernel didn't accept last time are still in the ring and are submitted along with the new ones.
+
+    uint32 count = tail - __atomic_load_n(submitHead, __ATOMIC_ACQUIRE);
+    if (count != 0)
+    {
+        syscall(__NR_io_uring_enter, ringDescriptor, count, 0, 0, nullptr, 0);
+    }
+
+#endif
+}
+
+void FileReader::SubmitExit(void)
+{
+#ifdef OPENGEX_URING
+
+    std::lock_guard<std::mutex> lock(readMutex);
+
+    uint32        tail = *submitTail;
+    uint32        index = tail & *submitMask;
+    io_uring_sqe* entry = &static_cast<io_uring_sqe*>(submitEntryArray)[index];
+    memset(entry, 0, sizeof(io_uring_sqe));
+    entry->opcode = IORING_OP_NOP;
+    entry->user_data = kExitUserData;
+
+    submitArray[index] = index;
+    __atomic_store_n(submitTail, tail + 1, __ATOMIC_RELEASE);
+
+    uint32 count = tail + 1 - __atomic_load_n(submitHead, __ATOMIC_ACQUIRE);
+    syscall(__NR_io_uring_enter, ringDescriptor, count, 0, 0, nullptr, 0);
+
+#endif
+}
+
+void FileReader::CompleteThread(void)
+{
+#ifdef OPENGEX_URING
+
+    SetProfileThreadName("OpenGEX File Reader");
+
+    const io_uring_cqe*    entryArray = static_cast<const io_uring_cqe*>(completeEntryArray);
+    std::vector<FileRead*> finishArray;
+    std::vector<ChunkRead> retryArray;
+
+    while (!exitFlag)
+    {
+        syscall(__NR_io_uring_enter, ringDescriptor, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+
+        {
+            std::lock_guard<std::mutex> lock(readMutex);
+
+            uint32 head = *completeHead;
+            uint32 tail = __atomic_load_n(completeTail, __ATOMIC_ACQUIRE);
+            uint32 mask = *completeMask;
+
+            for (; head != tail; head++)
+            {
+                const io_uring_cqe* entry = &entryArray[head & mask];
+                if (entry->user_data == kExitUserData)
+                {
+                    exitFlag = true;
+                    continue;
+                }
+
+                int32     slot = int32(entry->user_data);
+                ChunkRead chunk = slotArray[slot];
+                freeSlotArray.push_back(slot);
+                inflightCount--;
+
+                int32 result = entry->res;
+                if (result == int32(chunk.size))
+                {
+                    finishArray.push_back(chunk.fileRead);
+                }
+                else if (result > 0)
+                {
+                    // A short read is queued again for the remainder of the chunk.
+
+                    chunk.offset += uint32(result);
+                    chunk.size -= uint32(result);
+                    pendingQueue.push_front(chunk);
+                }
+                else
+                {
+                    // Failed reads, including those of a kernel without IORING_OP_READ, are tried again with pread.
+
+                    retryArray.push_back(chunk);
+                }
+            }
+
+            __atomic_store_n(completeHead, head, __ATOMIC_RELEASE);
+            SubmitChunks();
+        }
+
+        for (FileRead* fileRead : finishArray)
+        {
+            FinishChunk(fileRead, true);
+        }
+
+        for (const ChunkRead& chunk : retryArray)
+        {
+            ReadChunk(chunk);
+        }
+
+        finishArray.clear();
+        retryArray.clear();
+    }
+
+#endif
+}
+
+void FileReader::ReadChunk(const ChunkRead& chunk)
+{
+    OPENGEX_PROFILE_ZONE("FileReader::ReadChunk");
+
+    FileRead* fileRead = chunk.fileRead;
+    char*     buffer = fileRead->fileBuffer + chunk.offset;
+    bool      success = true;
+
+#ifdef _WIN32
+
+    FILE* file = fopen(fileRead->fileName.c_str(), "rb");
+    success = ((file) && (_fseeki64(file, int64(chunk.offset), SEEK_SET) == 0) && (fread(buffer, 1, chunk.size, file) == chunk.size));
+    if (file)
+    {
+        fclose(file);
+    }
+
+#else
+
+    uint64 offset = chunk.offset;
+    uint32 size = chunk.size;
+    while (size != 0)
+    {
+        ssize_t count = pread(fileRead->fileDescriptor, buffer, size, off_t(offset));
+        if (count <= 0)
+        {
+            if ((count < 0) && (errno == EINTR))
+            {
+                continue;
+            }
+
+            success = false;
+            break;
+        }
+
+        buffer += count;
+        offset += uint64(count);
+        size -= uint32(count);
+    }
+
+#endif
+
+    FinishChunk(fileRead, success);
+}
+
+void FileReader::FinishChunk(FileRead* fileRead, bool success)
+{
+    if (!success)
+    {
+        fileRead->errorFlag.store(true, std::memory_order_relaxed);
+    }
+
+    if (fileRead->remainingCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        // The mutex is locked so that the notification can't fall between the check and the wait in FinishRead().
+
+        std::lock_guard<std::mutex> lock(readMutex);
+        readCondition.notify_all();
+    }
+}
+
+FileRead* FileReader::BeginRead(const char* fileName)
+{
+    OPENGEX_PROFILE_ZONE("FileReader::BeginRead");
+
+    FileRead* fileRead = new FileRead;
+    fileRead->fileName = fileName;
+
+#ifdef _WIN32
+
+    FILE* file = fopen(fileName, "rb");
+    if (!file)
+    {
+        delete fileRead;
+        return (nullptr);
+    }
+
+    _fseeki64(file, 0, SEEK_END);
+    fileRead->fileSize = uint64(Max(_ftelli64(file), int64(0)));
+    fclose(file);
+
+#else
+
+    int descriptor = open(fileName, O_RDONLY | O_CLOEXEC);
+    if (descriptor < 0)
+    {
+        delete fileRead;
+        return (nullptr);
+    }
+
+    fileRead->fileDescriptor = descriptor;
+
+    struct stat status;
+    if (fstat(descriptor, &status) != 0)
+    {
+        delete fileRead;
+        return (nullptr);
+    }
+
+    fileRead->fileSize = uint64(status.st_size);
+
+#endif
+
+    uint64 size = fileRead->fileSize;
+    fileRead->fileBuffer = new char[size + 1];
+    fileRead->fileBuffer[size] = 0;
+
+    int32 chunkCount = int32((size + chunkSize - 1) / chunkSize);
+    if (chunkCount == 0)
+    {
+        return (fileRead);
+    }
+
+    fileRead->remainingCount.store(chunkCount, std::memory_order_relaxed);
+
+    if (readerBackend == kFileReaderUring)
+    {
+        std::lock_guard<std::mutex> lock(readMutex);
+
+        for (machine a = 0; a < chunkCount; a++)
+        {
+            uint64 offset = uint64(a) * chunkSize;
+            pendingQueue.push_back(ChunkRead{fileRead, offset, uint32(Min(size - offset, uint64(chunkSize)))});
+        }
+
+        SubmitChunks();
+    }
+    else
+    {
+        // Without worker threads, submitted jobs would never run, so the chunks are read by the calling thread.
+
+        bool inlineFlag = (readPool->GetThreadCount() == 0);
+
+        for (machine a = 0; a < chunkCount; a++)
+        {
+            uint64    offset = uint64(a) * chunkSize;
+            ChunkRead chunk = {fileRead, offset, uint32(Min(size - offset, uint64(chunkSize)))};
+
+            if (inlineFlag)
+            {
+                ReadChunk(chunk);
+            }
+            else
+            {
+                readPool->SubmitJob([this, chunk] { ReadChunk(chunk); });
+            }
+        }
+    }
+
+    return (fileRead);
+}
+
+bool FileReader::FinishRead(FileRead* fileRead, char** buffer, uint64* size)
+{
+    OPENGEX_PROFILE_ZONE("FileReader::FinishRead");
+
+    {
+        std::unique_lock<std::mutex> lock(readMutex);
+        readCondition.wait(lock, [fileRead] { return (fileRead->IsFinished()); });
+    }
+
+    bool success = !fileRead->errorFlag.load(std::memory_order_relaxed);
+    if (success)
+    {
+        *buffer = fileRead->fileBuffer;
+        *size = fileRead->fileSize;
+        fileRead->fileBuffer = nullptr;
+    }
+    else
+    {
+        *buffer = nullptr;
+        *size = 0;
+    }
+
+    delete fileRead;
+    return (success);
+}
@@ -0,0 +1,155 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#ifndef OpenGEXFileReader_h
+#define OpenGEXFileReader_h
+
+#include "OpenGEXThreadPool.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Terathon;
+
+namespace OpenGEX
+{
+    class FileReader;
+
+    enum
+    {
+        kFileReadDefaultThreadCount = 4,
+        kFileReadDefaultChunkSize = 1 << 20,
+        kFileReadDefaultQueueDepth = 64
+    };
+
+    enum
+    {
+        kFileReaderThreadPool,
+        kFileReaderUring
+    };
+
+    // One file being read by a file reader. The file is split into chunks that are read independently, and the read
+    // is finished when every chunk has arrived. The buffer has one extra byte holding a zero terminator.
+
+    class FileRead
+    {
+        friend class FileReader;
+
+    private:
+        std::string fileName;
+        int         fileDescriptor;
+        uint64      fileSize;
+        char*       fileBuffer;
+
+        std::atomic<int32> remainingCount;
+        std::atomic<bool>  errorFlag;
+
+        FileRead();
+        ~FileRead();
+
+    public:
+        FileRead(const FileRead&) = delete;
+        FileRead& operator=(const FileRead&) = delete;
+
+        uint64 GetFileSize(void) const
+        {
+            return (fileSize);
+        }
+
+        bool IsFinished(void) const
+        {
+            return (remainingCount.load(std::memory_order_acquire) == 0);
+        }
+    };
+
+    // Reads whole files in chunks ahead of the code that uses them. On Linux, chunk reads are queued to io_uring and
+    // completed by a thread belonging to the reader, so that many reads are in flight while the caller parses and
+    // processes earlier files. Where io_uring isn't available, including when the kernel refuses to create a ring,
+    // each chunk is read with a positional read by a job on a thread pool owned by the reader. The pool is separate
+    // from any pool used for loading so that a load job waiting for its file can't hold up the reads it waits for.
+    // Every read must be finished before the reader is destroyed.
+
+    class FileReader
+    {
+        struct ChunkRead
+        {
+            FileRead* fileRead;
+            uint64    offset;
+            uint32    size;
+        };
+
+    private:
+        ThreadPool* readPool;
+        uint32      chunkSize;
+        int32       readerBackend;
+
+        std::mutex              readMutex;
+        std::condition_variable readCondition;
+
+        int32                  queueDepth;
+        int32                  inflightCount;
+        std::deque<ChunkRead>  pendingQueue;
+        std::vector<ChunkRead> slotArray;
+        std::vector<int32>     freeSlotArray;
+
+        int         ringDescriptor;
+        void*       ringStorage[3];
+        uint64      ringSize[3];
+        uint32*     submitHead;
+        uint32*     submitTail;
+        uint32*     submitMask;
+        uint32*     submitArray;
+        void*       submitEntryArray;
+        uint32*     completeHead;
+        uint32*     completeTail;
+        uint32*     completeMask;
+        void*       completeEntryArray;
+        std::thread completeThread;
+        bool        exitFlag;
+
+        bool InitializeRing(int32 depth);
+        void TerminateRing(void);
+        void SubmitChunks(void);
+        void SubmitExit(void);
+        void CompleteThread(void);
+
+        void ReadChunk(const ChunkRead& chunk);
+        void FinishChunk(FileRead* fileRead, bool success);
+
+    public:
+        // The thread count is only used without io_uring. The chunk size is rounded up to a multiple of 4096 bytes,
+        // and the queue depth limits the number of io_uring reads in flight.
+
+        FileReader(int32 threadCount = kFileReadDefaultThreadCount, uint32 chunk = kFileReadDefaultChunkSize, int32 depth = kFileReadDefaultQueueDepth, bool uringFlag = true);
+        ~FileReader();
+
+        FileReader(const FileReader&) = delete;
+        FileReader& operator=(const FileReader&) = delete;
+
+        int32 GetBackend(void) const
+        {
+            return (readerBackend);
+        }
+
+        // Starts reading a file and returns immediately, or returns nullptr if the file can't be opened.
+
+        FileRead* BeginRead(const char* fileName);
+
+        // Waits for a read to finish and deletes it. On success, the caller receives the zero-terminated buffer, which is
+        // released with delete[], and its size without the terminator. On failure, the buffer is null.
+
+        bool FinishRead(FileRead* fileRead, char** buffer, uint64* size);
+    };
+} // namespace OpenGEX
+
+#endif
@@ -0,0 +1,137 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#include "OpenGEXLoader.h"
+#include "OpenGEX.h"
+
+using namespace OpenGEX;
+
+LoadMonitor::LoadMonitor()
+{
+    Reset(0);
+}
+
+LoadMonitor::~LoadMonitor()
+{
+}
+
+void LoadMonitor::Reset(uint64 size)
+{
+    loadStage.store(kLoadStageWaiting, std::memory_order_relaxed);
+    textSize.store(size, std::memory_order_relaxed);
+    parsedSize.store(0, std::memory_order_relaxed);
+    structureCount.store(0, std::memory_order_relaxed);
+    processedCount.store(0, std::memory_order_relaxed);
+    meshCount.store(0, std::memory_order_relaxed);
+    processedMeshCount.store(0, std::memory_order_relaxed);
+    cancelFlag.store(false, std::memory_order_relaxed);
+}
+
+void LoadMonitor::FinishParse(void)
+{
+    parsedSize.store(textSize.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    loadStage.store(kLoadStageProcess, std::memory_order_relaxed);
+}
+
+void LoadMonitor::GetProgress(LoadProgress* progress) const
+{
+    progress->loadStage = loadStage.load(std::memory_order_relaxed);
+    progress->textSize = textSize.load(std::memory_order_relaxed);
+    progress->parsedSize = parsedSize.load(std::memory_order_relaxed);
+    progress->structureCount = structureCount.load(std::memory_order_relaxed);
+    progress->processedCount = processedCount.load(std::memory_order_relaxed);
+    progress->meshCount = meshCount.load(std::memory_order_relaxed);
+    progress->processedMeshCount = processedMeshCount.load(std::memory_order_relaxed);
+}
+
+LoadTask::LoadTask(OpenGexDataDescription* description, std::string&& text, bool compact) : loadText(std::move(text))
+{
+    dataDescription = description;
+    compactScene = nullptr;
+    compactFlag = compact;
+
+    loadResult = kDataOkay;
+    finishFlag.store(false, std::memory_order_relaxed);
+
+    loadMonitor.Reset(loadText.size());
+    dataDescription->SetLoadMonitor(&loadMonitor);
+
+    loadThread = std::thread(&LoadTask::RunLoad, this);
+}
+
+LoadTask::~LoadTask()
+{
+    loadMonitor.Cancel();
+    Wait();
+
+    delete compactScene;
+    delete dataDescription;
+}
+
+void LoadTask::RunLoad(void)
+{
+    SetProfileThreadName("OpenGEX Loader");
+
+    loadMonitor.SetLoadStage(kLoadStageParse);
+    DataResult result = dataDescription->ProcessText(loadText.c_str());
+
+    // The structures hold their own copies of the data, so the text isn't needed after parsing.
+
+    std::string().swap(loadText);
+
+    if ((result == kDataOkay) && (compactFlag))
+    {
+        compactScene = dataDescription->CreateCompactScene();
+        delete dataDescription;
+        dataDescription = nullptr;
+    }
+
+    if (dataDescription)
+    {
+        dataDescription->SetLoadMonitor(nullptr);
+    }
+
+    loadResult = result;
+    loadMonitor.SetLoadStage(kLoadStageDone);
+    finishFlag.store(true, std::memory_order_release);
+}
+
+void LoadTask::Wait(void)
+{
+    // Joining a thread that another thread is already joining is undefined, so waiting threads are serialized.
+
+    std::lock_guard<std::mutex> lock(waitMutex);
+    if (loadThread.joinable())
+    {
+        loadThread.join();
+    }
+}
+
+DataResult LoadTask::GetResult(void)
+{
+    Wait();
+    return (loadResult);
+}
+
+OpenGexDataDescription* LoadTask::ReleaseDataDescription(void)
+{
+    Wait();
+
+    OpenGexDataDescription* description = dataDescription;
+    dataDescription = nullptr;
+    return (description);
+}
+
+CompactScene* LoadTask::ReleaseCompactScene(void)
+{
+    Wait();
+
+    CompactScene* scene = compactScene;
+    compactScene = nullptr;
+    return (scene);
+}
@@ -0,0 +1,166 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#ifndef OpenGEXLoader_h
+#define OpenGEXLoader_h
+
+#include "TSOpenDDL.h"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+
+using namespace Terathon;
+
+namespace OpenGEX
+{
+    class CompactScene;
+    class OpenGexDataDescription;
+
+    enum
+    {
+        kLoadStageWaiting,
+        kLoadStageParse,
+        kLoadStageProcess,
+        kLoadStageMeshes,
+        kLoadStageFinish,
+        kLoadStageDone
+    };
+
+    // The parser doesn't report its position, so the parsed size jumps to the text size when parsing ends, and the
+    // structure count shows progress while parsing. Structures are counted as processed when their processing begins.
+
+    struct LoadProgress
+    {
+        int32  loadStage;
+        uint64 textSize;
+        uint64 parsedSize;
+        int32  structureCount;
+        int32  processedCount;
+        int32  meshCount;
+        int32  processedMeshCount;
+    };
+
+    // A load monitor attached to a description collects progress from the thread loading it, and any thread can
+    // read the progress or request cancellation at the same time. Cancellation is checked before each top-level
+    // structure and mesh array is parsed and as each structure and mesh is processed, and the load then fails
+    // with kDataOpenGexLoadCancelled.
+
+    class LoadMonitor
+    {
+    private:
+        std::atomic<int32>  loadStage;
+        std::atomic<uint64> textSize;
+        std::atomic<uint64> parsedSize;
+        std::atomic<int32>  structureCount;
+        std::atomic<int32>  processedCount;
+        std::atomic<int32>  meshCount;
+        std::atomic<int32>  processedMeshCount;
+        std::atomic<bool>   cancelFlag;
+
+    public:
+        LoadMonitor();
+        ~LoadMonitor();
+
+        bool GetCancelFlag(void) const
+        {
+            return (cancelFlag.load(std::memory_order_relaxed));
+        }
+
+        void Cancel(void)
+        {
+            cancelFlag.store(true, std::memory_order_relaxed);
+        }
+
+        void SetLoadStage(int32 stage)
+        {
+            loadStage.store(stage, std::memory_order_relaxed);
+        }
+
+        void AddStructure(void)
+        {
+            structureCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void AddProcessedStructure(void)
+        {
+            processedCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void SetMeshCount(int32 count)
+        {
+            meshCount.store(count, std::memory_order_relaxed);
+        }
+
+        void AddProcessedMesh(void)
+        {
+            processedMeshCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void Reset(uint64 size);
+        void FinishParse(void);
+        void GetProgress(LoadProgress* progress) const;
+    };
+
+    // Loads a description on a background thread. The task takes ownership of the description and the text, and the
+    // description should be fully configured, including any thread pool used to process meshes, before the task is
+    // created. With the compact flag, the task replaces the description with a compact scene once it is processed.
+    //
+    // The results are handed back by releasing them, after which the caller owns them. Destroying an unfinished task
+    // cancels the load and waits for it to stop.
+
+    class LoadTask
+    {
+    private:
+        OpenGexDataDescription* dataDescription;
+        CompactScene*           compactScene;
+        std::string             loadText;
+        bool                    compactFlag;
+
+        LoadMonitor       loadMonitor;
+        DataResult        loadResult;
+        std::atomic<bool> finishFlag;
+        std::thread       loadThread;
+        std::mutex        waitMutex;
+
+        void RunLoad(void);
+
+    public:
+        LoadTask(OpenGexDataDescription* description, std::string&& text, bool compact = false);
+        ~LoadTask();
+
+        LoadTask(const LoadTask&) = delete;
+        LoadTask& operator=(const LoadTask&) = delete;
+
+        bool IsFinished(void) const
+        {
+            return (finishFlag.load(std::memory_order_acquire));
+        }
+
+        void Cancel(void)
+        {
+            loadMonitor.Cancel();
+        }
+
+        void GetProgress(LoadProgress* progress) const
+        {
+            loadMonitor.GetProgress(progress);
+        }
+
+        // The following wait for the load to finish, and several threads can wait at once. The description is
+        // null for a compact load, and the scene is null otherwise or if the load failed.
+
+        void                    Wait(void);
+        DataResult              GetResult(void);
+        OpenGexDataDescription* ReleaseDataDescription(void);
+        CompactScene*           ReleaseCompactScene(void);
+    };
+} // namespace OpenGEX
+
+#endif
@@ -0,0 +1,213 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#include "OpenGEXMemory.h"
+
+using namespace OpenGEX;
+
+namespace
+{
+    template <class type>
+    uint64 GetDataSize(const Structure* structure)
+    {
+        return (uint64(static_cast<const DataStructure<type>*>(structure)->GetDataElementCount()) * sizeof(typename type::PrimType));
+    }
+
+    template <class type>
+    const void* GetData(const Structure* structure)
+    {
+        const DataStructure<type>* dataStructure = static_cast<const DataStructure<type>*>(structure);
+        return ((dataStructure->GetDataElementCount() != 0) ? &dataStructure->GetDataElement(0) : nullptr);
+    }
+
+    void AccumulateUsage(MemoryUsage& sum, const MemoryUsage& usage)
+    {
+        sum.parserSize += usage.parserSize;
+        sum.processedSize += usage.processedSize;
+        sum.redundantSize += usage.redundantSize;
+        sum.duplicateSize += usage.duplicateSize;
+    }
+} // namespace
+
+MemoryAccount::MemoryAccount(MemoryReport* report)
+{
+    memoryReport = report;
+}
+
+void MemoryAccount::AddUsage(StructureType type, const MeshStructure* meshStructure, std::string_view attrib, const MemoryUsage& usage)
+{
+    AccumulateUsage(memoryReport->totalUsage, usage);
+    AccumulateUsage(memoryReport->structureUsageMap[type], usage);
+
+    if (!attrib.empty())
+    {
+        AccumulateUsage(memoryReport->attribUsageMap[std::string(attrib)], usage);
+    }
+
+    if (meshStructure)
+    {
+        auto iterator = meshIndexMap.find(meshStructure);
+        if (iterator == meshIndexMap.end())
+        {
+            iterator = meshIndexMap.emplace(meshStructure, int32(memoryReport->meshUsageArray.size())).first;
+            memoryReport->meshUsageArray.push_back(MeshMemoryUsage{meshStructure, MemoryUsage{}});
+        }
+
+        AccumulateUsage(memoryReport->meshUsageArray[iterator->second].usage, usage);
+    }
+}
+
+void MemoryAccount::AddParserData(StructureType type, const MeshStructure* meshStructure, std::string_view attrib, uint64 size, bool redundantFlag)
+{
+    AddUsage(type, meshStructure, attrib, MemoryUsage{size, 0, (redundantFlag) ? size : 0, 0});
+}
+
+void MemoryAccount::AddProcessedData(StructureType type, const MeshStructure* meshStructure, std::string_view attrib, uint64 size, bool duplicateFlag)
+{
+    AddUsage(type, meshStructure, attrib, MemoryUsage{0, size, 0, (duplicateFlag) ? size : 0});
+}
+
+const void* OpenGEX::GetPrimitiveData(const Structure* structure)
+{
+    switch (structure->GetStructureType())
+    {
+    case kDataBool:
+
+        return (GetData<BoolDataType>(structure));
+
+    case kDataInt8:
+
+        return (GetData<Int8DataType>(structure));
+
+    case kDataInt16:
+
+        return (GetData<Int16DataType>(structure));
+
+    case kDataInt32:
+
+        return (GetData<Int32DataType>(structure));
+
+    case kDataInt64:
+
+        return (GetData<Int64DataType>(structure));
+
+    case kDataUInt8:
+
+        return (GetData<UInt8DataType>(structure));
+
+    case kDataUInt16:
+
+        return (GetData<UInt16DataType>(structure));
+
+    case kDataUInt32:
+
+        return (GetData<UInt32DataType>(structure));
+
+    case kDataUInt64:
+
+        return (GetData<UInt64DataType>(structure));
+
+    case kDataHalf:
+
+        return (GetData<HalfDataType>(structure));
+
+    case kDataFloat:
+
+        return (GetData<FloatDataType>(structure));
+
+    case kDataDouble:
+
+        return (GetData<DoubleDataType>(structure));
+
+    case kDataString:
+
+        return (GetData<StringDataType>(structure));
+
+    case kDataRef:
+
+        return (GetData<RefDataType>(structure));
+    }
+
+    return (nullptr);
+}
+
+uint64 OpenGEX::GetPrimitiveDataSize(const Structure* structure)
+{
+    switch (structure->GetStructureType())
+    {
+    case kDataBool:
+
+        return (GetDataSize<BoolDataType>(structure));
+
+    case kDataInt8:
+
+        return (GetDataSize<Int8DataType>(structure));
+
+    case kDataInt16:
+
+        return (GetDataSize<Int16DataType>(structure));
+
+    case kDataInt32:
+
+        return (GetDataSize<Int32DataType>(structure));
+
+    case kDataInt64:
+
+        return (GetDataSize<Int64DataType>(structure));
+
+    case kDataUInt8:
+
+        return (GetDataSize<UInt8DataType>(structure));
+
+    case kDataUInt16:
+
+        return (GetDataSize<UInt16DataType>(structure));
+
+    case kDataUInt32:
+
+        return (GetDataSize<UInt32DataType>(structure));
+
+    case kDataUInt64:
+
+        return (GetDataSize<UInt64DataType>(structure));
+
+    case kDataHalf:
+
+        return (GetDataSize<HalfDataType>(structure));
+
+    case kDataFloat:
+
+        return (GetDataSize<FloatDataType>(structure));
+
+    case kDataDouble:
+
+        return (GetDataSize<DoubleDataType>(structure));
+
+    case kDataRef:
+
+        return (GetDataSize<RefDataType>(structure));
+
+    case kDataString:
+    {
+        // Strings are counted by their lengths in addition to the string objects themselves.
+
+        const DataStructure<StringDataType>* dataStructure = static_cast<const DataStructure<StringDataType>*>(structure);
+        int32                                count = dataStructure->GetDataElementCount();
+
+        uint64 size = GetDataSize<StringDataType>(structure);
+        for (machine a = 0; a < count; a++)
+        {
+            size += dataStructure->GetDataElement(int32(a)).size();
+        }
+
+        return (size);
+    }
+    }
+
+    return (0);
+}
@@ -0,0 +1,78 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#ifndef OpenGEXMemory_h
+#define OpenGEXMemory_h
+
+#include "TSOpenDDL.h"
+
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+using namespace Terathon;
+
+namespace OpenGEX
+{
+    class MeshStructure;
+
+    // Bytes of array data, split by owner. Parser data is the primitive data read from the text, and processed data
+    // is everything allocated while processing it, including converted copies, packed skins, morph targets, meshlets,
+    // and generated meshes. Structure objects and short strings are not counted.
+
+    struct MemoryUsage
+    {
+        uint64 parserSize;
+        uint64 processedSize;
+        uint64 redundantSize; // Parser data that has been replaced by processed data and is no longer used.
+        uint64 duplicateSize; // Processed data that is an exact copy of the parser data it came from.
+    };
+
+    struct MeshMemoryUsage
+    {
+        const MeshStructure* meshStructure;
+        MemoryUsage          usage;
+    };
+
+    // Parser data is attributed to the structure containing it. Attributes are the attrib strings of vertex arrays
+    // and fixed names such as "index" and "skin" for other mesh data. Meshes appear in the order they were reached.
+
+    struct MemoryReport
+    {
+        MemoryUsage                           totalUsage;
+        std::map<StructureType, MemoryUsage>  structureUsageMap;
+        std::map<std::string, MemoryUsage>    attribUsageMap;
+        std::vector<MeshMemoryUsage>          meshUsageArray;
+    };
+
+    class MemoryAccount
+    {
+    private:
+        MemoryReport*                                   memoryReport;
+        std::unordered_map<const MeshStructure*, int32> meshIndexMap;
+
+        void AddUsage(StructureType type, const MeshStructure* meshStructure, std::string_view attrib, const MemoryUsage& usage);
+
+    public:
+        explicit MemoryAccount(MemoryReport* report);
+
+        // The mesh and attribute can be null and empty for data that doesn't belong to a mesh.
+
+        void AddParserData(StructureType type, const MeshStructure* meshStructure, std::string_view attrib, uint64 size, bool redundantFlag);
+        void AddProcessedData(StructureType type, const MeshStructure* meshStructure, std::string_view attrib, uint64 size, bool duplicateFlag);
+    };
+
+    // Return the data held by a primitive structure, or nullptr if it's empty, and the number of bytes it occupies.
+
+    const void* GetPrimitiveData(const Structure* structure);
+    uint64      GetPrimitiveDataSize(const Structure* structure);
+} // namespace OpenGEX
+
+#endif
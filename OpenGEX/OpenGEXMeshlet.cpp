@@ -0,0 +1,322 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#include "OpenGEXMeshlet.h"
+
+using namespace OpenGEX;
+
+namespace
+{
+    inline Point3D GetPosition(const float* positionArray, int32 positionStride, uint32 index)
+    {
+        const float* p = positionArray + index * positionStride;
+        return (Point3D(p[0], p[1], p[2]));
+    }
+} // namespace
+
+int32 OpenGEX::BuildMeshlets(const uint32* indexArray, int32 triangleCount, const float* positionArray, int32 positionStride, int32 vertexCount, int32 maxVertexCount,
+                             int32 maxTriangleCount, Meshlet* meshletArray, uint32* meshletVertexArray, uint8* meshletTriangleArray)
+{
+    if (triangleCount == 0)
+    {
+        return (0);
+    }
+
+    maxVertexCount = Clamp(maxVertexCount, 3, int32(kMeshletMaxVertexCount));
+    maxTriangleCount = Clamp(maxTriangleCount, 1, int32(kMeshletMaxTriangleCount));
+
+    int32 indexCount = triangleCount * 3;
+
+    // Build the vertex-to-triangle adjacency. Triangles are removed from the lists as they are assigned to meshlets,
+    // so the lists only ever contain candidates.
+
+    int32* valenceArray = new int32[vertexCount];
+    int32* offsetArray = new int32[vertexCount];
+    int32* adjacencyArray = new int32[indexCount];
+
+    for (machine a = 0; a < vertexCount; a++)
+    {
+        valenceArray[a] = 0;
+    }
+
+    for (machine a = 0; a < indexCount; a++)
+    {
+        valenceArray[indexArray[a]]++;
+    }
+
+    int32 offset = 0;
+    for (machine a = 0; a < vertexCount; a++)
+    {
+        offsetArray[a] = offset;
+        offset += valenceArray[a];
+        valenceArray[a] = 0;
+    }
+
+    for (machine a = 0; a < triangleCount; a++)
+    {
+        for (machine k = 0; k < 3; k++)
+        {
+            uint32 index = indexArray[a * 3 + k];
+            adjacencyArray[offsetArray[index] + valenceArray[index]++] = int32(a);
+        }
+    }
+
+    // The local index of each vertex in the meshlet being built, or 0xFF if it isn't part of it.
+
+    uint8* localIndex = new uint8[vertexCount];
+    bool*  emittedFlag = new bool[triangleCount];
+
+    for (machine a = 0; a < vertexCount; a++)
+    {
+        localIndex[a] = 0xFF;
+    }
+
+    for (machine a = 0; a < triangleCount; a++)
+    {
+        emittedFlag[a] = false;
+    }
+
+    int32 meshletCount = 0;
+    int32 vertexTotal = 0;
+    int32 triangleTotal = 0;
+    int32 scanCursor = 0;
+
+    Meshlet* meshlet = meshletArray;
+    meshlet->vertexOffset = 0;
+    meshlet->triangleOffset = 0;
+    meshlet->vertexCount = 0;
+    meshlet->triangleCount = 0;
+
+    for (machine emitted = 0; emitted < triangleCount; emitted++)
+    {
+        // Prefer the triangle adjacent to the current meshlet that adds the fewest new vertices.
+
+        int32 bestTriangle = -1;
+        int32 bestCost = 4;
+
+        const uint32* meshletVertex = meshletVertexArray + meshlet->vertexOffset;
+        for (machine a = 0; (a < meshlet->vertexCount) && (bestCost != 0); a++)
+        {
+            uint32       index = meshletVertex[a];
+            const int32* adjacency = adjacencyArray + offsetArray[index];
+            int32        count = valenceArray[index];
+
+            for (machine j = 0; j < count; j++)
+            {
+                int32         t = adjacency[j];
+                const uint32* k = indexArray + t * 3;
+
+                int32 cost = (localIndex[k[0]] == 0xFF) + (localIndex[k[1]] == 0xFF) + (localIndex[k[2]] == 0xFF);
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestTriangle = t;
+                }
+            }
+        }
+
+        if (bestTriangle < 0)
+        {
+            // Nothing adjacent is left, so continue with the next unassigned triangle.
+
+            while (emittedFlag[scanCursor])
+            {
+                scanCursor++;
+            }
+
+            bestTriangle = scanCursor;
+
+            const uint32* k = indexArray + bestTriangle * 3;
+            bestCost = (localIndex[k[0]] == 0xFF) + (localIndex[k[1]] == 0xFF) + (localIndex[k[2]] == 0xFF);
+        }
+
+        if ((int32(meshlet->triangleCount) == maxTriangleCount) || (int32(meshlet->vertexCount) + bestCost > maxVertexCount))
+        {
+            // The triangle doesn't fit, so close the current meshlet and start a new one with it.
+
+            for (machine a = 0; a < meshlet->vertexCount; a++)
+            {
+                localIndex[meshletVertex[a]] = 0xFF;
+            }
+
+            meshletCount++;
+            meshlet++;
+
+            meshlet->vertexOffset = vertexTotal;
+            meshlet->triangleOffset = triangleTotal;
+            meshlet->vertexCount = 0;
+            meshlet->triangleCount = 0;
+        }
+
+        const uint32* triangle = indexArray + bestTriangle * 3;
+        emittedFlag[bestTriangle] = true;
+
+        uint8* localTriangle = meshletTriangleArray + triangleTotal * 3;
+        for (machine k = 0; k < 3; k++)
+        {
+            uint32 index = triangle[k];
+            if (localIndex[index] == 0xFF)
+            {
+                localIndex[index] = uint8(meshlet->vertexCount++);
+                meshletVertexArray[vertexTotal++] = index;
+            }
+
+            localTriangle[k] = localIndex[index];
+
+            int32* adjacency = adjacencyArray + offsetArray[index];
+            int32  count = valenceArray[index];
+            for (machine j = 0; j < count; j++)
+            {
+                if (adjacency[j] == bestTriangle)
+                {
+                    adjacency[j] = adjacency[count - 1];
+                    valenceArray[index] = count - 1;
+                    break;
+                }
+            }
+        }
+
+        meshlet->triangleCount++;
+        triangleTotal++;
+    }
+
+    delete[] emittedFlag;
+    delete[] localIndex;
+    delete[] adjacencyArray;
+    delete[] offsetArray;
+    delete[] valenceArray;
+
+    meshletCount++;
+
+    for (machine a = 0; a < meshletCount; a++)
+    {
+        CalculateMeshletBounds(&meshletArray[a], meshletVertexArray, meshletTriangleArray, positionArray, positionStride);
+    }
+
+    return (meshletCount);
+}
+
+void OpenGEX::CalculateMeshletBounds(Meshlet* meshlet, const uint32* meshletVertexArray, const uint8* meshletTriangleArray, const float* positionArray, int32 positionStride)
+{
+    const uint32* vertex = meshletVertexArray + meshlet->vertexOffset;
+    int32         vertexCount = meshlet->vertexCount;
+
+    // Ritter's bounding sphere: start with the two points farthest apart along an arbitrary direction, then grow.
+
+    Point3D p0 = GetPosition(positionArray, positionStride, vertex[0]);
+    Point3D p1 = p0;
+    float   maxDistance = 0.0F;
+
+    for (machine a = 1; a < vertexCount; a++)
+    {
+        Point3D p = GetPosition(positionArray, positionStride, vertex[a]);
+        float   d = SquaredMag(p - p0);
+        if (d > maxDistance)
+        {
+            maxDistance = d;
+            p1 = p;
+        }
+    }
+
+    Point3D p2 = p1;
+    maxDistance = 0.0F;
+
+    for (machine a = 0; a < vertexCount; a++)
+    {
+        Point3D p = GetPosition(positionArray, positionStride, vertex[a]);
+        float   d = SquaredMag(p - p1);
+        if (d > maxDistance)
+        {
+            maxDistance = d;
+            p2 = p;
+        }
+    }
+
+    Point3D center = (p1 + p2) * 0.5F;
+    float   radius = Sqrt(maxDistance) * 0.5F;
+
+    for (machine a = 0; a < vertexCount; a++)
+    {
+        Point3D p = GetPosition(positionArray, positionStride, vertex[a]);
+        float   d = SquaredMag(p - center);
+        if (d > radius * radius)
+        {
+            d = Sqrt(d);
+            float r = (radius + d) * 0.5F;
+            center += (p - center) * ((r - radius) / d);
+            radius = r;
+        }
+    }
+
+    meshlet->boundingCenter = center;
+    meshlet->boundingRadius = radius;
+
+    // The cone axis is the area-weighted average normal, and the cutoff comes from the normal that deviates the most.
+
+    const uint8* triangle = meshletTriangleArray + meshlet->triangleOffset * 3;
+    int32        triangleCount = meshlet->triangleCount;
+
+    Vector3D normalSum(0.0F, 0.0F, 0.0F);
+    for (machine a = 0; a < triangleCount; a++)
+    {
+        const uint8* k = triangle + a * 3;
+        Point3D      q0 = GetPosition(positionArray, positionStride, vertex[k[0]]);
+        Point3D      q1 = GetPosition(positionArray, positionStride, vertex[k[1]]);
+        Point3D      q2 = GetPosition(positionArray, positionStride, vertex[k[2]]);
+        normalSum += Cross(q1 - q0, q2 - q0);
+    }
+
+    meshlet->coneApex = center;
+    meshlet->coneAxis.Set(0.0F, 0.0F, 1.0F);
+    meshlet->coneCutoff = 1.0F;
+
+    float m = SquaredMag(normalSum);
+    if (m < 1.0e-20F)
+    {
+        return;
+    }
+
+    Vector3D axis = normalSum * InverseSqrt(m);
+    float    minDot = 1.0F;
+    float    maxDistanceAlongAxis = 0.0F;
+
+    for (machine a = 0; a < triangleCount; a++)
+    {
+        const uint8* k = triangle + a * 3;
+        Point3D      q0 = GetPosition(positionArray, positionStride, vertex[k[0]]);
+        Point3D      q1 = GetPosition(positionArray, positionStride, vertex[k[1]]);
+        Point3D      q2 = GetPosition(positionArray, positionStride, vertex[k[2]]);
+
+        Vector3D normal = Cross(q1 - q0, q2 - q0);
+        float    n = SquaredMag(normal);
+        if (n < 1.0e-20F)
+        {
+            // Degenerate triangles have no facing.
+            continue;
+        }
+
+        normal *= InverseSqrt(n);
+        float d = Dot(axis, normal);
+        minDot = Min(minDot, d);
+
+        if (d > 0.0F)
+        {
+            maxDistanceAlongAxis = Max(maxDistanceAlongAxis, Dot(center - q0, normal) / d);
+        }
+    }
+
+    meshlet->coneAxis = axis;
+
+    if (minDot > 0.0F)
+    {
+        // Move the apex back along the axis so that the test is conservative for every triangle plane.
+
+        meshlet->coneApex = center - axis * maxDistanceAlongAxis;
+        meshlet->coneCutoff = Sqrt(1.0F - minDot * minDot);
+    }
+}
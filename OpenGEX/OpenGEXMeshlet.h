@@ -0,0 +1,75 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#ifndef OpenGEXMeshlet_h
+#define OpenGEXMeshlet_h
+
+#include "TSVector3D.h"
+
+using namespace Terathon;
+
+namespace OpenGEX
+{
+    enum
+    {
+        kMeshletDefaultVertexCount = 64,
+        kMeshletDefaultTriangleCount = 124,
+        kMeshletMaxVertexCount = 255,
+        kMeshletMaxTriangleCount = 512
+    };
+
+    // A meshlet references a range of the meshlet vertex array, which holds indices into the mesh's
+    // vertex arrays, and a range of the meshlet triangle array, which holds three local vertex indices
+    // per triangle. Offsets are element counts, so the arrays can be stored and loaded without fixups.
+
+    struct Meshlet
+    {
+        uint32 vertexOffset;
+        uint32 triangleOffset;
+        uint32 vertexCount;
+        uint32 triangleCount;
+
+        Point3D boundingCenter;
+        float   boundingRadius;
+
+        // A meshlet is entirely back-facing when Dot(Normalize(coneApex - cameraPosition), coneAxis) >= coneCutoff.
+        // A cutoff of 1.0 means that the normals are too spread out for the meshlet to be culled.
+
+        Point3D  coneApex;
+        Vector3D coneAxis;
+        float    coneCutoff;
+
+        uint32 materialIndex;
+    };
+
+    // Flat storage for all meshlets belonging to one mesh. The three arrays live in a single allocation.
+
+    struct MeshletData
+    {
+        int32 meshletCount;
+        int32 vertexCount;
+        int32 triangleCount;
+
+        Meshlet* meshletArray;
+        uint32*  vertexArray;
+        uint8*   triangleArray;
+    };
+
+    // Splits a triangle list into meshlets having at most maxVertexCount vertices and maxTriangleCount triangles.
+    // The output arrays must have room for triangleCount meshlets, triangleCount * 3 vertices, and triangleCount * 3
+    // local indices. Offsets in the meshlets begin at zero. The return value is the number of meshlets generated.
+
+    int32 BuildMeshlets(const uint32* indexArray, int32 triangleCount, const float* positionArray, int32 positionStride, int32 vertexCount, int32 maxVertexCount,
+                        int32 maxTriangleCount, Meshlet* meshletArray, uint32* meshletVertexArray, uint8* meshletTriangleArray);
+
+    // Calculates the bounding sphere and normal cone of a single meshlet.
+
+    void CalculateMeshletBounds(Meshlet* meshlet, const uint32* meshletVertexArray, const uint8* meshletTriangleArray, const float* positionArray, int32 positionStride);
+} // namespace OpenGEX
+
+#endif
@@ -0,0 +1,220 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#include "OpenGEXMorph.h"
+
+#if defined(TERATHON_SSE) && defined(__FMA__)
+
+#include <immintrin.h>
+
+#endif
+
+using namespace OpenGEX;
+
+namespace
+{
+    inline bool NonzeroDelta(const float* deltaArray, machine index)
+    {
+        if (!deltaArray)
+        {
+            return (false);
+        }
+
+        const float* delta = deltaArray + index * 3;
+        return ((delta[0] != 0.0F) || (delta[1] != 0.0F) || (delta[2] != 0.0F));
+    }
+
+    // Adds count floats of delta times weight to output.
+
+    void AccumulateDelta(const float* delta, float weight, machine count, float* output)
+    {
+        machine k = 0;
+
+#ifdef TERATHON_SSE
+
+        __m128 w = _mm_set1_ps(weight);
+
+#ifdef __FMA__
+
+        for (; k + 4 <= count; k += 4)
+        {
+            _mm_storeu_ps(output + k, _mm_fmadd_ps(_mm_loadu_ps(delta + k), w, _mm_loadu_ps(output + k)));
+        }
+
+#else
+
+        for (; k + 4 <= count; k += 4)
+        {
+            _mm_storeu_ps(output + k, _mm_add_ps(_mm_loadu_ps(output + k), _mm_mul_ps(_mm_loadu_ps(delta + k), w)));
+        }
+
+#endif
+
+#endif
+
+        for (; k < count; k++)
+        {
+            output[k] += delta[k] * weight;
+        }
+    }
+
+    // Blends the vertices in [begin, end) of one stream. The base is copied first, and then each target is
+    // accumulated in turn while the block is still in the cache. For a sparse target, the first run that
+    // reaches the block is found with a binary search.
+
+    void BlendStreamBlock(const MorphTarget* const* targetArray, const float* weightArray, int32 targetCount, float baseWeight, const MorphStream& stream, bool normalFlag, int32 begin, int32 end)
+    {
+        const float* base = stream.baseArray;
+        float*       output = stream.outputArray;
+
+        if (baseWeight == 1.0F)
+        {
+            for (machine k = begin * 3; k < end * 3; k++)
+            {
+                output[k] = base[k];
+            }
+        }
+        else
+        {
+            for (machine k = begin * 3; k < end * 3; k++)
+            {
+                output[k] = base[k] * baseWeight;
+            }
+        }
+
+        for (machine t = 0; t < targetCount; t++)
+        {
+            const MorphTarget* target = targetArray[t];
+            const float*       delta = (normalFlag) ? target->normalDeltaArray : target->positionDeltaArray;
+            if (!delta)
+            {
+                continue;
+            }
+
+            float weight = weightArray[t];
+
+            int32 runCount = target->runCount;
+            if (runCount == 0)
+            {
+                AccumulateDelta(delta + begin * 3, weight, (end - begin) * 3, output + begin * 3);
+                continue;
+            }
+
+            const MorphRun* runArray = target->runArray;
+
+            int32 low = 0;
+            int32 high = runCount;
+            while (low < high)
+            {
+                int32 mid = (low + high) >> 1;
+                if (runArray[mid].start + runArray[mid].count <= uint32(begin))
+                {
+                    low = mid + 1;
+                }
+                else
+                {
+                    high = mid;
+                }
+            }
+
+            for (machine r = low; (r < runCount) && (runArray[r].start < uint32(end)); r++)
+            {
+                const MorphRun& run = runArray[r];
+                uint32          first = Max(run.start, uint32(begin));
+                uint32          last = Min(run.start + run.count, uint32(end));
+
+                AccumulateDelta(delta + (run.deltaOffset + (first - run.start)) * 3, weight, (last - first) * 3, output + first * 3);
+            }
+        }
+
+        if (normalFlag)
+        {
+            for (machine a = begin; a < end; a++)
+            {
+                float* n = output + a * 3;
+                float  m = n[0] * n[0] + n[1] * n[1] + n[2] * n[2];
+                if (m > Math::min_float)
+                {
+                    m = InverseSqrt(m);
+                    n[0] *= m;
+                    n[1] *= m;
+                    n[2] *= m;
+                }
+            }
+        }
+    }
+} // namespace
+
+int32 OpenGEX::FindMorphRuns(const float* positionDeltaArray, const float* normalDeltaArray, int32 vertexCount, MorphRun* runArray, int32* vertexTotal)
+{
+    int32 runCount = 0;
+    int32 total = 0;
+
+    machine a = 0;
+    while (a < vertexCount)
+    {
+        if ((!NonzeroDelta(positionDeltaArray, a)) && (!NonzeroDelta(normalDeltaArray, a)))
+        {
+            a++;
+            continue;
+        }
+
+        machine start = a;
+        for (++a; a < vertexCount; a++)
+        {
+            if ((!NonzeroDelta(positionDeltaArray, a)) && (!NonzeroDelta(normalDeltaArray, a)))
+            {
+                break;
+            }
+        }
+
+        if (runArray)
+        {
+            runArray[runCount].start = uint32(start);
+            runArray[runCount].count = uint32(a - start);
+            runArray[runCount].deltaOffset = uint32(total);
+        }
+
+        runCount++;
+        total += int32(a - start);
+    }
+
+    *vertexTotal = total;
+    return (runCount);
+}
+
+void OpenGEX::CompactMorphDeltas(const float* denseDeltaArray, const MorphRun* runArray, int32 runCount, float* sparseDeltaArray)
+{
+    for (machine r = 0; r < runCount; r++)
+    {
+        const MorphRun& run = runArray[r];
+        const float*    source = denseDeltaArray + run.start * 3;
+        float*          destination = sparseDeltaArray + run.deltaOffset * 3;
+
+        for (machine k = 0; k < run.count * 3; k++)
+        {
+            destination[k] = source[k];
+        }
+    }
+}
+
+void OpenGEX::BlendMorphTargets(const MorphTarget* const* targetArray, const float* weightArray, int32 targetCount, int32 vertexCount, const MorphStream& positionStream, const MorphStream& normalStream,
+                                ThreadPool* threadPool, float baseWeight)
+{
+    ParallelForBlocks(threadPool, vertexCount, kMorphBlockSize, [&](int32 begin, int32 end) {
+        if (positionStream.baseArray)
+        {
+            BlendStreamBlock(targetArray, weightArray, targetCount, baseWeight, positionStream, false, begin, end);
+        }
+
+        if (normalStream.baseArray)
+        {
+            BlendStreamBlock(targetArray, weightArray, targetCount, baseWeight, normalStream, true, begin, end);
+        }
+    });
+}
@@ -0,0 +1,83 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#ifndef OpenGEXMorph_h
+#define OpenGEXMorph_h
+
+#include "OpenGEXThreadPool.h"
+#include "TSMath.h"
+
+using namespace Terathon;
+
+namespace OpenGEX
+{
+    enum
+    {
+        kMorphBlockSize = 1024
+    };
+
+    // A run of consecutive vertices changed by a sparse morph target. The deltas of the run start at
+    // element deltaOffset of the target's delta arrays, in units of vertices.
+
+    struct MorphRun
+    {
+        uint32 start;
+        uint32 count;
+        uint32 deltaOffset;
+    };
+
+    // The differences between a morph target and its base, with three floats per vertex. A dense target has
+    // a run count of zero and stores a delta for every vertex. A sparse target only stores deltas for the
+    // vertices in its runs, which are in increasing order. Either delta array is null if the target doesn't
+    // change that attribute. An absolute target has no base of its own, and its deltas are taken from morph 0.
+
+    struct MorphTarget
+    {
+        uint32          morphIndex;
+        bool            absoluteFlag;
+        int32           runCount;
+        const MorphRun* runArray;
+        const float*    positionDeltaArray;
+        const float*    normalDeltaArray;
+    };
+
+    struct MorphStatistics
+    {
+        int32  targetCount;
+        int32  sparseTargetCount;
+        uint32 denseSize;  // Bytes needed if every target were dense.
+        uint32 storedSize; // Bytes actually used by deltas and runs.
+    };
+
+    // One attribute to be morphed. The base and output arrays hold three floats per vertex. A stream with a null base array is skipped.
+
+    struct MorphStream
+    {
+        const float* baseArray;
+        float*       outputArray;
+    };
+
+    // Finds the runs of vertices for which either delta array, each with three floats per vertex, is nonzero.
+    // Either array can be null. If runArray is null, the runs are only counted. Returns the number of runs,
+    // and the number of vertices they contain is returned in vertexTotal.
+
+    int32 FindMorphRuns(const float* positionDeltaArray, const float* normalDeltaArray, int32 vertexCount, MorphRun* runArray, int32* vertexTotal);
+
+    // Copies the deltas of the vertices in the runs from a dense array into a sparse array.
+
+    void CompactMorphDeltas(const float* denseDeltaArray, const MorphRun* runArray, int32 runCount, float* sparseDeltaArray);
+
+    // Adds the weighted deltas of each target to the base positions and normals scaled by baseWeight, visiting only
+    // the vertices in the runs of sparse targets. Targets with zero weight should be left out by the caller. Blended
+    // normals are renormalized. When a thread pool is given, vertices are split into blocks processed in parallel.
+
+    void BlendMorphTargets(const MorphTarget* const* targetArray, const float* weightArray, int32 targetCount, int32 vertexCount, const MorphStream& positionStream, const MorphStream& normalStream,
+                           ThreadPool* threadPool, float baseWeight = 1.0F);
+} // namespace OpenGEX
+
+#endif
@@ -0,0 +1,160 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#include "OpenGEXNameIndex.h"
+
+using namespace OpenGEX;
+
+NameIndex::NameIndex()
+{
+}
+
+NameIndex::~NameIndex()
+{
+}
+
+void NameIndex::Clear(void)
+{
+    objectNameMap.clear();
+    localMap.clear();
+    globalMap.clear();
+    stringMap.clear();
+    stringStorage.clear();
+}
+
+uint32 NameIndex::InternString(std::string_view string)
+{
+    auto iterator = stringMap.find(string);
+    if (iterator != stringMap.end())
+    {
+        return (iterator->second);
+    }
+
+    // Strings in a deque never move, so the views used as keys stay valid.
+
+    uint32 index = uint32(stringStorage.size());
+    stringStorage.emplace_back(string);
+    stringMap.insert({std::string_view(stringStorage.back()), index});
+    return (index);
+}
+
+uint32 NameIndex::FindString(std::string_view string) const
+{
+    auto iterator = stringMap.find(string);
+    return ((iterator != stringMap.end()) ? iterator->second : kNameInvalid);
+}
+
+void NameIndex::BuildStructureNames(const Structure* root)
+{
+    // The tree is walked without recursion so that deep hierarchies can't overflow the stack.
+
+    Structure* structure = root->GetFirstSubnode();
+    while (structure)
+    {
+        const std::string& name = structure->GetStructureName();
+        if (!name.empty())
+        {
+            uint32 index = InternString(name);
+            if (structure->GetGlobalNameFlag())
+            {
+                globalMap.insert({index, structure});
+            }
+            else
+            {
+                localMap.insert({LocalKey{structure->GetSuperNode(), index}, structure});
+            }
+        }
+
+        Structure* next = structure->GetFirstSubnode();
+        while ((!next) && (structure != root))
+        {
+            next = structure->GetNextSubnode();
+            structure = structure->GetSuperNode();
+        }
+
+        structure = next;
+    }
+}
+
+Structure* NameIndex::FindGlobalStructure(std::string_view name) const
+{
+    uint32 index = FindString(name);
+    if (index != kNameInvalid)
+    {
+        auto iterator = globalMap.find(index);
+        if (iterator != globalMap.end())
+        {
+            return (iterator->second);
+        }
+    }
+
+    return (nullptr);
+}
+
+Structure* NameIndex::FindLocalStructure(const Structure* superNode, std::string_view name) const
+{
+    uint32 index = FindString(name);
+    if (index != kNameInvalid)
+    {
+        auto iterator = localMap.find(LocalKey{superNode, index});
+        if (iterator != localMap.end())
+        {
+            return (iterator->second);
+        }
+    }
+
+    return (nullptr);
+}
+
+Structure* NameIndex::FindStructure(const StructureRef& reference, const Structure* base) const
+{
+    const auto& nameArray = reference.GetNameArray();
+
+    Structure* structure = nullptr;
+    bool       firstFlag = true;
+
+    for (const auto& name : nameArray)
+    {
+        if (firstFlag)
+        {
+            firstFlag = false;
+            structure = (reference.GetGlobalRefFlag()) ? FindGlobalStructure(name) : ((base) ? FindLocalStructure(base, name) : nullptr);
+        }
+        else
+        {
+            structure = FindLocalStructure(structure, name);
+        }
+
+        if (!structure)
+        {
+            return (nullptr);
+        }
+    }
+
+    return (structure);
+}
+
+void NameIndex::AddObjectName(std::string_view name, Structure* structure)
+{
+    objectNameMap.insert({InternString(name), structure});
+}
+
+Structure* NameIndex::FindObjectName(std::string_view name) const
+{
+    uint32 index = FindString(name);
+    if (index != kNameInvalid)
+    {
+        auto iterator = objectNameMap.find(index);
+        if (iterator != objectNameMap.end())
+        {
+            return (iterator->second);
+        }
+    }
+
+    return (nullptr);
+}
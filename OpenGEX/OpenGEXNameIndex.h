@@ -0,0 +1,97 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#ifndef OpenGEXNameIndex_h
+#define OpenGEXNameIndex_h
+
+#include "TSOpenDDL.h"
+
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+using namespace Terathon;
+
+namespace OpenGEX
+{
+    enum : uint32
+    {
+        kNameInvalid = 0xFFFFFFFF
+    };
+
+    // Hash tables for finding structures by name in constant time. Each distinct string is stored once
+    // and identified by a small integer, so the tables themselves are keyed by integers.
+    //
+    // Structure names are the global and local names given to structures in the OpenDDL syntax. Local
+    // names are scoped to the super node of the structure that has them. Object names are the strings held
+    // by Name structures, which don't have to be unique, and the first structure added with a name is kept.
+
+    class NameIndex
+    {
+    private:
+        struct LocalKey
+        {
+            const Structure* superNode;
+            uint32           name;
+
+            bool operator==(const LocalKey& key) const
+            {
+                return ((superNode == key.superNode) && (name == key.name));
+            }
+        };
+
+        struct LocalKeyHash
+        {
+            size_t operator()(const LocalKey& key) const
+            {
+                return (std::hash<const void*>()(key.superNode) ^ (size_t(key.name) * 0x9E3779B9U));
+            }
+        };
+
+        std::deque<std::string>                                stringStorage;
+        std::unordered_map<std::string_view, uint32>           stringMap;
+        std::unordered_map<uint32, Structure*>                 globalMap;
+        std::unordered_map<LocalKey, Structure*, LocalKeyHash> localMap;
+        std::unordered_map<uint32, Structure*>                 objectNameMap;
+
+    public:
+        NameIndex();
+        ~NameIndex();
+
+        NameIndex(const NameIndex&) = delete;
+        NameIndex& operator=(const NameIndex&) = delete;
+
+        int32 GetStringCount(void) const
+        {
+            return (int32(stringStorage.size()));
+        }
+
+        void Clear(void);
+
+        uint32 InternString(std::string_view string);
+        uint32 FindString(std::string_view string) const;
+
+        // Adds the structure names of every structure in the tree below the root.
+
+        void BuildStructureNames(const Structure* root);
+
+        Structure* FindGlobalStructure(std::string_view name) const;
+        Structure* FindLocalStructure(const Structure* superNode, std::string_view name) const;
+
+        // Resolves a reference in the same way as OpenDDL. A reference that doesn't begin with a global name
+        // starts from the substructures of the base structure. Returns nullptr for a null or broken reference.
+
+        Structure* FindStructure(const StructureRef& reference, const Structure* base = nullptr) const;
+
+        void       AddObjectName(std::string_view name, Structure* structure);
+        Structure* FindObjectName(std::string_view name) const;
+    };
+} // namespace OpenGEX
+
+#endif
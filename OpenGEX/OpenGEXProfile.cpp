@@ -0,0 +1,238 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#include "OpenGEXProfile.h"
+
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+using namespace OpenGEX;
+
+#ifdef OPENGEX_PROFILE
+
+namespace
+{
+    struct ProfileEvent
+    {
+        const char* name;
+        int64       startTime;
+        int64       endTime;
+    };
+
+    // Event buffers are kept after their threads exit so that work done by temporary thread pools still appears
+    // in the trace. Buffers of threads that have exited are deleted when the next capture begins. The event mutex
+    // is only contended when a capture begins or a trace is written while the thread is still recording.
+
+    struct ProfileThread
+    {
+        int32                     threadIndex;
+        bool                      exitFlag;
+        std::string               threadName;
+        std::mutex                eventMutex;
+        std::vector<ProfileEvent> eventArray;
+    };
+
+    std::mutex                  profileMutex;
+    std::vector<ProfileThread*> profileThreadArray;
+    int32                       profileThreadCount = 0;
+    int64                       captureStartTime = 0;
+
+    struct ProfileThreadOwner
+    {
+        ProfileThread* profileThread = nullptr;
+
+        ~ProfileThreadOwner()
+        {
+            if (profileThread)
+            {
+                std::lock_guard<std::mutex> lock(profileMutex);
+                profileThread->exitFlag = true;
+            }
+        }
+    };
+
+    thread_local ProfileThreadOwner profileThreadOwner;
+
+    ProfileThread* GetProfileThread(void)
+    {
+        ProfileThread* profileThread = profileThreadOwner.profileThread;
+        if (!profileThread)
+        {
+            profileThread = new ProfileThread;
+            profileThread->exitFlag = false;
+
+            std::lock_guard<std::mutex> lock(profileMutex);
+            profileThread->threadIndex = ++profileThreadCount;
+            profileThreadArray.push_back(profileThread);
+            profileThreadOwner.profileThread = profileThread;
+        }
+
+        return (profileThread);
+    }
+
+    void AppendEscapedString(std::string* output, std::string_view string)
+    {
+        for (char c : string)
+        {
+            if ((c == '"') || (c == '\\'))
+            {
+                output->push_back('\\');
+            }
+
+            if (uint8(c) >= 0x20)
+            {
+                output->push_back(c);
+            }
+        }
+    }
+} // namespace
+
+std::atomic<bool> OpenGEX::profileCaptureFlag(false);
+
+int64 OpenGEX::GetProfileTime(void)
+{
+    return (int64(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()));
+}
+
+void OpenGEX::RecordProfileEvent(const char* name, int64 startTime, int64 endTime)
+{
+    ProfileThread* profileThread = GetProfileThread();
+
+    std::lock_guard<std::mutex> lock(profileThread->eventMutex);
+    profileThread->eventArray.push_back(ProfileEvent{name, startTime, endTime});
+}
+
+void OpenGEX::BeginProfileCapture(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(profileMutex);
+
+        machine count = 0;
+        for (ProfileThread* profileThread : profileThreadArray)
+        {
+            if (profileThread->exitFlag)
+            {
+                delete profileThread;
+            }
+            else
+            {
+                std::lock_guard<std::mutex> eventLock(profileThread->eventMutex);
+                profileThread->eventArray.clear();
+                profileThreadArray[count++] = profileThread;
+            }
+        }
+
+        profileThreadArray.resize(count);
+        captureStartTime = GetProfileTime();
+    }
+
+    profileCaptureFlag.store(true, std::memory_order_relaxed);
+}
+
+void OpenGEX::EndProfileCapture(void)
+{
+    profileCaptureFlag.store(false, std::memory_order_relaxed);
+}
+
+void OpenGEX::SetProfileThreadName(const char* name)
+{
+    ProfileThread* profileThread = GetProfileThread();
+
+    std::lock_guard<std::mutex> lock(profileMutex);
+    profileThread->threadName = name;
+}
+
+void OpenGEX::WriteProfileTrace(std::string* output)
+{
+    std::lock_guard<std::mutex> lock(profileMutex);
+
+    char buffer[128];
+    bool firstFlag = true;
+
+    output->append("{\"traceEvents\":[");
+    for (ProfileThread* profileThread : profileThreadArray)
+    {
+        std::lock_guard<std::mutex> eventLock(profileThread->eventMutex);
+        if (profileThread->eventArray.empty())
+        {
+            continue;
+        }
+
+        output->append((firstFlag) ? "\n" : ",\n");
+        firstFlag = false;
+
+        snprintf(buffer, sizeof(buffer), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"", profileThread->threadIndex);
+        output->append(buffer);
+
+        if (profileThread->threadName.empty())
+        {
+            snprintf(buffer, sizeof(buffer), "Thread %d", profileThread->threadIndex);
+            output->append(buffer);
+        }
+        else
+        {
+            AppendEscapedString(output, profileThread->threadName);
+        }
+
+        output->append("\"}}");
+
+        for (const ProfileEvent& event : profileThread->eventArray)
+        {
+            output->append(",\n{\"name\":\"");
+            AppendEscapedString(output, event.name);
+
+            // Chrome trace times are in microseconds.
+
+            snprintf(buffer, sizeof(buffer), "\",\"cat\":\"OpenGEX\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}", profileThread->threadIndex,
+                     double(event.startTime - captureStartTime) * 0.001, double(event.endTime - event.startTime) * 0.001);
+            output->append(buffer);
+        }
+    }
+
+    output->append("\n],\"displayTimeUnit\":\"ms\"}\n");
+}
+
+#else
+
+void OpenGEX::BeginProfileCapture(void)
+{
+}
+
+void OpenGEX::EndProfileCapture(void)
+{
+}
+
+void OpenGEX::SetProfileThreadName(const char* name)
+{
+}
+
+void OpenGEX::WriteProfileTrace(std::string* output)
+{
+    output->append("{\"traceEvents\":[],\"displayTimeUnit\":\"ms\"}\n");
+}
+
+#endif
+
+bool OpenGEX::WriteProfileTrace(const char* fileName)
+{
+    FILE* file = fopen(fileName, "wb");
+    if (!file)
+    {
+        return (false);
+    }
+
+    std::string output;
+    WriteProfileTrace(&output);
+
+    bool result = (fwrite(output.data(), 1, output.size(), file) == output.size());
+    fclose(file);
+    return (result);
+}
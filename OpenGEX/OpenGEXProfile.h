@@ -0,0 +1,83 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#ifndef OpenGEXProfile_h
+#define OpenGEXProfile_h
+
+#include "TSPlatform.h"
+
+#include <atomic>
+#include <string>
+
+using namespace Terathon;
+
+namespace OpenGEX
+{
+    // Profiling zones are compiled only when OPENGEX_PROFILE is defined, which is done by the ENABLE_PROFILING
+    // CMake option. Otherwise, OPENGEX_PROFILE_ZONE expands to nothing, and a capture contains no events.
+    //
+    // While a capture is active, each zone records a complete event with its start and end times in a buffer that
+    // belongs to the thread it ran on. The capture should be ended and all work finished before the trace is written.
+
+    void BeginProfileCapture(void);
+    void EndProfileCapture(void);
+
+    // Names the calling thread in the trace. Threads that aren't named are identified by number.
+
+    void SetProfileThreadName(const char* name);
+
+    // Writes the events of the last capture in the Chrome trace event format, which can be loaded into
+    // chrome://tracing or Perfetto. The file version returns false if the file can't be written.
+
+    void WriteProfileTrace(std::string* output);
+    bool WriteProfileTrace(const char* fileName);
+
+#ifdef OPENGEX_PROFILE
+
+    extern std::atomic<bool> profileCaptureFlag;
+
+    int64 GetProfileTime(void);
+    void  RecordProfileEvent(const char* name, int64 startTime, int64 endTime);
+
+    class ProfileZone
+    {
+    private:
+        const char* zoneName;
+        int64       startTime;
+
+    public:
+        explicit ProfileZone(const char* name)
+        {
+            zoneName = name;
+            startTime = (profileCaptureFlag.load(std::memory_order_relaxed)) ? GetProfileTime() : -1;
+        }
+
+        ~ProfileZone()
+        {
+            if (startTime >= 0)
+            {
+                RecordProfileEvent(zoneName, startTime, GetProfileTime());
+            }
+        }
+
+        ProfileZone(const ProfileZone&) = delete;
+        ProfileZone& operator=(const ProfileZone&) = delete;
+    };
+
+#define OPENGEX_PROFILE_JOIN2(a, b) a##b
+#define OPENGEX_PROFILE_JOIN(a, b) OPENGEX_PROFILE_JOIN2(a, b)
+#define OPENGEX_PROFILE_ZONE(name) OpenGEX::ProfileZone OPENGEX_PROFILE_JOIN(profileZone, __LINE__)(name)
+
+#else
+
+#define OPENGEX_PROFILE_ZONE(name) ((void) 0)
+
+#endif
+} // namespace OpenGEX
+
+#endif
@@ -0,0 +1,761 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#include "OpenGEXScene.h"
+#include "OpenGEX.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <unordered_map>
+#include <vector>
+
+using namespace OpenGEX;
+
+namespace
+{
+    // Vertex, index, and skin data are aligned for vector loads and uploads. Tables only need their natural alignment.
+
+    constexpr machine kSceneDataAlignment = 16;
+
+    // The scene is built twice with the same sequence of allocations. The first pass has no storage and only
+    // measures the size, and the second pass fills in the storage allocated from that size.
+
+    class SceneArena
+    {
+    private:
+        char*   storage;
+        machine size;
+
+        std::unordered_map<std::string_view, const char*> stringMap;
+
+    public:
+        explicit SceneArena(char* sceneStorage)
+        {
+            storage = sceneStorage;
+            size = 0;
+        }
+
+        machine GetSize(void) const
+        {
+            return (size);
+        }
+
+        template <class type>
+        type* Allocate(machine count, machine alignment = alignof(type))
+        {
+            size = (size + (alignment - 1)) & ~(alignment - 1);
+            type* pointer = (storage) ? reinterpret_cast<type*>(storage + size) : nullptr;
+            size += count * sizeof(type);
+            return (pointer);
+        }
+
+        template <class type>
+        type* Copy(const type* data, machine count, machine alignment = alignof(type))
+        {
+            if ((!data) || (count == 0))
+            {
+                return (nullptr);
+            }
+
+            type* pointer = Allocate<type>(count, alignment);
+            if (pointer)
+            {
+                for (machine a = 0; a < count; a++)
+                {
+                    new (&pointer[a]) type(data[a]);
+                }
+            }
+
+            return (pointer);
+        }
+
+        // Identical strings are stored once. The views refer to strings in the structure tree, which stays alive for both passes.
+
+        const char* CopyString(std::string_view string)
+        {
+            auto iterator = stringMap.find(string);
+            if (iterator != stringMap.end())
+            {
+                return (iterator->second);
+            }
+
+            char* pointer = Allocate<char>(string.size() + 1);
+            if (pointer)
+            {
+                memcpy(pointer, string.data(), string.size());
+                pointer[string.size()] = 0;
+            }
+
+            stringMap.emplace(string, pointer);
+            return (pointer);
+        }
+    };
+
+    int32 FindIndex(const std::unordered_map<const Structure*, int32>& indexMap, const Structure* structure)
+    {
+        auto iterator = indexMap.find(structure);
+        return ((iterator != indexMap.end()) ? iterator->second : -1);
+    }
+
+    const char* GetStructureNameString(const Structure* structure)
+    {
+        const Structure* nameStructure = structure->GetFirstSubstructure(kStructureName);
+        return ((nameStructure) ? static_cast<const NameStructure*>(nameStructure)->GetName().c_str() : "");
+    }
+
+    const float* CopyKeyData(SceneArena& arena, const KeyStructure* keyStructure, int32* elementCount)
+    {
+        if (!keyStructure)
+        {
+            return (nullptr);
+        }
+
+        const DataStructure<FloatDataType>* dataStructure = static_cast<const DataStructure<FloatDataType>*>(keyStructure->GetFirstSubnode());
+        int32                               count = dataStructure->GetDataElementCount();
+
+        *elementCount = count;
+        return ((count != 0) ? arena.Copy(&dataStructure->GetDataElement(0), count) : nullptr);
+    }
+
+    SceneCurve BuildCurve(SceneArena& arena, const CurveStructure* curveStructure)
+    {
+        SceneCurve curve = {};
+        curve.curveType = arena.CopyString((curveStructure) ? curveStructure->GetCurveType() : std::string_view());
+
+        if (curveStructure)
+        {
+            curve.valueArray = CopyKeyData(arena, curveStructure->GetKeyValueStructure(), &curve.elementCount);
+            curve.controlArray[0] = CopyKeyData(arena, curveStructure->GetKeyControlStructure(0), &curve.elementCount);
+            curve.controlArray[1] = CopyKeyData(arena, curveStructure->GetKeyControlStructure(1), &curve.elementCount);
+            curve.tensionArray = CopyKeyData(arena, curveStructure->GetKeyTensionStructure(), &curve.elementCount);
+            curve.continuityArray = CopyKeyData(arena, curveStructure->GetKeyContinuityStructure(), &curve.elementCount);
+            curve.biasArray = CopyKeyData(arena, curveStructure->GetKeyBiasStructure(), &curve.elementCount);
+        }
+
+        return (curve);
+    }
+
+    std::string_view GetTransformKind(const Structure* structure)
+    {
+        switch (structure->GetStructureType())
+        {
+        case kStructureTranslation:
+
+            return (static_cast<const TranslationStructure*>(structure)->GetTranslationKind());
+
+        case kStructureRotation:
+
+            return (static_cast<const RotationStructure*>(structure)->GetRotationKind());
+
+        case kStructureScale:
+
+            return (static_cast<const ScaleStructure*>(structure)->GetScaleKind());
+        }
+
+        return (std::string_view());
+    }
+
+    // Collects the Color, Param, Texture, and Atten substructures of a material or light object. The atten array is
+    // only filled in for light objects.
+
+    struct AttribTables
+    {
+        std::vector<SceneColor>   colorArray;
+        std::vector<SceneParam>   paramArray;
+        std::vector<SceneTexture> textureArray;
+        std::vector<SceneAtten>   attenArray;
+    };
+
+    void BuildAttribTables(SceneArena& arena, const Structure* structure, AttribTables* tables)
+    {
+        for (const Structure* subnode = structure->GetFirstSubnode(); subnode; subnode = subnode->GetNextSubnode())
+        {
+            StructureType type = subnode->GetStructureType();
+            if (type == kStructureColor)
+            {
+                const ColorStructure* colorStructure = static_cast<const ColorStructure*>(subnode);
+                tables->colorArray.push_back(SceneColor{arena.CopyString(colorStructure->GetAttribString()), colorStructure->GetColor()});
+            }
+            else if (type == kStructureParam)
+            {
+                const ParamStructure* paramStructure = static_cast<const ParamStructure*>(subnode);
+                tables->paramArray.push_back(SceneParam{arena.CopyString(paramStructure->GetAttribString()), paramStructure->GetParam()});
+            }
+            else if (type == kStructureTexture)
+            {
+                const TextureStructure* textureStructure = static_cast<const TextureStructure*>(subnode);
+
+                SceneTexture& record = tables->textureArray.emplace_back();
+                record.attrib = arena.CopyString(textureStructure->GetAttribString());
+                record.textureName = arena.CopyString(textureStructure->GetTextureName());
+                record.texcoordIndex = textureStructure->GetTexcoordIndex();
+                record.textureSwizzle = arena.CopyString(textureStructure->GetTextureSwizzle());
+                record.textureAddress[0] = arena.CopyString(textureStructure->GetTextureAddress(0));
+                record.textureAddress[1] = arena.CopyString(textureStructure->GetTextureAddress(1));
+                record.textureAddress[2] = arena.CopyString(textureStructure->GetTextureAddress(2));
+                record.textureBorder = arena.CopyString(textureStructure->GetTextureBorder());
+                record.texcoordTransform = textureStructure->GetTexcoordTransform();
+            }
+            else if (type == kStructureAtten)
+            {
+                const AttenStructure* attenStructure = static_cast<const AttenStructure*>(subnode);
+
+                SceneAtten& record = tables->attenArray.emplace_back();
+                record.attenKind = arena.CopyString(attenStructure->GetAttenKind());
+                record.curveType = arena.CopyString(attenStructure->GetCurveType());
+                record.beginParam = attenStructure->GetBeginParam();
+                record.endParam = attenStructure->GetEndParam();
+                record.scaleParam = attenStructure->GetScaleParam();
+                record.offsetParam = attenStructure->GetOffsetParam();
+                record.constantParam = attenStructure->GetConstantParam();
+                record.linearParam = attenStructure->GetLinearParam();
+                record.quadraticParam = attenStructure->GetQuadraticParam();
+                record.powerParam = attenStructure->GetPowerParam();
+            }
+        }
+    }
+
+    template <class type>
+    const type* FindAttrib(const type* array, int32 count, std::string_view attrib)
+    {
+        for (machine a = 0; a < count; a++)
+        {
+            if (attrib == array[a].attrib)
+            {
+                return (&array[a]);
+            }
+        }
+
+        return (nullptr);
+    }
+
+    MorphTarget CopyMorphTarget(SceneArena& arena, const MorphTarget& target, int32 vertexCount)
+    {
+        MorphTarget result = target;
+
+        int32 storedCount = vertexCount;
+        if (target.runCount != 0)
+        {
+            storedCount = 0;
+            for (machine a = 0; a < target.runCount; a++)
+            {
+                storedCount += target.runArray[a].count;
+            }
+
+            result.runArray = arena.Copy(target.runArray, target.runCount);
+        }
+
+        result.positionDeltaArray = arena.Copy(target.positionDeltaArray, storedCount * 3, kSceneDataAlignment);
+        result.normalDeltaArray = arena.Copy(target.normalDeltaArray, storedCount * 3, kSceneDataAlignment);
+        return (result);
+    }
+
+    SceneSkin BuildSkin(SceneArena& arena, const SkinStructure* skinStructure, const std::unordered_map<const Skeleton*, int32>& skeletonIndexMap)
+    {
+        SceneSkin skin;
+        skin.skinTransform = skinStructure->GetSkinTransform();
+
+        auto iterator = skeletonIndexMap.find(skinStructure->GetSkeleton());
+        skin.skeletonIndex = (iterator != skeletonIndexMap.end()) ? iterator->second : -1;
+
+        const BoneCountArrayStructure*  boneCountArrayStructure = skinStructure->GetBoneCountArrayStructure();
+        const BoneIndexArrayStructure*  boneIndexArrayStructure = skinStructure->GetBoneIndexArrayStructure();
+        const BoneWeightArrayStructure* boneWeightArrayStructure = skinStructure->GetBoneWeightArrayStructure();
+
+        skin.vertexCount = boneCountArrayStructure->GetVertexCount();
+        skin.boneIndexCount = boneIndexArrayStructure->GetBoneIndexCount();
+        skin.boneCountArray = arena.Copy(boneCountArrayStructure->GetBoneCountArray(), skin.vertexCount, kSceneDataAlignment);
+        skin.boneIndexArray = arena.Copy(boneIndexArrayStructure->GetBoneIndexArray(), skin.boneIndexCount, kSceneDataAlignment);
+        skin.boneWeightArray = arena.Copy(boneWeightArrayStructure->GetBoneWeightArray(), boneWeightArrayStructure->GetBoneWeightCount(), kSceneDataAlignment);
+
+        const PackedSkinData& packedSkinData = skinStructure->GetPackedSkinData();
+        skin.packedSkinData = packedSkinData;
+
+        if (packedSkinData.vertexCount != 0)
+        {
+            machine elementCount = machine(packedSkinData.vertexCount) * packedSkinData.influenceCount;
+            machine weightSize = elementCount * GetSkinWeightSize(packedSkinData.weightFormat);
+
+            skin.packedSkinData.boneWeightArray = arena.Copy(static_cast<const char*>(packedSkinData.boneWeightArray), weightSize, kSceneDataAlignment);
+            skin.packedSkinData.boneIndexArray = arena.Copy(static_cast<const char*>(packedSkinData.boneIndexArray), elementCount * packedSkinData.indexSize, kSceneDataAlignment);
+            skin.packedSkinData.paletteArray = arena.Copy(packedSkinData.paletteArray, packedSkinData.paletteCount);
+        }
+
+        return (skin);
+    }
+
+    SceneMesh BuildMesh(SceneArena& arena, const MeshStructure* meshStructure, const std::unordered_map<const Skeleton*, int32>& skeletonIndexMap)
+    {
+        SceneMesh mesh;
+        mesh.meshLevel = meshStructure->GetKey();
+        mesh.meshPrimitive = arena.CopyString(meshStructure->GetMeshPrimitive());
+        mesh.vertexCount = meshStructure->GetVertexCount();
+        mesh.lodError = meshStructure->GetLodError();
+
+        std::vector<SceneVertexArray> vertexArray;
+        for (const VertexArrayStructure* vertexArrayStructure : *meshStructure->GetVertexArrayList())
+        {
+            SceneVertexArray& record = vertexArray.emplace_back();
+            record.attrib = arena.CopyString(vertexArrayStructure->GetAttribString());
+            record.attribIndex = vertexArrayStructure->GetAttribIndex();
+            record.morphIndex = vertexArrayStructure->GetMorphIndex();
+            record.vertexCount = vertexArrayStructure->GetVertexCount();
+            record.componentCount = vertexArrayStructure->GetComponentCount();
+            record.vertexArray = arena.Copy(static_cast<const float*>(vertexArrayStructure->GetVertexArrayData()), machine(record.vertexCount) * record.componentCount, kSceneDataAlignment);
+        }
+
+        std::vector<SceneIndexArray> indexArray;
+        for (const IndexArrayStructure* indexArrayStructure : *meshStructure->GetIndexArrayList())
+        {
+            SceneIndexArray& record = indexArray.emplace_back();
+            record.materialIndex = indexArrayStructure->GetMaterialIndex();
+            record.restartIndex = indexArrayStructure->GetRestartIndex();
+            record.frontFace = arena.CopyString(indexArrayStructure->GetFrontFace());
+            record.indexCount = indexArrayStructure->GetIndexCount();
+            record.indexSize = indexArrayStructure->GetIndexSize();
+            record.indexArray = arena.Copy(static_cast<const char*>(indexArrayStructure->GetIndexArrayData()), machine(record.indexCount) * record.indexSize, kSceneDataAlignment);
+        }
+
+        mesh.vertexArrayCount = int32(vertexArray.size());
+        mesh.vertexArray = arena.Copy(vertexArray.data(), vertexArray.size());
+        mesh.indexArrayCount = int32(indexArray.size());
+        mesh.indexArray = arena.Copy(indexArray.data(), indexArray.size());
+
+        mesh.skin = nullptr;
+        const SkinStructure* skinStructure = meshStructure->GetSkinStructure();
+        if (skinStructure)
+        {
+            SceneSkin skin = BuildSkin(arena, skinStructure, skeletonIndexMap);
+            mesh.skin = arena.Copy(&skin, 1);
+        }
+
+        mesh.boundingBox = meshStructure->GetBoundingBox();
+        mesh.boundingSphere = meshStructure->GetBoundingSphere();
+        mesh.boneBoundsCount = meshStructure->GetBoneBoundsCount();
+        mesh.boneBoundsArray = arena.Copy(meshStructure->GetBoneBoundsArray(), mesh.boneBoundsCount);
+
+        std::vector<MorphTarget> morphTargetArray;
+        const MorphTarget*       morphTarget = meshStructure->GetMorphTargetArray();
+        for (machine a = 0; a < meshStructure->GetMorphTargetCount(); a++)
+        {
+            morphTargetArray.push_back(CopyMorphTarget(arena, morphTarget[a], mesh.vertexCount));
+        }
+
+        mesh.morphTargetCount = int32(morphTargetArray.size());
+        mesh.morphTargetArray = arena.Copy(morphTargetArray.data(), morphTargetArray.size());
+
+        const MeshletData& meshletData = meshStructure->GetMeshletData();
+        mesh.meshletData = meshletData;
+        mesh.meshletData.meshletArray = arena.Copy(meshletData.meshletArray, meshletData.meshletCount);
+        mesh.meshletData.vertexArray = arena.Copy(meshletData.vertexArray, meshletData.vertexCount);
+        mesh.meshletData.triangleArray = arena.Copy(meshletData.triangleArray, machine(meshletData.triangleCount) * 3);
+
+        return (mesh);
+    }
+} // namespace
+
+CompactScene::CompactScene(const OpenGexDataDescription* dataDescription)
+{
+    OPENGEX_PROFILE_ZONE("CompactScene::CompactScene");
+
+    sceneStorage = nullptr;
+    sceneSize = Build(dataDescription, nullptr);
+
+    sceneStorage = new char[Max(sceneSize, machine(1))];
+    Build(dataDescription, sceneStorage);
+}
+
+CompactScene::~CompactScene()
+{
+    delete[] sceneStorage;
+}
+
+machine CompactScene::Build(const OpenGexDataDescription* dataDescription, char* storage)
+{
+    SceneArena arena(storage);
+
+    std::vector<const NodeStructure*>           nodeStructureArray;
+    std::vector<const Structure*>               geometryObjectStructureArray;
+    std::vector<const LightObjectStructure*>    lightObjectStructureArray;
+    std::vector<const CameraObjectStructure*>   cameraObjectStructureArray;
+    std::vector<const MaterialStructure*>       materialStructureArray;
+    std::vector<const AnimationStructure*>      animationStructureArray;
+    std::unordered_map<const Structure*, int32> nodeIndexMap;
+    std::unordered_map<const Structure*, int32> objectIndexMap;
+    std::unordered_map<const Structure*, int32> materialIndexMap;
+    std::unordered_map<const Structure*, int32> transformIndexMap;
+
+    const Structure* root = dataDescription->GetRootStructure();
+    const Structure* structure = root->GetFirstSubnode();
+    while (structure)
+    {
+        StructureType type = structure->GetStructureType();
+        if (structure->GetBaseStructureType() == kStructureNode)
+        {
+            nodeIndexMap.emplace(structure, int32(nodeStructureArray.size()));
+            nodeStructureArray.push_back(static_cast<const NodeStructure*>(structure));
+        }
+        else if (type == kStructureGeometryObject)
+        {
+            objectIndexMap.emplace(structure, int32(geometryObjectStructureArray.size()));
+            geometryObjectStructureArray.push_back(structure);
+        }
+        else if (type == kStructureLightObject)
+        {
+            objectIndexMap.emplace(structure, int32(lightObjectStructureArray.size()));
+            lightObjectStructureArray.push_back(static_cast<const LightObjectStructure*>(structure));
+        }
+        else if (type == kStructureCameraObject)
+        {
+            objectIndexMap.emplace(structure, int32(cameraObjectStructureArray.size()));
+            cameraObjectStructureArray.push_back(static_cast<const CameraObjectStructure*>(structure));
+        }
+        else if (type == kStructureMaterial)
+        {
+            materialIndexMap.emplace(structure, int32(materialStructureArray.size()));
+            materialStructureArray.push_back(static_cast<const MaterialStructure*>(structure));
+        }
+        else if (type == kStructureAnimation)
+        {
+            animationStructureArray.push_back(static_cast<const AnimationStructure*>(structure));
+        }
+
+        structure = structure->GetNextNode(root);
+    }
+
+    // Runtime skeletons are shared by skins with the same bones and bind pose, so the bones of
+    // each skeleton are taken from the first skin that uses it.
+
+    const std::list<Skeleton*>*                skeletonList = dataDescription->GetSkeletonList();
+    std::unordered_map<const Skeleton*, int32> skeletonIndexMap;
+    std::vector<const SkinStructure*>          skeletonSkinArray(skeletonList->size(), nullptr);
+
+    for (const Skeleton* skeleton : *skeletonList)
+    {
+        skeletonIndexMap.emplace(skeleton, int32(skeletonIndexMap.size()));
+    }
+
+    for (const MeshStructure* meshStructure : *dataDescription->GetMeshList())
+    {
+        const SkinStructure* skinStructure = meshStructure->GetSkinStructure();
+        if (skinStructure)
+        {
+            auto iterator = skeletonIndexMap.find(skinStructure->GetSkeleton());
+            if ((iterator != skeletonIndexMap.end()) && (!skeletonSkinArray[iterator->second]))
+            {
+                skeletonSkinArray[iterator->second] = skinStructure;
+            }
+        }
+    }
+
+    std::vector<SceneSkeleton> skeletonTable;
+    for (const Skeleton* skeleton : *skeletonList)
+    {
+        SceneSkeleton& record = skeletonTable.emplace_back();
+        record.boneCount = skeleton->GetBoneCount();
+
+        int32*       boneNodeArray = arena.Allocate<int32>(record.boneCount);
+        Transform3D* inverseBindArray = arena.Allocate<Transform3D>(record.boneCount);
+
+        if (storage)
+        {
+            const SkinStructure*            skinStructure = skeletonSkinArray[skeletonTable.size() - 1];
+            const BoneNodeStructure* const* boneNodeStructureArray = (skinStructure) ? skinStructure->GetSkeletonStructure()->GetBoneRefArrayStructure()->GetBoneNodeArray() : nullptr;
+
+            for (machine a = 0; a < record.boneCount; a++)
+            {
+                boneNodeArray[a] = (boneNodeStructureArray) ? FindIndex(nodeIndexMap, boneNodeStructureArray[a]) : -1;
+                new (&inverseBindArray[a]) Transform3D(skeleton->GetInverseBindTransform(int32(a)));
+            }
+        }
+
+        record.boneNodeArray = boneNodeArray;
+        record.inverseBindArray = inverseBindArray;
+    }
+
+    std::vector<SceneGeometryObject> geometryObjectTable;
+    for (const Structure* geometryObjectStructure : geometryObjectStructureArray)
+    {
+        std::vector<const MeshStructure*> meshStructureArray;
+        for (const auto& entry : *static_cast<const GeometryObjectStructure*>(geometryObjectStructure)->GetMeshMap())
+        {
+            meshStructureArray.push_back(entry.second);
+        }
+
+        std::sort(meshStructureArray.begin(), meshStructureArray.end(), [](const MeshStructure* a, const MeshStructure* b) { return (a->GetKey() < b->GetKey()); });
+
+        std::vector<SceneMesh> meshArray;
+        for (const MeshStructure* meshStructure : meshStructureArray)
+        {
+            meshArray.push_back(BuildMesh(arena, meshStructure, skeletonIndexMap));
+        }
+
+        SceneGeometryObject& record = geometryObjectTable.emplace_back();
+        record.meshCount = int32(meshArray.size());
+        record.meshArray = arena.Copy(meshArray.data(), meshArray.size());
+    }
+
+    std::vector<SceneLightObject> lightObjectTable;
+    for (const LightObjectStructure* lightObjectStructure : lightObjectStructureArray)
+    {
+        SceneLightObject& record = lightObjectTable.emplace_back();
+        record.typeString = arena.CopyString(lightObjectStructure->GetTypeString());
+        record.shadowFlag = lightObjectStructure->GetShadowFlag();
+
+        AttribTables tables;
+        BuildAttribTables(arena, lightObjectStructure, &tables);
+
+        record.colorCount = int32(tables.colorArray.size());
+        record.colorArray = arena.Copy(tables.colorArray.data(), tables.colorArray.size());
+        record.paramCount = int32(tables.paramArray.size());
+        record.paramArray = arena.Copy(tables.paramArray.data(), tables.paramArray.size());
+        record.textureCount = int32(tables.textureArray.size());
+        record.textureArray = arena.Copy(tables.textureArray.data(), tables.textureArray.size());
+        record.attenCount = int32(tables.attenArray.size());
+        record.attenArray = arena.Copy(tables.attenArray.data(), tables.attenArray.size());
+    }
+
+    std::vector<SceneCameraObject> cameraObjectTable;
+    for (const CameraObjectStructure* cameraObjectStructure : cameraObjectStructureArray)
+    {
+        SceneCameraObject& record = cameraObjectTable.emplace_back();
+        record.projectionDistance = cameraObjectStructure->GetProjectionDistance();
+        record.nearDepth = cameraObjectStructure->GetNearDepth();
+        record.farDepth = cameraObjectStructure->GetFarDepth();
+    }
+
+    std::vector<SceneMaterial> materialTable;
+    for (const MaterialStructure* materialStructure : materialStructureArray)
+    {
+        SceneMaterial& record = materialTable.emplace_back();
+        record.materialName = arena.CopyString(GetStructureNameString(materialStructure));
+        record.twoSidedFlag = materialStructure->GetTwoSidedFlag();
+
+        AttribTables tables;
+        BuildAttribTables(arena, materialStructure, &tables);
+
+        record.colorCount = int32(tables.colorArray.size());
+        record.colorArray = arena.Copy(tables.colorArray.data(), tables.colorArray.size());
+        record.paramCount = int32(tables.paramArray.size());
+        record.paramArray = arena.Copy(tables.paramArray.data(), tables.paramArray.size());
+        record.textureCount = int32(tables.textureArray.size());
+        record.textureArray = arena.Copy(tables.textureArray.data(), tables.textureArray.size());
+    }
+
+    std::vector<SceneNode> nodeTable;
+    std::vector<int32>     lastSubnodeIndex(nodeStructureArray.size(), -1);
+
+    for (const NodeStructure* nodeStructure : nodeStructureArray)
+    {
+        int32      nodeIndex = int32(nodeTable.size());
+        SceneNode& record = nodeTable.emplace_back();
+        record.nodeType = nodeStructure->GetStructureType();
+        record.nodeName = arena.CopyString(nodeStructure->GetNodeName());
+        record.firstSubnodeIndex = -1;
+        record.nextSubnodeIndex = -1;
+        record.objectIndex = -1;
+        record.materialCount = 0;
+        record.materialArray = nullptr;
+        record.morphWeightCount = 0;
+        record.morphWeightArray = nullptr;
+
+        record.nodeTransform = nodeStructure->GetNodeTransform();
+        record.objectTransform = nodeStructure->GetObjectTransform();
+        record.inverseObjectTransform = nodeStructure->GetInverseObjectTransform();
+        record.worldTransform = nodeStructure->GetWorldTransform();
+        record.worldBoundingBox = BoundingBox();
+        record.worldBoundingSphere = BoundingSphere();
+
+        std::vector<SceneTransform> transformArray;
+        for (const Structure* subnode = nodeStructure->GetFirstSubnode(); subnode; subnode = subnode->GetNextSubnode())
+        {
+            if (subnode->GetBaseStructureType() == kStructureMatrix)
+            {
+                const MatrixStructure* matrixStructure = static_cast<const MatrixStructure*>(subnode);
+                transformIndexMap.emplace(subnode, int32(transformArray.size()));
+
+                SceneTransform& transform = transformArray.emplace_back();
+                transform.transformType = subnode->GetStructureType();
+                transform.transformKind = arena.CopyString(GetTransformKind(subnode));
+                transform.objectFlag = matrixStructure->GetObjectFlag();
+                transform.matrix = matrixStructure->GetMatrix();
+            }
+        }
+
+        record.transformCount = int32(transformArray.size());
+        record.transformArray = arena.Copy(transformArray.data(), transformArray.size());
+
+        // Nodes can be nested inside other structures, so the super node is the nearest enclosing node.
+
+        const Structure* superNode = nodeStructure->GetSuperNode();
+        while ((superNode != root) && (superNode->GetBaseStructureType() != kStructureNode))
+        {
+            superNode = superNode->GetSuperNode();
+        }
+
+        record.superIndex = (superNode != root) ? FindIndex(nodeIndexMap, superNode) : -1;
+        if (record.superIndex >= 0)
+        {
+            int32 previousIndex = lastSubnodeIndex[record.superIndex];
+            if (previousIndex >= 0)
+            {
+                nodeTable[previousIndex].nextSubnodeIndex = nodeIndex;
+            }
+            else
+            {
+                nodeTable[record.superIndex].firstSubnodeIndex = nodeIndex;
+            }
+
+            lastSubnodeIndex[record.superIndex] = nodeIndex;
+        }
+
+        if (record.nodeType == kStructureGeometryNode)
+        {
+            const GeometryNodeStructure* geometryNodeStructure = static_cast<const GeometryNodeStructure*>(nodeStructure);
+            record.objectIndex = FindIndex(objectIndexMap, geometryNodeStructure->GetGeometryObjectStructure());
+            record.worldBoundingBox = geometryNodeStructure->GetWorldBoundingBox();
+            record.worldBoundingSphere = geometryNodeStructure->GetWorldBoundingSphere();
+
+            std::vector<int32> materialIndexArray;
+            for (machine a = 0; a < geometryNodeStructure->GetMaterialCount(); a++)
+            {
+                materialIndexArray.push_back(FindIndex(materialIndexMap, geometryNodeStructure->GetMaterialStructure(int32(a))));
+            }
+
+            std::vector<SceneMorphWeight> morphWeightArray;
+            for (const MorphWeightStructure* morphWeightStructure : geometryNodeStructure->GetMorphWeightList())
+            {
+                morphWeightArray.push_back(SceneMorphWeight{morphWeightStructure->GetMorphIndex(), morphWeightStructure->GetMorphWeight()});
+            }
+
+            record.materialCount = int32(materialIndexArray.size());
+            record.materialArray = arena.Copy(materialIndexArray.data(), materialIndexArray.size());
+            record.morphWeightCount = int32(morphWeightArray.size());
+            record.morphWeightArray = arena.Copy(morphWeightArray.data(), morphWeightArray.size());
+        }
+        else if (record.nodeType == kStructureLightNode)
+        {
+            record.objectIndex = FindIndex(objectIndexMap, static_cast<const LightNodeStructure*>(nodeStructure)->GetLightObjectStructure());
+        }
+        else if (record.nodeType == kStructureCameraNode)
+        {
+            record.objectIndex = FindIndex(objectIndexMap, static_cast<const CameraNodeStructure*>(nodeStructure)->GetCameraObjectStructure());
+        }
+    }
+
+    // Track targets are transforms and morph weights belonging directly to a node.
+
+    std::vector<SceneAnimation> animationTable;
+    for (const AnimationStructure* animationStructure : animationStructureArray)
+    {
+        std::vector<SceneTrack> trackArray;
+        for (const Structure* subnode = animationStructure->GetFirstSubnode(); subnode; subnode = subnode->GetNextSubnode())
+        {
+            if (subnode->GetStructureType() != kStructureTrack)
+            {
+                continue;
+            }
+
+            const TrackStructure* trackStructure = static_cast<const TrackStructure*>(subnode);
+            const Structure*      targetStructure = trackStructure->GetTargetStructure();
+
+            SceneTrack& record = trackArray.emplace_back();
+            record.nodeIndex = FindIndex(nodeIndexMap, targetStructure->GetSuperNode());
+            record.targetType = targetStructure->GetStructureType();
+            record.targetIndex = (record.targetType == kStructureMorphWeight) ? int32(static_cast<const MorphWeightStructure*>(targetStructure)->GetMorphIndex()) : FindIndex(transformIndexMap, targetStructure);
+            record.timeCurve = BuildCurve(arena, trackStructure->GetTimeStructure());
+            record.valueCurve = BuildCurve(arena, trackStructure->GetValueStructure());
+        }
+
+        SceneAnimation& record = animationTable.emplace_back();
+        record.clipIndex = animationStructure->GetClipIndex();
+        record.trackCount = int32(trackArray.size());
+        record.trackArray = arena.Copy(trackArray.data(), trackArray.size());
+    }
+
+    nodeCount = int32(nodeTable.size());
+    nodeArray = arena.Copy(nodeTable.data(), nodeTable.size());
+    geometryObjectCount = int32(geometryObjectTable.size());
+    geometryObjectArray = arena.Copy(geometryObjectTable.data(), geometryObjectTable.size());
+    lightObjectCount = int32(lightObjectTable.size());
+    lightObjectArray = arena.Copy(lightObjectTable.data(), lightObjectTable.size());
+    cameraObjectCount = int32(cameraObjectTable.size());
+    cameraObjectArray = arena.Copy(cameraObjectTable.data(), cameraObjectTable.size());
+    materialCount = int32(materialTable.size());
+    materialArray = arena.Copy(materialTable.data(), materialTable.size());
+    skeletonCount = int32(skeletonTable.size());
+    skeletonArray = arena.Copy(skeletonTable.data(), skeletonTable.size());
+    animationCount = int32(animationTable.size());
+    animationArray = arena.Copy(animationTable.data(), animationTable.size());
+
+    distanceScale = dataDescription->GetDistanceScale();
+    angleScale = dataDescription->GetAngleScale();
+    timeScale = dataDescription->GetTimeScale();
+    upDirection = dataDescription->GetUpDirection()[0];
+    forwardDirection = dataDescription->GetForwardDirection()[0];
+
+    return (arena.GetSize());
+}
+
+int32 CompactScene::FindNode(std::string_view name) const
+{
+    for (machine a = 0; a < nodeCount; a++)
+    {
+        if (name == nodeArray[a].nodeName)
+        {
+            return (int32(a));
+        }
+    }
+
+    return (-1);
+}
+
+const SceneVertexArray* CompactScene::FindVertexArray(const SceneMesh& mesh, std::string_view attrib, uint32 index, uint32 morph)
+{
+    for (machine a = 0; a < mesh.vertexArrayCount; a++)
+    {
+        const SceneVertexArray* vertexArray = &mesh.vertexArray[a];
+        if ((attrib == vertexArray->attrib) && (vertexArray->attribIndex == index) && (vertexArray->morphIndex == morph))
+        {
+            return (vertexArray);
+        }
+    }
+
+    return (nullptr);
+}
+
+const SceneColor* CompactScene::FindColor(const SceneMaterial& material, std::string_view attrib)
+{
+    return (FindAttrib(material.colorArray, material.colorCount, attrib));
+}
+
+const SceneParam* CompactScene::FindParam(const SceneMaterial& material, std::string_view attrib)
+{
+    return (FindAttrib(material.paramArray, material.paramCount, attrib));
+}
+
+const SceneTexture* CompactScene::FindTexture(const SceneMaterial& material, std::string_view attrib)
+{
+    return (FindAttrib(material.textureArray, material.textureCount, attrib));
+}
+
+const SceneColor* CompactScene::FindColor(const SceneLightObject& lightObject, std::string_view attrib)
+{
+    return (FindAttrib(lightObject.colorArray, lightObject.colorCount, attrib));
+}
+
+const SceneParam* CompactScene::FindParam(const SceneLightObject& lightObject, std::string_view attrib)
+{
+    return (FindAttrib(lightObject.paramArray, lightObject.paramCount, attrib));
+}
+
+const SceneTexture* CompactScene::FindTexture(const SceneLightObject& lightObject, std::string_view attrib)
+{
+    return (FindAttrib(lightObject.textureArray, lightObject.textureCount, attrib));
+}
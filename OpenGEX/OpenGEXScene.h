@@ -0,0 +1,420 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#ifndef OpenGEXScene_h
+#define OpenGEXScene_h
+
+#include "OpenGEXBounds.h"
+#include "OpenGEXMeshlet.h"
+#include "OpenGEXMorph.h"
+#include "OpenGEXSkinPack.h"
+#include "TSColor.h"
+#include "TSOpenDDL.h"
+
+#include <string_view>
+
+using namespace Terathon;
+
+namespace OpenGEX
+{
+    class OpenGexDataDescription;
+
+    // The records of a compact scene are plain data that point into the storage of the scene that owns them.
+    // Indexes of other records are -1 when there is no such record, and strings are never null.
+
+    struct SceneVertexArray
+    {
+        const char*  attrib;
+        uint32       attribIndex;
+        uint32       morphIndex;
+        int32        vertexCount;
+        int32        componentCount;
+        const float* vertexArray;
+    };
+
+    struct SceneIndexArray
+    {
+        uint32      materialIndex;
+        uint64      restartIndex;
+        const char* frontFace;
+        int32       indexCount;
+        int32       indexSize;
+        const void* indexArray;
+    };
+
+    // The bone arrays are the processed influences of the skin, and the packed data is only present if the
+    // influences were packed. The skeleton is an index into the skeleton table of the scene.
+
+    struct SceneSkin
+    {
+        Transform3D skinTransform;
+        int32       skeletonIndex;
+
+        int32         vertexCount;
+        int32         boneIndexCount;
+        const uint16* boneCountArray;
+        const uint16* boneIndexArray;
+        const float*  boneWeightArray;
+
+        PackedSkinData packedSkinData;
+    };
+
+    // Bones are indexes into the node table, and the inverse bind transforms include the skin transform.
+
+    struct SceneSkeleton
+    {
+        int32              boneCount;
+        const int32*       boneNodeArray;
+        const Transform3D* inverseBindArray;
+    };
+
+    struct SceneMesh
+    {
+        uint32      meshLevel;
+        const char* meshPrimitive;
+        int32       vertexCount;
+        float       lodError;
+
+        int32                   vertexArrayCount;
+        const SceneVertexArray* vertexArray;
+        int32                   indexArrayCount;
+        const SceneIndexArray*  indexArray;
+        const SceneSkin*        skin;
+
+        BoundingBox        boundingBox;
+        BoundingSphere     boundingSphere;
+        int32              boneBoundsCount;
+        const BoundingBox* boneBoundsArray;
+
+        int32              morphTargetCount;
+        const MorphTarget* morphTargetArray;
+        MeshletData        meshletData;
+    };
+
+    // Meshes are stored in increasing order of level, so the first one is the base mesh.
+
+    struct SceneGeometryObject
+    {
+        int32            meshCount;
+        const SceneMesh* meshArray;
+    };
+
+    // Colors, params, and textures of materials and lights are keyed by their attrib strings, in the order they
+    // appear in the file.
+
+    struct SceneColor
+    {
+        const char* attrib;
+        ColorRGBA   color;
+    };
+
+    struct SceneParam
+    {
+        const char* attrib;
+        float       param;
+    };
+
+    struct SceneTexture
+    {
+        const char* attrib;
+        const char* textureName;
+        uint32      texcoordIndex;
+        const char* textureSwizzle;
+        const char* textureAddress[3];
+        const char* textureBorder;
+        Transform3D texcoordTransform;
+    };
+
+    struct SceneAtten
+    {
+        const char* attenKind;
+        const char* curveType;
+        float       beginParam;
+        float       endParam;
+        float       scaleParam;
+        float       offsetParam;
+        float       constantParam;
+        float       linearParam;
+        float       quadraticParam;
+        float       powerParam;
+    };
+
+    struct SceneLightObject
+    {
+        const char* typeString;
+        bool        shadowFlag;
+
+        int32               colorCount;
+        const SceneColor*   colorArray;
+        int32               paramCount;
+        const SceneParam*   paramArray;
+        int32               textureCount;
+        const SceneTexture* textureArray;
+        int32               attenCount;
+        const SceneAtten*   attenArray;
+    };
+
+    struct SceneCameraObject
+    {
+        float projectionDistance;
+        float nearDepth;
+        float farDepth;
+    };
+
+    struct SceneMaterial
+    {
+        const char* materialName;
+        bool        twoSidedFlag;
+
+        int32               colorCount;
+        const SceneColor*   colorArray;
+        int32               paramCount;
+        const SceneParam*   paramArray;
+        int32               textureCount;
+        const SceneTexture* textureArray;
+    };
+
+    struct SceneMorphWeight
+    {
+        uint32 morphIndex;
+        float  morphWeight;
+    };
+
+    // A transform belonging to a node, in the order they appear in the node. The matrix is the current value of the
+    // transform, and the kind is empty for Matrix and Transform structures.
+
+    struct SceneTransform
+    {
+        StructureType transformType;
+        const char*   transformKind;
+        bool          objectFlag;
+        Transform3D   matrix;
+    };
+
+    // Every key array of a curve holds the same number of floats, and arrays that the curve type doesn't use are null.
+
+    struct SceneCurve
+    {
+        const char*  curveType;
+        int32        elementCount;
+        const float* valueArray;
+        const float* controlArray[2];
+        const float* tensionArray;
+        const float* continuityArray;
+        const float* biasArray;
+    };
+
+    // The target of a track is a transform of a node, given by its index in the transform array of the node,
+    // or a morph weight of a geometry node, given by its morph index.
+
+    struct SceneTrack
+    {
+        int32         nodeIndex;
+        StructureType targetType;
+        int32         targetIndex;
+        SceneCurve    timeCurve;
+        SceneCurve    valueCurve;
+    };
+
+    struct SceneAnimation
+    {
+        uint32            clipIndex;
+        int32             trackCount;
+        const SceneTrack* trackArray;
+    };
+
+    // Nodes are stored in the order they appear in the file, so a node always comes after its super node. The object
+    // index refers to the geometry, light, or camera table selected by the node type, and the material array holds
+    // indexes into the material table. Bounds are only meaningful for geometry nodes.
+
+    struct SceneNode
+    {
+        StructureType nodeType;
+        const char*   nodeName;
+        int32         superIndex;
+        int32         firstSubnodeIndex;
+        int32         nextSubnodeIndex;
+        int32         objectIndex;
+
+        int32                   materialCount;
+        const int32*            materialArray;
+        int32                   morphWeightCount;
+        const SceneMorphWeight* morphWeightArray;
+        int32                   transformCount;
+        const SceneTransform*   transformArray;
+
+        Transform3D nodeTransform;
+        Transform3D objectTransform;
+        Transform3D inverseObjectTransform;
+        Transform3D worldTransform;
+
+        BoundingBox    worldBoundingBox;
+        BoundingSphere worldBoundingSphere;
+    };
+
+    // A read-only scene holding the processed data of an OpenGEX file in a single block of storage. The structure
+    // tree can be destroyed once the scene has been built, and the scene holds no pointers into it. Transforms and
+    // bounds are those of the description at the time the scene was built. Animation curves are kept as data, and
+    // evaluating them is left to the application.
+
+    class CompactScene
+    {
+    private:
+        char*   sceneStorage;
+        machine sceneSize;
+
+        int32                      nodeCount;
+        const SceneNode*           nodeArray;
+        int32                      geometryObjectCount;
+        const SceneGeometryObject* geometryObjectArray;
+        int32                      lightObjectCount;
+        const SceneLightObject*    lightObjectArray;
+        int32                      cameraObjectCount;
+        const SceneCameraObject*   cameraObjectArray;
+        int32                      materialCount;
+        const SceneMaterial*       materialArray;
+        int32                      skeletonCount;
+        const SceneSkeleton*       skeletonArray;
+        int32                      animationCount;
+        const SceneAnimation*      animationArray;
+
+        float distanceScale;
+        float angleScale;
+        float timeScale;
+        char  upDirection;
+        char  forwardDirection;
+
+        machine Build(const OpenGexDataDescription* dataDescription, char* storage);
+
+    public:
+        explicit CompactScene(const OpenGexDataDescription* dataDescription);
+        ~CompactScene();
+
+        CompactScene(const CompactScene&) = delete;
+        CompactScene& operator=(const CompactScene&) = delete;
+
+        // The size of the single allocation holding every table, string, and array in the scene.
+
+        machine GetSceneSize(void) const
+        {
+            return (sceneSize);
+        }
+
+        float GetDistanceScale(void) const
+        {
+            return (distanceScale);
+        }
+
+        float GetAngleScale(void) const
+        {
+            return (angleScale);
+        }
+
+        float GetTimeScale(void) const
+        {
+            return (timeScale);
+        }
+
+        char GetUpDirection(void) const
+        {
+            return (upDirection);
+        }
+
+        char GetForwardDirection(void) const
+        {
+            return (forwardDirection);
+        }
+
+        int32 GetNodeCount(void) const
+        {
+            return (nodeCount);
+        }
+
+        const SceneNode& GetNode(int32 index) const
+        {
+            return (nodeArray[index]);
+        }
+
+        int32 GetGeometryObjectCount(void) const
+        {
+            return (geometryObjectCount);
+        }
+
+        const SceneGeometryObject& GetGeometryObject(int32 index) const
+        {
+            return (geometryObjectArray[index]);
+        }
+
+        int32 GetLightObjectCount(void) const
+        {
+            return (lightObjectCount);
+        }
+
+        const SceneLightObject& GetLightObject(int32 index) const
+        {
+            return (lightObjectArray[index]);
+        }
+
+        int32 GetCameraObjectCount(void) const
+        {
+            return (cameraObjectCount);
+        }
+
+        const SceneCameraObject& GetCameraObject(int32 index) const
+        {
+            return (cameraObjectArray[index]);
+        }
+
+        int32 GetMaterialCount(void) const
+        {
+            return (materialCount);
+        }
+
+        const SceneMaterial& GetMaterial(int32 index) const
+        {
+            return (materialArray[index]);
+        }
+
+        int32 GetSkeletonCount(void) const
+        {
+            return (skeletonCount);
+        }
+
+        const SceneSkeleton& GetSkeleton(int32 index) const
+        {
+            return (skeletonArray[index]);
+        }
+
+        int32 GetAnimationCount(void) const
+        {
+            return (animationCount);
+        }
+
+        const SceneAnimation& GetAnimation(int32 index) const
+        {
+            return (animationArray[index]);
+        }
+
+        // Returns the index of the first node with the given name, or -1 if there isn't one.
+
+        int32 FindNode(std::string_view name) const;
+
+        static const SceneVertexArray* FindVertexArray(const SceneMesh& mesh, std::string_view attrib, uint32 index = 0, uint32 morph = 0);
+
+        // Return the color, param, or texture with the given attrib, or nullptr if there isn't one.
+
+        static const SceneColor*   FindColor(const SceneMaterial& material, std::string_view attrib);
+        static const SceneParam*   FindParam(const SceneMaterial& material, std::string_view attrib);
+        static const SceneTexture* FindTexture(const SceneMaterial& material, std::string_view attrib);
+        static const SceneColor*   FindColor(const SceneLightObject& lightObject, std::string_view attrib);
+        static const SceneParam*   FindParam(const SceneLightObject& lightObject, std::string_view attrib);
+        static const SceneTexture* FindTexture(const SceneLightObject& lightObject, std::string_view attrib);
+    };
+} // namespace OpenGEX
+
+#endif
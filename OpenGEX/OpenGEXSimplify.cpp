@@ -0,0 +1,627 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#include "OpenGEXSimplify.h"
+
+#include <algorithm>
+
+using namespace OpenGEX;
+
+namespace
+{
+    enum : uint32
+    {
+        kNoVertex = 0xFFFFFFFF,
+        kMultipleVertices = 0xFFFFFFFE
+    };
+
+    enum : uint8
+    {
+        kVertexManifold,
+        kVertexBorder,
+        kVertexSeam,
+        kVertexLocked
+    };
+
+    // Indexed by source kind and then target kind.
+
+    const bool kCanCollapse[4][4] = {
+        {true, true, true, true},
+        {false, true, false, false},
+        {false, false, true, false},
+        {false, false, false, false}};
+
+    const float kEdgeWeight = 10.0F;
+    const float kPassErrorBound = 1.5F;
+
+    struct Quadric
+    {
+        float a00, a11, a22;
+        float a10, a20, a21;
+        float b0, b1, b2;
+        float c;
+        float w;
+
+        void Clear(void)
+        {
+            a00 = a11 = a22 = 0.0F;
+            a10 = a20 = a21 = 0.0F;
+            b0 = b1 = b2 = 0.0F;
+            c = 0.0F;
+            w = 0.0F;
+        }
+
+        void AddPlane(const Vector3D& n, float d, float weight)
+        {
+            float x = n.x * weight;
+            float y = n.y * weight;
+            float z = n.z * weight;
+
+            a00 += n.x * x;
+            a11 += n.y * y;
+            a22 += n.z * z;
+            a10 += n.y * x;
+            a20 += n.z * x;
+            a21 += n.z * y;
+            b0 += d * x;
+            b1 += d * y;
+            b2 += d * z;
+            c += d * d * weight;
+            w += weight;
+        }
+
+        float CalculateError(const Point3D& p) const
+        {
+            float rx = a00 * p.x + a10 * p.y + a20 * p.z;
+            float ry = a10 * p.x + a11 * p.y + a21 * p.z;
+            float rz = a20 * p.x + a21 * p.y + a22 * p.z;
+
+            float r = rx * p.x + ry * p.y + rz * p.z + (b0 * p.x + b1 * p.y + b2 * p.z) * 2.0F + c;
+            return ((w > 0.0F) ? Fabs(r) / w : 0.0F);
+        }
+    };
+
+    struct Collapse
+    {
+        uint32 source;
+        uint32 target;
+        float  error;
+
+        bool operator<(const Collapse& collapse) const
+        {
+            return (error < collapse.error);
+        }
+    };
+
+    inline bool EqualPositions(const Point3D& p, const Point3D& q)
+    {
+        return ((p.x == q.x) && (p.y == q.y) && (p.z == q.z));
+    }
+
+    inline void UpdateOpenEdge(uint32* openArray, uint32 vertex, uint32 other)
+    {
+        uint32 v = openArray[vertex];
+        openArray[vertex] = (v == kNoVertex) ? other : ((v == other) ? v : kMultipleVertices);
+    }
+
+    struct SimplifyState
+    {
+        const Point3D* position;
+        const uint32*  remap;
+        const uint32*  indexArray;
+        const uint32*  groupArray;
+        const int32*   cornerOffset;
+        const int32*   cornerArray;
+
+        bool HasEdge(uint32 v, uint32 t, uint32 group) const
+        {
+            for (machine a = cornerOffset[v]; a < cornerOffset[v + 1]; a++)
+            {
+                int32 corner = cornerArray[a];
+                int32 triangle = corner / 3;
+                if ((indexArray[triangle * 3 + (corner + 1) % 3] == t) && (groupArray[triangle] == group))
+                {
+                    return (true);
+                }
+            }
+
+            return (false);
+        }
+
+        // Returns the number of triangles that collapsing source onto target removes, or -1 if the collapse
+        // would turn any of the remaining triangles around source too far.
+
+        int32 CheckCollapse(uint32 source, uint32 target) const
+        {
+            const Point3D& ps = position[source];
+            const Point3D& pt = position[target];
+            int32          removedCount = 0;
+
+            for (machine a = cornerOffset[source]; a < cornerOffset[source + 1]; a++)
+            {
+                int32  corner = cornerArray[a];
+                int32  triangle = corner / 3;
+                uint32 i1 = indexArray[triangle * 3 + (corner + 1) % 3];
+                uint32 i2 = indexArray[triangle * 3 + (corner + 2) % 3];
+
+                if ((remap[i1] == remap[target]) || (remap[i2] == remap[target]))
+                {
+                    removedCount++;
+                    continue;
+                }
+
+                const Point3D& p1 = position[i1];
+                const Point3D& p2 = position[i2];
+
+                Vector3D n0 = Cross(p1 - ps, p2 - ps);
+                Vector3D n1 = Cross(p1 - pt, p2 - pt);
+                if (Dot(n0, n1) < 0.25F * Sqrt(SquaredMag(n0) * SquaredMag(n1)))
+                {
+                    return (-1);
+                }
+            }
+
+            return (removedCount);
+        }
+    };
+} // namespace
+
+int32 OpenGEX::SimplifyMesh(const uint32* indexArray, const uint32* groupArray, int32 indexCount, const float* positionArray, int32 positionStride, int32 vertexCount,
+                            int32 targetIndexCount, uint32* outputIndexArray, uint32* outputGroupArray, float* error)
+{
+    for (machine a = 0; a < indexCount; a++)
+    {
+        outputIndexArray[a] = indexArray[a];
+    }
+
+    for (machine a = 0; a < indexCount / 3; a++)
+    {
+        outputGroupArray[a] = groupArray[a];
+    }
+
+    *error = 0.0F;
+
+    if ((indexCount <= targetIndexCount) || (vertexCount == 0))
+    {
+        return (indexCount);
+    }
+
+    // Positions are normalized to the unit cube so that quadric error values are well conditioned.
+
+    Point3D* position = new Point3D[vertexCount];
+
+    Point3D pmin(positionArray[0], positionArray[1], positionArray[2]);
+    Point3D pmax = pmin;
+    for (machine a = 1; a < vertexCount; a++)
+    {
+        const float* p = positionArray + a * positionStride;
+        pmin.Set(Fmin(pmin.x, p[0]), Fmin(pmin.y, p[1]), Fmin(pmin.z, p[2]));
+        pmax.Set(Fmax(pmax.x, p[0]), Fmax(pmax.y, p[1]), Fmax(pmax.z, p[2]));
+    }
+
+    float extent = Fmax(pmax.x - pmin.x, pmax.y - pmin.y, pmax.z - pmin.z);
+    float scale = (extent > 0.0F) ? 1.0F / extent : 0.0F;
+
+    for (machine a = 0; a < vertexCount; a++)
+    {
+        const float* p = positionArray + a * positionStride;
+        position[a].Set((p[0] - pmin.x) * scale, (p[1] - pmin.y) * scale, (p[2] - pmin.z) * scale);
+    }
+
+    // Vertices having identical positions are grouped so that seams can be recognized. The sorted
+    // order keeps each group contiguous, and remap holds the first vertex of each group.
+
+    uint32* sortedArray = new uint32[vertexCount];
+    uint32* remap = new uint32[vertexCount];
+    uint32* wedge = new uint32[vertexCount];
+
+    for (machine a = 0; a < vertexCount; a++)
+    {
+        sortedArray[a] = uint32(a);
+    }
+
+    std::sort(sortedArray, sortedArray + vertexCount, [position](uint32 i, uint32 j) {
+        const Point3D& p = position[i];
+        const Point3D& q = position[j];
+        return ((p.x < q.x) || ((p.x == q.x) && ((p.y < q.y) || ((p.y == q.y) && ((p.z < q.z) || ((p.z == q.z) && (i < j)))))));
+    });
+
+    for (machine a = 0; a < vertexCount;)
+    {
+        uint32         first = sortedArray[a];
+        const Point3D& p = position[first];
+
+        machine b = a;
+        while ((b < vertexCount) && (EqualPositions(position[sortedArray[b]], p)))
+        {
+            remap[sortedArray[b]] = first;
+            b++;
+        }
+
+        a = b;
+    }
+
+    int32*    cornerOffset = new int32[vertexCount + 1];
+    int32*    cornerArray = new int32[indexCount];
+    uint32*   openInc = new uint32[vertexCount];
+    uint32*   openOut = new uint32[vertexCount];
+    uint8*    openFlag = new uint8[indexCount];
+    uint8*    kind = new uint8[vertexCount];
+    bool*     lockFlag = new bool[vertexCount];
+    uint32*   collapseRemap = new uint32[vertexCount];
+    Quadric*  quadric = new Quadric[vertexCount];
+    Collapse* collapseArray = new Collapse[indexCount * 2];
+
+    SimplifyState state;
+    state.position = position;
+    state.remap = remap;
+    state.indexArray = outputIndexArray;
+    state.groupArray = outputGroupArray;
+    state.cornerOffset = cornerOffset;
+    state.cornerArray = cornerArray;
+
+    float maxError = 0.0F;
+    int32 currentCount = indexCount;
+
+    while (currentCount > targetIndexCount)
+    {
+        int32 triangleCount = currentCount / 3;
+
+        // Build the vertex-to-corner adjacency for the current triangles.
+
+        for (machine a = 0; a <= vertexCount; a++)
+        {
+            cornerOffset[a] = 0;
+        }
+
+        for (machine a = 0; a < currentCount; a++)
+        {
+            cornerOffset[outputIndexArray[a] + 1]++;
+        }
+
+        for (machine a = 0; a < vertexCount; a++)
+        {
+            cornerOffset[a + 1] += cornerOffset[a];
+            collapseRemap[a] = cornerOffset[a];
+        }
+
+        for (machine a = 0; a < currentCount; a++)
+        {
+            cornerArray[collapseRemap[outputIndexArray[a]]++] = int32(a);
+        }
+
+        // Link the referenced vertices in each position group into a circular wedge list.
+
+        for (machine a = 0; a < vertexCount;)
+        {
+            uint32 group = remap[sortedArray[a]];
+            uint32 first = kNoVertex;
+            uint32 previous = kNoVertex;
+
+            machine b = a;
+            for (; (b < vertexCount) && (remap[sortedArray[b]] == group); b++)
+            {
+                uint32 v = sortedArray[b];
+                wedge[v] = v;
+
+                if (cornerOffset[v + 1] != cornerOffset[v])
+                {
+                    if (previous != kNoVertex)
+                    {
+                        wedge[previous] = v;
+                    }
+                    else
+                    {
+                        first = v;
+                    }
+
+                    previous = v;
+                }
+            }
+
+            if (previous != kNoVertex)
+            {
+                wedge[previous] = first;
+            }
+
+            a = b;
+        }
+
+        // Find open edges, which have no opposite half-edge in the same group, and classify vertices.
+
+        for (machine a = 0; a < vertexCount; a++)
+        {
+            openInc[a] = kNoVertex;
+            openOut[a] = kNoVertex;
+        }
+
+        for (machine a = 0; a < currentCount; a++)
+        {
+            int32  triangle = int32(a / 3);
+            uint32 v = outputIndexArray[a];
+            uint32 t = outputIndexArray[triangle * 3 + (a + 1) % 3];
+
+            bool open = !state.HasEdge(t, v, outputGroupArray[triangle]);
+            openFlag[a] = open;
+
+            if (open)
+            {
+                UpdateOpenEdge(openOut, v, t);
+                UpdateOpenEdge(openInc, t, v);
+            }
+        }
+
+        for (machine a = 0; a < vertexCount; a++)
+        {
+            uint32 w = wedge[a];
+            if (w == a)
+            {
+                uint32 i = openInc[a];
+                uint32 o = openOut[a];
+
+                if ((i == kNoVertex) && (o == kNoVertex))
+                {
+                    kind[a] = kVertexManifold;
+                }
+                else
+                {
+                    kind[a] = ((i < kMultipleVertices) && (o < kMultipleVertices)) ? kVertexBorder : kVertexLocked;
+                }
+            }
+            else if (wedge[w] == a)
+            {
+                uint32 i0 = openInc[a];
+                uint32 o0 = openOut[a];
+                uint32 i1 = openInc[w];
+                uint32 o1 = openOut[w];
+
+                bool seam = (i0 < kMultipleVertices) && (o0 < kMultipleVertices) && (i1 < kMultipleVertices) && (o1 < kMultipleVertices);
+                kind[a] = ((seam) && (remap[i0] == remap[o1]) && (remap[o0] == remap[i1])) ? kVertexSeam : kVertexLocked;
+            }
+            else
+            {
+                kind[a] = kVertexLocked;
+            }
+        }
+
+        // Accumulate area-weighted plane quadrics for each position group, plus perpendicular planes
+        // along open edges so that borders and seams keep their shape.
+
+        for (machine a = 0; a < vertexCount; a++)
+        {
+            quadric[a].Clear();
+        }
+
+        for (machine a = 0; a < triangleCount; a++)
+        {
+            const uint32* k = outputIndexArray + a * 3;
+
+            const Point3D& p0 = position[k[0]];
+            const Point3D& p1 = position[k[1]];
+            const Point3D& p2 = position[k[2]];
+
+            Vector3D normal = Cross(p1 - p0, p2 - p0);
+            float    area = Magnitude(normal);
+            if (area <= 0.0F)
+            {
+                continue;
+            }
+
+            normal /= area;
+            float d = -Dot(normal, p0);
+
+            quadric[remap[k[0]]].AddPlane(normal, d, area);
+            quadric[remap[k[1]]].AddPlane(normal, d, area);
+            quadric[remap[k[2]]].AddPlane(normal, d, area);
+
+            for (machine e = 0; e < 3; e++)
+            {
+                if (openFlag[a * 3 + e])
+                {
+                    uint32 i0 = k[e];
+                    uint32 i1 = k[(e + 1) % 3];
+
+                    Vector3D edge = position[i1] - position[i0];
+                    float    length = SquaredMag(edge);
+                    if (length > 0.0F)
+                    {
+                        Vector3D edgeNormal = Normalize(Cross(edge, normal));
+                        float    edgeDistance = -Dot(edgeNormal, position[i0]);
+
+                        quadric[remap[i0]].AddPlane(edgeNormal, edgeDistance, length * kEdgeWeight);
+                        quadric[remap[i1]].AddPlane(edgeNormal, edgeDistance, length * kEdgeWeight);
+                    }
+                }
+            }
+        }
+
+        // Gather collapse candidates in both directions along each edge. Interior edges are seen from two
+        // triangles, so they're only taken from the side where the first index is smaller.
+
+        int32 collapseCount = 0;
+        for (machine a = 0; a < currentCount; a++)
+        {
+            int32  triangle = int32(a / 3);
+            uint32 i0 = outputIndexArray[a];
+            uint32 i1 = outputIndexArray[triangle * 3 + (a + 1) % 3];
+
+            if ((!openFlag[a]) && (i0 > i1))
+            {
+                continue;
+            }
+
+            for (machine direction = 0; direction < 2; direction++)
+            {
+                uint32 source = (direction == 0) ? i0 : i1;
+                uint32 target = (direction == 0) ? i1 : i0;
+
+                if (remap[source] == remap[target])
+                {
+                    continue;
+                }
+
+                uint8 sourceKind = kind[source];
+                if (!kCanCollapse[sourceKind][kind[target]])
+                {
+                    continue;
+                }
+
+                if ((sourceKind != kVertexManifold) && (openOut[source] != target) && (openInc[source] != target))
+                {
+                    // Border and seam vertices can only slide along their own edge.
+                    continue;
+                }
+
+                Collapse* collapse = &collapseArray[collapseCount++];
+                collapse->source = source;
+                collapse->target = target;
+                collapse->error = quadric[remap[source]].CalculateError(position[target]);
+            }
+        }
+
+        if (collapseCount == 0)
+        {
+            break;
+        }
+
+        std::sort(collapseArray, collapseArray + collapseCount);
+
+        // Apply the cheapest collapses that don't touch each other, stopping once enough triangles are gone or the
+        // error rises well above the error of the collapse that would be needed to reach the goal in this pass.
+
+        int32 triangleGoal = (currentCount - targetIndexCount + 2) / 3;
+        int32 edgeGoal = Max(triangleGoal / 2, 1);
+        float errorLimit = collapseArray[Min(edgeGoal, collapseCount - 1)].error * kPassErrorBound;
+
+        for (machine a = 0; a < vertexCount; a++)
+        {
+            collapseRemap[a] = uint32(a);
+            lockFlag[a] = false;
+        }
+
+        int32 removedCount = 0;
+        bool  collapseFlag = false;
+
+        for (machine a = 0; (a < collapseCount) && (removedCount < triangleGoal); a++)
+        {
+            const Collapse& collapse = collapseArray[a];
+            if (collapse.error > errorLimit)
+            {
+                break;
+            }
+
+            uint32 source = collapse.source;
+            uint32 target = collapse.target;
+            if ((lockFlag[source]) || (lockFlag[target]))
+            {
+                continue;
+            }
+
+            uint32 siblingSource = kNoVertex;
+            uint32 siblingTarget = kNoVertex;
+
+            if (kind[source] == kVertexSeam)
+            {
+                // The other side of the seam moves to the matching vertex on its own side.
+
+                siblingSource = wedge[source];
+                siblingTarget = (remap[openOut[siblingSource]] == remap[target]) ? openOut[siblingSource] : openInc[siblingSource];
+
+                if ((remap[siblingTarget] != remap[target]) || (lockFlag[siblingSource]) || (lockFlag[siblingTarget]))
+                {
+                    continue;
+                }
+            }
+
+            int32 count = state.CheckCollapse(source, target);
+            if (count < 0)
+            {
+                continue;
+            }
+
+            if (siblingSource != kNoVertex)
+            {
+                int32 siblingCount = state.CheckCollapse(siblingSource, siblingTarget);
+                if (siblingCount < 0)
+                {
+                    continue;
+                }
+
+                count += siblingCount;
+                collapseRemap[siblingSource] = siblingTarget;
+            }
+
+            collapseRemap[source] = target;
+
+            for (machine side = 0; side < 2; side++)
+            {
+                uint32 v = (side == 0) ? source : siblingSource;
+                if (v == kNoVertex)
+                {
+                    break;
+                }
+
+                for (machine b = cornerOffset[v]; b < cornerOffset[v + 1]; b++)
+                {
+                    const uint32* k = outputIndexArray + (cornerArray[b] / 3) * 3;
+                    lockFlag[k[0]] = true;
+                    lockFlag[k[1]] = true;
+                    lockFlag[k[2]] = true;
+                }
+            }
+
+            removedCount += count;
+            maxError = Fmax(maxError, collapse.error);
+            collapseFlag = true;
+        }
+
+        if (!collapseFlag)
+        {
+            break;
+        }
+
+        // Rewrite the triangles and remove the ones that have become degenerate.
+
+        int32 newCount = 0;
+        for (machine a = 0; a < triangleCount; a++)
+        {
+            uint32 i0 = collapseRemap[outputIndexArray[a * 3]];
+            uint32 i1 = collapseRemap[outputIndexArray[a * 3 + 1]];
+            uint32 i2 = collapseRemap[outputIndexArray[a * 3 + 2]];
+
+            if ((remap[i0] != remap[i1]) && (remap[i1] != remap[i2]) && (remap[i2] != remap[i0]))
+            {
+                outputGroupArray[newCount / 3] = outputGroupArray[a];
+                outputIndexArray[newCount] = i0;
+                outputIndexArray[newCount + 1] = i1;
+                outputIndexArray[newCount + 2] = i2;
+                newCount += 3;
+            }
+        }
+
+        currentCount = newCount;
+    }
+
+    delete[] collapseArray;
+    delete[] quadric;
+    delete[] collapseRemap;
+    delete[] lockFlag;
+    delete[] kind;
+    delete[] openFlag;
+    delete[] openOut;
+    delete[] openInc;
+    delete[] cornerArray;
+    delete[] cornerOffset;
+    delete[] wedge;
+    delete[] remap;
+    delete[] sortedArray;
+    delete[] position;
+
+    *error = Sqrt(maxError) * extent;
+    return (currentCount);
+}
@@ -0,0 +1,38 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#ifndef OpenGEXSimplify_h
+#define OpenGEXSimplify_h
+
+#include "TSVector3D.h"
+
+using namespace Terathon;
+
+namespace OpenGEX
+{
+    enum
+    {
+        kLodDefaultCount = 3
+    };
+
+    // Reduces a triangle list to about targetIndexCount indices by collapsing edges in the order given by
+    // quadric error metrics. Every collapse moves one vertex onto another existing vertex, so the output
+    // references a subset of the input vertices and all per-vertex data remains valid.
+    //
+    // Vertices that share a position but not an index form attribute seams. A seam is only collapsed along
+    // itself, with both sides moving together, and open borders are likewise only collapsed along the border.
+    // Triangles are tagged with a group number, and edges between different groups are treated as borders.
+    //
+    // The output arrays must have room for indexCount indices and indexCount / 3 group numbers. The return
+    // value is the output index count, and the largest collapse error, as a distance, is stored in error.
+
+    int32 SimplifyMesh(const uint32* indexArray, const uint32* groupArray, int32 indexCount, const float* positionArray, int32 positionStride, int32 vertexCount,
+                       int32 targetIndexCount, uint32* outputIndexArray, uint32* outputGroupArray, float* error);
+} // namespace OpenGEX
+
+#endif
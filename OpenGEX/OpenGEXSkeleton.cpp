@@ -0,0 +1,105 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#include "OpenGEXSkeleton.h"
+
+using namespace OpenGEX;
+
+namespace
+{
+    inline uint32 HashData(uint32 hash, const void* data, machine size)
+    {
+        const uint8* byte = static_cast<const uint8*>(data);
+        for (machine a = 0; a < size; a++)
+        {
+            hash = (hash ^ byte[a]) * 0x01000193U;
+        }
+
+        return (hash);
+    }
+} // namespace
+
+Skeleton::Skeleton(int32 count, const Transform3D* const* boneTransforms, const Transform3D* inverseBindTransforms)
+{
+    boneCount = count;
+    boneTransformArray = new const Transform3D*[Max(count, 1)];
+    inverseBindArray = new Transform3D[Max(count, 1)];
+    paletteArray = new Transform3D[Max(count, 1)];
+
+    uint32 hash = 0x811C9DC5U;
+    for (machine a = 0; a < count; a++)
+    {
+        const Transform3D& inverseBindTransform = inverseBindTransforms[a];
+
+        boneTransformArray[a] = boneTransforms[a];
+        inverseBindArray[a] = inverseBindTransform;
+        paletteArray[a] = inverseBindTransform;
+
+        hash = HashData(hash, &boneTransforms[a], sizeof(const Transform3D*));
+        for (machine j = 0; j < 4; j++)
+        {
+            hash = HashData(hash, &inverseBindTransform(0, j), sizeof(float) * 3);
+        }
+    }
+
+    hashValue = hash;
+}
+
+Skeleton::~Skeleton()
+{
+    delete[] paletteArray;
+    delete[] inverseBindArray;
+    delete[] boneTransformArray;
+}
+
+bool Skeleton::Matches(const Skeleton* skeleton) const
+{
+    if ((skeleton->hashValue != hashValue) || (skeleton->boneCount != boneCount))
+    {
+        return (false);
+    }
+
+    for (machine a = 0; a < boneCount; a++)
+    {
+        if (skeleton->boneTransformArray[a] != boneTransformArray[a])
+        {
+            return (false);
+        }
+
+        const Transform3D& m1 = inverseBindArray[a];
+        const Transform3D& m2 = skeleton->inverseBindArray[a];
+        for (machine j = 0; j < 4; j++)
+        {
+            for (machine i = 0; i < 3; i++)
+            {
+                if (m1(i, j) != m2(i, j))
+                {
+                    return (false);
+                }
+            }
+        }
+    }
+
+    return (true);
+}
+
+void Skeleton::CalculatePalette(const Transform3D* poseArray, Transform3D* result) const
+{
+    for (machine a = 0; a < boneCount; a++)
+    {
+        result[a] = poseArray[a] * inverseBindArray[a];
+    }
+}
+
+void Skeleton::UpdatePalette(void)
+{
+    for (machine a = 0; a < boneCount; a++)
+    {
+        paletteArray[a] = *boneTransformArray[a] * inverseBindArray[a];
+    }
+}
@@ -0,0 +1,74 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#ifndef OpenGEXSkeleton_h
+#define OpenGEXSkeleton_h
+
+#include "TSMatrix4D.h"
+
+using namespace Terathon;
+
+namespace OpenGEX
+{
+    // The runtime form of a skeleton. Each bone refers to a transform that is kept up to date elsewhere, normally
+    // the world transform of a bone node, and has an inverse bind transform that already includes the skin transform.
+    // Palette entry i is the current transform of bone i times its inverse bind transform, which is the form taken
+    // by the skinning functions.
+    //
+    // Skins that use the same bones with the same bind pose and skin transform can share one skeleton, so the palette
+    // is only calculated once when the pose changes.
+
+    class Skeleton
+    {
+    private:
+        int32               boneCount;
+        uint32              hashValue;
+        const Transform3D** boneTransformArray;
+        Transform3D*        inverseBindArray;
+        Transform3D*        paletteArray;
+
+    public:
+        Skeleton(int32 count, const Transform3D* const* boneTransforms, const Transform3D* inverseBindTransforms);
+        ~Skeleton();
+
+        Skeleton(const Skeleton&) = delete;
+        Skeleton& operator=(const Skeleton&) = delete;
+
+        int32 GetBoneCount(void) const
+        {
+            return (boneCount);
+        }
+
+        uint32 GetHashValue(void) const
+        {
+            return (hashValue);
+        }
+
+        const Transform3D& GetInverseBindTransform(int32 index) const
+        {
+            return (inverseBindArray[index]);
+        }
+
+        // The palette holds the result of the most recent call to UpdatePalette().
+
+        const Transform3D* GetPaletteArray(void) const
+        {
+            return (paletteArray);
+        }
+
+        bool Matches(const Skeleton* skeleton) const;
+
+        // Calculates a palette from bone transforms supplied by the caller instead of the referenced transforms.
+
+        void CalculatePalette(const Transform3D* poseArray, Transform3D* result) const;
+
+        void UpdatePalette(void);
+    };
+} // namespace OpenGEX
+
+#endif
@@ -0,0 +1,262 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#include "OpenGEXSkinPack.h"
+
+using namespace OpenGEX;
+
+namespace
+{
+    // Selected influences are kept in slots padded to a multiple of four so that whole vectors can be processed.
+
+    inline int32 GetSlotStride(int32 influenceCount)
+    {
+        return ((influenceCount + 3) & ~3);
+    }
+
+    void NormalizeWeights(float* weight, int32 slotStride)
+    {
+#ifdef TERATHON_SSE
+
+        __m128 sum = _mm_loadu_ps(weight);
+        for (machine k = 4; k < slotStride; k += 4)
+        {
+            sum = _mm_add_ps(sum, _mm_loadu_ps(weight + k));
+        }
+
+        sum = _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(2, 3, 0, 1)));
+        sum = _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 0, 3, 2)));
+
+        __m128 scale = _mm_div_ps(_mm_set1_ps(1.0F), sum);
+        for (machine k = 0; k < slotStride; k += 4)
+        {
+            _mm_storeu_ps(weight + k, _mm_mul_ps(_mm_loadu_ps(weight + k), scale));
+        }
+
+#else
+
+        float sum = 0.0F;
+        for (machine k = 0; k < slotStride; k++)
+        {
+            sum += weight[k];
+        }
+
+        float scale = 1.0F / sum;
+        for (machine k = 0; k < slotStride; k++)
+        {
+            weight[k] *= scale;
+        }
+
+#endif
+    }
+
+    void QuantizeWeights(const float* weight, int32 slotStride, int32 maxValue, int32* result)
+    {
+#ifdef TERATHON_SSE
+
+        __m128 scale = _mm_set1_ps(float(maxValue));
+        for (machine k = 0; k < slotStride; k += 4)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(result + k), _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(weight + k), scale)));
+        }
+
+#else
+
+        for (machine k = 0; k < slotStride; k++)
+        {
+            result[k] = int32(weight[k] * float(maxValue) + 0.5F);
+        }
+
+#endif
+
+        // Rounding can leave the sum slightly off, and the difference goes to the heaviest influence, which is in slot 0.
+
+        int32 sum = 0;
+        for (machine k = 0; k < slotStride; k++)
+        {
+            sum += result[k];
+        }
+
+        result[0] += maxValue - sum;
+    }
+} // namespace
+
+bool OpenGEX::PackSkinInfluences(const uint16* boneCountArray, const uint16* boneIndexArray, const float* boneWeightArray, int32 boneCount, bool compactPaletteFlag, PackedSkinData* packedData,
+                                 ThreadPool* threadPool)
+{
+    int32 vertexCount = packedData->vertexCount;
+    int32 influenceCount = Min(Max(packedData->influenceCount, 1), int32(kSkinMaxInfluenceCount));
+    int32 slotStride = GetSlotStride(influenceCount);
+    packedData->influenceCount = influenceCount;
+
+    int32* offsetArray = new int32[vertexCount];
+    int32  offset = 0;
+    for (machine a = 0; a < vertexCount; a++)
+    {
+        offsetArray[a] = offset;
+        offset += boneCountArray[a];
+    }
+
+    uint16* selectedBoneArray = new uint16[vertexCount * slotStride];
+    float*  selectedWeightArray = new float[vertexCount * slotStride];
+
+    // First, keep the heaviest influences of each vertex in descending order of weight and normalize them.
+
+    ParallelForBlocks(threadPool, vertexCount, kSkinPackBlockSize, [&](int32 begin, int32 end) {
+        for (machine a = begin; a < end; a++)
+        {
+            uint16* bone = selectedBoneArray + a * slotStride;
+            float*  weight = selectedWeightArray + a * slotStride;
+
+            for (machine k = 0; k < slotStride; k++)
+            {
+                bone[k] = 0;
+                weight[k] = 0.0F;
+            }
+
+            int32 selectedCount = 0;
+            int32 start = offsetArray[a];
+            for (machine i = 0; i < boneCountArray[a]; i++)
+            {
+                uint16 b = boneIndexArray[start + i];
+                float  w = boneWeightArray[start + i];
+                if ((b >= boneCount) || (!(w > 0.0F)))
+                {
+                    continue;
+                }
+
+                if (selectedCount < influenceCount)
+                {
+                    selectedCount++;
+                }
+                else if (w <= weight[influenceCount - 1])
+                {
+                    continue;
+                }
+
+                machine k = selectedCount - 1;
+                for (; (k > 0) && (weight[k - 1] < w); k--)
+                {
+                    bone[k] = bone[k - 1];
+                    weight[k] = weight[k - 1];
+                }
+
+                bone[k] = b;
+                weight[k] = w;
+            }
+
+            if (selectedCount == 0)
+            {
+                weight[0] = 1.0F;
+            }
+            else
+            {
+                NormalizeWeights(weight, slotStride);
+            }
+        }
+    });
+
+    delete[] offsetArray;
+
+    // Build the palette from the bones that are actually selected, keeping skeleton order.
+
+    int32* paletteIndexArray = new int32[boneCount + 1];
+    for (machine a = 0; a <= boneCount; a++)
+    {
+        paletteIndexArray[a] = (compactPaletteFlag) ? -1 : int32(a);
+    }
+
+    if (compactPaletteFlag)
+    {
+        for (machine a = 0; a < vertexCount * slotStride; a++)
+        {
+            if (selectedWeightArray[a] > 0.0F)
+            {
+                paletteIndexArray[selectedBoneArray[a]] = 0;
+            }
+        }
+    }
+
+    int32 paletteCount = 0;
+    for (machine a = 0; a < Max(boneCount, 1); a++)
+    {
+        if (paletteIndexArray[a] >= 0)
+        {
+            packedData->paletteArray[paletteCount] = uint16(a);
+            paletteIndexArray[a] = paletteCount++;
+        }
+    }
+
+    packedData->paletteCount = paletteCount;
+
+    if ((packedData->indexSize == 1) && (paletteCount > 256))
+    {
+        delete[] paletteIndexArray;
+        delete[] selectedWeightArray;
+        delete[] selectedBoneArray;
+        return (false);
+    }
+
+    // Finally, write the influences in the requested formats. Unused slots refer to palette entry 0 with weight zero.
+
+    ParallelForBlocks(threadPool, vertexCount, kSkinPackBlockSize, [&](int32 begin, int32 end) {
+        int32   indexSize = packedData->indexSize;
+        int32   weightFormat = packedData->weightFormat;
+        machine elementStride = (packedData->planarFlag) ? vertexCount : 1;
+
+        for (machine a = begin; a < end; a++)
+        {
+            const uint16* bone = selectedBoneArray + a * slotStride;
+            const float*  weight = selectedWeightArray + a * slotStride;
+            machine       element = (packedData->planarFlag) ? a : a * influenceCount;
+
+            for (machine k = 0; k < influenceCount; k++)
+            {
+                int32 paletteIndex = (weight[k] > 0.0F) ? paletteIndexArray[bone[k]] : 0;
+                if (indexSize == 1)
+                {
+                    static_cast<uint8*>(packedData->boneIndexArray)[element + k * elementStride] = uint8(paletteIndex);
+                }
+                else
+                {
+                    static_cast<uint16*>(packedData->boneIndexArray)[element + k * elementStride] = uint16(paletteIndex);
+                }
+            }
+
+            if (weightFormat == kSkinWeightFloat)
+            {
+                for (machine k = 0; k < influenceCount; k++)
+                {
+                    static_cast<float*>(packedData->boneWeightArray)[element + k * elementStride] = weight[k];
+                }
+            }
+            else
+            {
+                int32 quantized[kSkinMaxInfluenceCount];
+                QuantizeWeights(weight, slotStride, (weightFormat == kSkinWeightUnorm8) ? 255 : 65535, quantized);
+
+                for (machine k = 0; k < influenceCount; k++)
+                {
+                    if (weightFormat == kSkinWeightUnorm8)
+                    {
+                        static_cast<uint8*>(packedData->boneWeightArray)[element + k * elementStride] = uint8(quantized[k]);
+                    }
+                    else
+                    {
+                        static_cast<uint16*>(packedData->boneWeightArray)[element + k * elementStride] = uint16(quantized[k]);
+                    }
+                }
+            }
+        }
+    });
+
+    delete[] paletteIndexArray;
+    delete[] selectedWeightArray;
+    delete[] selectedBoneArray;
+    return (true);
+}
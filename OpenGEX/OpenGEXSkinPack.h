@@ -0,0 +1,76 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#ifndef OpenGEXSkinPack_h
+#define OpenGEXSkinPack_h
+
+#include "OpenGEXThreadPool.h"
+#include "TSMath.h"
+
+using namespace Terathon;
+
+namespace OpenGEX
+{
+    enum
+    {
+        kSkinMaxInfluenceCount = 8,
+        kSkinDefaultInfluenceCount = 4,
+        kSkinPackBlockSize = 8192
+    };
+
+    enum
+    {
+        kSkinWeightUnorm8,
+        kSkinWeightUnorm16,
+        kSkinWeightFloat
+    };
+
+    struct SkinPackFormat
+    {
+        int32 influenceCount;     // Influences stored per vertex, at most kSkinMaxInfluenceCount.
+        int32 indexSize;          // Size of a bone index in bytes, 1 or 2.
+        int32 weightFormat;       // One of the kSkinWeight constants.
+        bool  planarFlag;         // Store each influence slot as a separate stream instead of interleaving per vertex.
+        bool  compactPaletteFlag; // Leave bones that no vertex uses out of the palette.
+    };
+
+    // Fixed-width bone influences. In interleaved layout, influence k of vertex v is element v * influenceCount + k
+    // of the index and weight arrays, and in planar layout, it is element k * vertexCount + v. Bone indices refer
+    // to the palette, which holds the skeleton bone index for each entry. Unused slots have weight zero.
+
+    struct PackedSkinData
+    {
+        int32 vertexCount;
+        int32 influenceCount;
+        int32 indexSize;
+        int32 weightFormat;
+        bool  planarFlag;
+
+        int32   paletteCount;
+        uint16* paletteArray;
+        void*   boneIndexArray;
+        void*   boneWeightArray;
+    };
+
+    inline int32 GetSkinWeightSize(int32 weightFormat)
+    {
+        return ((weightFormat == kSkinWeightUnorm8) ? 1 : ((weightFormat == kSkinWeightUnorm16) ? 2 : 4));
+    }
+
+    // Keeps the influenceCount heaviest influences of each vertex, ignoring bones outside the skeleton and weights that
+    // aren't positive, and scales the weights so that they sum to one. Quantized weights are adjusted so that they sum
+    // to exactly the largest unorm value. A vertex with no influences is given full weight on skeleton bone 0.
+    //
+    // The caller sets the format fields of packedData and provides the arrays, with room for Max(boneCount, 1) palette entries.
+    // Returns false if the palette doesn't fit in the index size. Vertices are processed in parallel when a thread pool is given.
+
+    bool PackSkinInfluences(const uint16* boneCountArray, const uint16* boneIndexArray, const float* boneWeightArray, int32 boneCount, bool compactPaletteFlag, PackedSkinData* packedData,
+                            ThreadPool* threadPool);
+} // namespace OpenGEX
+
+#endif
@@ -0,0 +1,625 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#include "OpenGEXSkinning.h"
+
+using namespace OpenGEX;
+
+namespace
+{
+    struct SkinningJob
+    {
+        const Transform3D* paletteArray;
+        int32              paletteCount;
+        const uint16*      boneCountArray;
+        const uint16*      boneIndexArray;
+        const float*       boneWeightArray;
+
+        const SkinningStream* positionStream;
+        const SkinningStream* normalStream;
+        const SkinningStream* tangentStream;
+
+        void SkinBlock(int32 begin, int32 end, int32 influence) const;
+    };
+
+    // Dual quaternion form of a palette entry. Each column of the stretch matrix is padded to four floats.
+
+    struct alignas(16) SkinningBone
+    {
+        float real[4];
+        float dual[4];
+        float stretch[12];
+    };
+
+    struct DualQuaternionJob
+    {
+        const SkinningBone* boneArray;
+        int32               paletteCount;
+        bool                stretchFlag;
+        const uint16*       boneCountArray;
+        const uint16*       boneIndexArray;
+        const float*        boneWeightArray;
+
+        const SkinningStream* positionStream;
+        const SkinningStream* normalStream;
+        const SkinningStream* tangentStream;
+
+        void SkinBlock(int32 begin, int32 end, int32 influence) const;
+    };
+
+    int32* CalculateBlockInfluences(const uint16* boneCountArray, int32 vertexCount)
+    {
+        // Influences are variable-length, so the first influence of each block is found ahead of time.
+
+        int32  blockCount = (vertexCount + kSkinningBlockSize - 1) / kSkinningBlockSize;
+        int32* blockInfluenceArray = new int32[Max(blockCount, 1)];
+
+        int32 influence = 0;
+        for (machine a = 0; a < vertexCount; a++)
+        {
+            if ((a % kSkinningBlockSize) == 0)
+            {
+                blockInfluenceArray[a / kSkinningBlockSize] = influence;
+            }
+
+            influence += boneCountArray[a];
+        }
+
+        return (blockInfluenceArray);
+    }
+
+#ifdef TERATHON_SSE
+
+    inline void StoreVector(__m128 v, float* output)
+    {
+        alignas(16) float lane[4];
+        _mm_store_ps(lane, v);
+        output[0] = lane[0];
+        output[1] = lane[1];
+        output[2] = lane[2];
+    }
+
+    inline __m128 TransformDirection(const __m128* column, const float* v)
+    {
+        __m128 r = _mm_mul_ps(column[0], _mm_set1_ps(v[0]));
+        r = _mm_add_ps(r, _mm_mul_ps(column[1], _mm_set1_ps(v[1])));
+        r = _mm_add_ps(r, _mm_mul_ps(column[2], _mm_set1_ps(v[2])));
+        return (r);
+    }
+
+    inline __m128 NormalizeDirection(__m128 v)
+    {
+        // The fourth lane is zero for directions, so a full horizontal sum gives the squared length.
+
+        __m128 d = _mm_mul_ps(v, v);
+        d = _mm_add_ps(d, _mm_shuffle_ps(d, d, _MM_SHUFFLE(2, 3, 0, 1)));
+        d = _mm_add_ps(d, _mm_shuffle_ps(d, d, _MM_SHUFFLE(1, 0, 3, 2)));
+        return (_mm_div_ps(v, _mm_sqrt_ps(_mm_max_ps(d, _mm_set1_ps(Math::min_float)))));
+    }
+
+    void SkinningJob::SkinBlock(int32 begin, int32 end, int32 influence) const
+    {
+        for (machine a = begin; a < end; a++)
+        {
+            // The blended matrix is accumulated one column at a time. Matrices are stored in column-major order,
+            // so each column of a palette entry is a single aligned load.
+
+            __m128 column[4] = {_mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps()};
+            float  totalWeight = 0.0F;
+
+            int32 count = boneCountArray[a];
+            for (machine k = 0; k < count; k++)
+            {
+                uint32 bone = boneIndexArray[influence + k];
+                if (bone < uint32(paletteCount))
+                {
+                    float        weight = boneWeightArray[influence + k];
+                    const float* m = &paletteArray[bone](0, 0);
+                    __m128       w = _mm_set1_ps(weight);
+
+                    column[0] = _mm_add_ps(column[0], _mm_mul_ps(_mm_load_ps(m), w));
+                    column[1] = _mm_add_ps(column[1], _mm_mul_ps(_mm_load_ps(m + 4), w));
+                    column[2] = _mm_add_ps(column[2], _mm_mul_ps(_mm_load_ps(m + 8), w));
+                    column[3] = _mm_add_ps(column[3], _mm_mul_ps(_mm_load_ps(m + 12), w));
+                    totalWeight += weight;
+                }
+            }
+
+            influence += count;
+
+            if (totalWeight > Math::min_float)
+            {
+                __m128 scale = _mm_set1_ps(1.0F / totalWeight);
+                column[0] = _mm_mul_ps(column[0], scale);
+                column[1] = _mm_mul_ps(column[1], scale);
+                column[2] = _mm_mul_ps(column[2], scale);
+                column[3] = _mm_mul_ps(column[3], scale);
+            }
+            else
+            {
+                column[0] = _mm_setr_ps(1.0F, 0.0F, 0.0F, 0.0F);
+                column[1] = _mm_setr_ps(0.0F, 1.0F, 0.0F, 0.0F);
+                column[2] = _mm_setr_ps(0.0F, 0.0F, 1.0F, 0.0F);
+                column[3] = _mm_setr_ps(0.0F, 0.0F, 0.0F, 1.0F);
+            }
+
+            if (positionStream->inputArray)
+            {
+                const float* p = positionStream->inputArray + a * positionStream->inputStride;
+                StoreVector(_mm_add_ps(TransformDirection(column, p), column[3]), positionStream->outputArray + a * 3);
+            }
+
+            if (normalStream->inputArray)
+            {
+                const float* n = normalStream->inputArray + a * normalStream->inputStride;
+                StoreVector(NormalizeDirection(TransformDirection(column, n)), normalStream->outputArray + a * 3);
+            }
+
+            if (tangentStream->inputArray)
+            {
+                const float* t = tangentStream->inputArray + a * tangentStream->inputStride;
+                StoreVector(NormalizeDirection(TransformDirection(column, t)), tangentStream->outputArray + a * 3);
+            }
+        }
+    }
+
+    inline __m128 CrossVector(__m128 a, __m128 b)
+    {
+        // The w lanes cancel, so the result has a zero w component.
+
+        __m128 ayzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 byzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 c = _mm_sub_ps(_mm_mul_ps(a, byzx), _mm_mul_ps(ayzx, b));
+        return (_mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1)));
+    }
+
+    inline __m128 RotateVector(__m128 real, __m128 rw, __m128 v)
+    {
+        __m128 t = _mm_add_ps(CrossVector(real, v), _mm_mul_ps(rw, v));
+        return (_mm_add_ps(v, _mm_add_ps(CrossVector(real, t), CrossVector(real, t))));
+    }
+
+    inline __m128 LoadVector(const float* v)
+    {
+        return (_mm_setr_ps(v[0], v[1], v[2], 0.0F));
+    }
+
+    void DualQuaternionJob::SkinBlock(int32 begin, int32 end, int32 influence) const
+    {
+        for (machine a = begin; a < end; a++)
+        {
+            __m128 real = _mm_setzero_ps();
+            __m128 dual = _mm_setzero_ps();
+            __m128 column[3] = {_mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps()};
+            float  totalWeight = 0.0F;
+
+            const float* pivot = nullptr;
+
+            int32 count = boneCountArray[a];
+            for (machine k = 0; k < count; k++)
+            {
+                uint32 bone = boneIndexArray[influence + k];
+                if (bone < uint32(paletteCount))
+                {
+                    const SkinningBone& skinningBone = boneArray[bone];
+                    float               weight = boneWeightArray[influence + k];
+
+                    // A rotation and its negation are the same, so each dual quaternion is flipped into the hemisphere of the first one.
+
+                    if (!pivot)
+                    {
+                        pivot = skinningBone.real;
+                    }
+
+                    const float* q = skinningBone.real;
+                    float        signedWeight = (pivot[0] * q[0] + pivot[1] * q[1] + pivot[2] * q[2] + pivot[3] * q[3] < 0.0F) ? -weight : weight;
+
+                    __m128 w = _mm_set1_ps(signedWeight);
+                    real = _mm_add_ps(real, _mm_mul_ps(_mm_load_ps(skinningBone.real), w));
+                    dual = _mm_add_ps(dual, _mm_mul_ps(_mm_load_ps(skinningBone.dual), w));
+
+                    if (stretchFlag)
+                    {
+                        w = _mm_set1_ps(weight);
+                        column[0] = _mm_add_ps(column[0], _mm_mul_ps(_mm_load_ps(skinningBone.stretch), w));
+                        column[1] = _mm_add_ps(column[1], _mm_mul_ps(_mm_load_ps(skinningBone.stretch + 4), w));
+                        column[2] = _mm_add_ps(column[2], _mm_mul_ps(_mm_load_ps(skinningBone.stretch + 8), w));
+                    }
+
+                    totalWeight += weight;
+                }
+            }
+
+            influence += count;
+
+            __m128 d = _mm_mul_ps(real, real);
+            d = _mm_add_ps(d, _mm_shuffle_ps(d, d, _MM_SHUFFLE(2, 3, 0, 1)));
+            d = _mm_add_ps(d, _mm_shuffle_ps(d, d, _MM_SHUFFLE(1, 0, 3, 2)));
+
+            float squaredLength;
+            _mm_store_ss(&squaredLength, d);
+
+            if ((totalWeight <= Math::min_float) || (squaredLength <= Math::min_float))
+            {
+                real = _mm_setr_ps(0.0F, 0.0F, 0.0F, 1.0F);
+                dual = _mm_setzero_ps();
+                column[0] = _mm_setr_ps(1.0F, 0.0F, 0.0F, 0.0F);
+                column[1] = _mm_setr_ps(0.0F, 1.0F, 0.0F, 0.0F);
+                column[2] = _mm_setr_ps(0.0F, 0.0F, 1.0F, 0.0F);
+            }
+            else
+            {
+                __m128 scale = _mm_div_ps(_mm_set1_ps(1.0F), _mm_sqrt_ps(d));
+                real = _mm_mul_ps(real, scale);
+                dual = _mm_mul_ps(dual, scale);
+
+                scale = _mm_set1_ps(1.0F / totalWeight);
+                column[0] = _mm_mul_ps(column[0], scale);
+                column[1] = _mm_mul_ps(column[1], scale);
+                column[2] = _mm_mul_ps(column[2], scale);
+            }
+
+            // The translation is twice the vector part of the dual part times the conjugate of the real part.
+
+            __m128 rw = _mm_shuffle_ps(real, real, _MM_SHUFFLE(3, 3, 3, 3));
+            __m128 dw = _mm_shuffle_ps(dual, dual, _MM_SHUFFLE(3, 3, 3, 3));
+            __m128 translation = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(rw, dual), _mm_mul_ps(dw, real)), CrossVector(real, dual));
+            translation = _mm_add_ps(translation, translation);
+
+            if (positionStream->inputArray)
+            {
+                const float* p = positionStream->inputArray + a * positionStream->inputStride;
+                __m128       v = (stretchFlag) ? TransformDirection(column, p) : LoadVector(p);
+                StoreVector(_mm_add_ps(RotateVector(real, rw, v), translation), positionStream->outputArray + a * 3);
+            }
+
+            if (normalStream->inputArray)
+            {
+                const float* n = normalStream->inputArray + a * normalStream->inputStride;
+                __m128       v = (stretchFlag) ? NormalizeDirection(TransformDirection(column, n)) : LoadVector(n);
+                StoreVector(RotateVector(real, rw, v), normalStream->outputArray + a * 3);
+            }
+
+            if (tangentStream->inputArray)
+            {
+                const float* t = tangentStream->inputArray + a * tangentStream->inputStride;
+                __m128       v = (stretchFlag) ? NormalizeDirection(TransformDirection(column, t)) : LoadVector(t);
+                StoreVector(RotateVector(real, rw, v), tangentStream->outputArray + a * 3);
+            }
+        }
+    }
+
+#else
+
+    inline void TransformDirection(const float* m, const float* v, float* output)
+    {
+        output[0] = m[0] * v[0] + m[4] * v[1] + m[8] * v[2];
+        output[1] = m[1] * v[0] + m[5] * v[1] + m[9] * v[2];
+        output[2] = m[2] * v[0] + m[6] * v[1] + m[10] * v[2];
+    }
+
+    inline void NormalizeDirection(float* v)
+    {
+        float m = v[0] * v[0] + v[1] * v[1] + v[2] * v[2];
+        if (m > Math::min_float)
+        {
+            float s = InverseSqrt(m);
+            v[0] *= s;
+            v[1] *= s;
+            v[2] *= s;
+        }
+    }
+
+    void SkinningJob::SkinBlock(int32 begin, int32 end, int32 influence) const
+    {
+        for (machine a = begin; a < end; a++)
+        {
+            float blend[16] = {};
+            float totalWeight = 0.0F;
+
+            int32 count = boneCountArray[a];
+            for (machine k = 0; k < count; k++)
+            {
+                uint32 bone = boneIndexArray[influence + k];
+                if (bone < uint32(paletteCount))
+                {
+                    float        weight = boneWeightArray[influence + k];
+                    const float* m = &paletteArray[bone](0, 0);
+                    for (machine i = 0; i < 16; i++)
+                    {
+                        blend[i] += m[i] * weight;
+                    }
+
+                    totalWeight += weight;
+                }
+            }
+
+            influence += count;
+
+            if (totalWeight > Math::min_float)
+            {
+                float scale = 1.0F / totalWeight;
+                for (machine i = 0; i < 16; i++)
+                {
+                    blend[i] *= scale;
+                }
+            }
+            else
+            {
+                for (machine i = 0; i < 16; i++)
+                {
+                    blend[i] = ((i % 5) == 0) ? 1.0F : 0.0F;
+                }
+            }
+
+            if (positionStream->inputArray)
+            {
+                float* output = positionStream->outputArray + a * 3;
+                TransformDirection(blend, positionStream->inputArray + a * positionStream->inputStride, output);
+                output[0] += blend[12];
+                output[1] += blend[13];
+                output[2] += blend[14];
+            }
+
+            if (normalStream->inputArray)
+            {
+                float* output = normalStream->outputArray + a * 3;
+                TransformDirection(blend, normalStream->inputArray + a * normalStream->inputStride, output);
+                NormalizeDirection(output);
+            }
+
+            if (tangentStream->inputArray)
+            {
+                float* output = tangentStream->outputArray + a * 3;
+                TransformDirection(blend, tangentStream->inputArray + a * tangentStream->inputStride, output);
+                NormalizeDirection(output);
+            }
+        }
+    }
+
+    inline void CrossVector(const float* a, const float* b, float* output)
+    {
+        output[0] = a[1] * b[2] - a[2] * b[1];
+        output[1] = a[2] * b[0] - a[0] * b[2];
+        output[2] = a[0] * b[1] - a[1] * b[0];
+    }
+
+    inline void RotateVector(const float* real, const float* v, float* output)
+    {
+        float t[3];
+        CrossVector(real, v, t);
+        t[0] += real[3] * v[0];
+        t[1] += real[3] * v[1];
+        t[2] += real[3] * v[2];
+
+        float u[3];
+        CrossVector(real, t, u);
+        output[0] = v[0] + u[0] * 2.0F;
+        output[1] = v[1] + u[1] * 2.0F;
+        output[2] = v[2] + u[2] * 2.0F;
+    }
+
+    void DualQuaternionJob::SkinBlock(int32 begin, int32 end, int32 influence) const
+    {
+        for (machine a = begin; a < end; a++)
+        {
+            float real[4] = {};
+            float dual[4] = {};
+            float stretch[12] = {};
+            float totalWeight = 0.0F;
+
+            const float* pivot = nullptr;
+
+            int32 count = boneCountArray[a];
+            for (machine k = 0; k < count; k++)
+            {
+                uint32 bone = boneIndexArray[influence + k];
+                if (bone < uint32(paletteCount))
+                {
+                    const SkinningBone& skinningBone = boneArray[bone];
+                    float               weight = boneWeightArray[influence + k];
+
+                    // A rotation and its negation are the same, so each dual quaternion is flipped into the hemisphere of the first one.
+
+                    if (!pivot)
+                    {
+                        pivot = skinningBone.real;
+                    }
+
+                    const float* q = skinningBone.real;
+                    float        signedWeight = (pivot[0] * q[0] + pivot[1] * q[1] + pivot[2] * q[2] + pivot[3] * q[3] < 0.0F) ? -weight : weight;
+
+                    for (machine i = 0; i < 4; i++)
+                    {
+                        real[i] += skinningBone.real[i] * signedWeight;
+                        dual[i] += skinningBone.dual[i] * signedWeight;
+                    }
+
+                    if (stretchFlag)
+                    {
+                        for (machine i = 0; i < 12; i++)
+                        {
+                            stretch[i] += skinningBone.stretch[i] * weight;
+                        }
+                    }
+
+                    totalWeight += weight;
+                }
+            }
+
+            influence += count;
+
+            float squaredLength = real[0] * real[0] + real[1] * real[1] + real[2] * real[2] + real[3] * real[3];
+            if ((totalWeight <= Math::min_float) || (squaredLength <= Math::min_float))
+            {
+                for (machine i = 0; i < 4; i++)
+                {
+                    real[i] = (i == 3) ? 1.0F : 0.0F;
+                    dual[i] = 0.0F;
+                }
+
+                for (machine i = 0; i < 12; i++)
+                {
+                    stretch[i] = ((i % 5) == 0) ? 1.0F : 0.0F;
+                }
+            }
+            else
+            {
+                float scale = InverseSqrt(squaredLength);
+                for (machine i = 0; i < 4; i++)
+                {
+                    real[i] *= scale;
+                    dual[i] *= scale;
+                }
+
+                scale = 1.0F / totalWeight;
+                for (machine i = 0; i < 12; i++)
+                {
+                    stretch[i] *= scale;
+                }
+            }
+
+            // The translation is twice the vector part of the dual part times the conjugate of the real part.
+
+            float translation[3];
+            CrossVector(real, dual, translation);
+            for (machine i = 0; i < 3; i++)
+            {
+                translation[i] = (translation[i] + real[3] * dual[i] - dual[3] * real[i]) * 2.0F;
+            }
+
+            const SkinningStream* streamArray[3] = {positionStream, normalStream, tangentStream};
+            for (machine s = 0; s < 3; s++)
+            {
+                const SkinningStream* stream = streamArray[s];
+                if (stream->inputArray)
+                {
+                    const float* input = stream->inputArray + a * stream->inputStride;
+                    float*       output = stream->outputArray + a * 3;
+
+                    float v[3] = {input[0], input[1], input[2]};
+                    if (stretchFlag)
+                    {
+                        // The stretch matrix is stored in the same padded column layout as the palette columns.
+
+                        float m[16] = {stretch[0], stretch[1], stretch[2], stretch[3], stretch[4], stretch[5], stretch[6], stretch[7], stretch[8], stretch[9], stretch[10], stretch[11]};
+                        TransformDirection(m, input, v);
+                        if (s != 0)
+                        {
+                            NormalizeDirection(v);
+                        }
+                    }
+
+                    RotateVector(real, v, output);
+                    if (s == 0)
+                    {
+                        output[0] += translation[0];
+                        output[1] += translation[1];
+                        output[2] += translation[2];
+                    }
+                }
+            }
+        }
+    }
+
+#endif
+} // namespace
+
+void OpenGEX::SkinVertices(const Transform3D* paletteArray, int32 paletteCount, const uint16* boneCountArray, const uint16* boneIndexArray, const float* boneWeightArray,
+                           int32 vertexCount, const SkinningStream& positionStream, const SkinningStream& normalStream, const SkinningStream& tangentStream,
+                           ThreadPool* threadPool)
+{
+    SkinningJob job = {paletteArray, paletteCount, boneCountArray, boneIndexArray, boneWeightArray, &positionStream, &normalStream, &tangentStream};
+    int32*      blockInfluenceArray = CalculateBlockInfluences(boneCountArray, vertexCount);
+
+    ParallelForBlocks(threadPool, vertexCount, kSkinningBlockSize, [&job, blockInfluenceArray](int32 begin, int32 end) {
+        job.SkinBlock(begin, end, blockInfluenceArray[begin / kSkinningBlockSize]);
+    });
+
+    delete[] blockInfluenceArray;
+}
+
+void OpenGEX::CalculateDualQuaternion(const Transform3D& transform, DualQuaternion* result, Matrix3D* stretch)
+{
+    Vector3D x = transform[0].xyz;
+    Vector3D y = transform[1].xyz;
+
+    float mx = SquaredMag(x);
+    x = (mx > Math::min_float) ? x * InverseSqrt(mx) : Vector3D(1.0F, 0.0F, 0.0F);
+    y -= x * Dot(x, y);
+
+    float my = SquaredMag(y);
+    y = (my > Math::min_float) ? y * InverseSqrt(my) : Normalize(Cross(x, (Fabs(x.z) < 0.9F) ? Vector3D(0.0F, 0.0F, 1.0F) : Vector3D(1.0F, 0.0F, 0.0F)));
+
+    // The third axis always makes a proper rotation, and any reflection is left in the stretch matrix.
+
+    Vector3D z = Cross(x, y);
+    Matrix3D rotation(x.x, y.x, z.x, x.y, y.y, z.y, x.z, y.z, z.z);
+
+    Quaternion& real = result->real;
+    real.SetRotationMatrix(rotation);
+
+    const Point3D& t = transform.GetTranslation();
+    result->dual.Set(0.5F * (real.w * t.x + t.y * real.z - t.z * real.y), 0.5F * (real.w * t.y + t.z * real.x - t.x * real.z),
+                     0.5F * (real.w * t.z + t.x * real.y - t.y * real.x), -0.5F * (t.x * real.x + t.y * real.y + t.z * real.z));
+
+    for (machine j = 0; j < 3; j++)
+    {
+        Vector3D column = transform[j].xyz;
+        (*stretch)(0, j) = Dot(x, column);
+        (*stretch)(1, j) = Dot(y, column);
+        (*stretch)(2, j) = Dot(z, column);
+    }
+}
+
+void OpenGEX::SkinVerticesDualQuaternion(const Transform3D* paletteArray, int32 paletteCount, const uint16* boneCountArray, const uint16* boneIndexArray, const float* boneWeightArray,
+                                         int32 vertexCount, const SkinningStream& positionStream, const SkinningStream& normalStream, const SkinningStream& tangentStream,
+                                         ThreadPool* threadPool)
+{
+    SkinningBone* boneArray = new SkinningBone[Max(paletteCount, 1)];
+    bool          stretchFlag = false;
+
+    for (machine a = 0; a < paletteCount; a++)
+    {
+        DualQuaternion dualQuaternion;
+        Matrix3D       stretch;
+        CalculateDualQuaternion(paletteArray[a], &dualQuaternion, &stretch);
+
+        SkinningBone& skinningBone = boneArray[a];
+        skinningBone.real[0] = dualQuaternion.real.x;
+        skinningBone.real[1] = dualQuaternion.real.y;
+        skinningBone.real[2] = dualQuaternion.real.z;
+        skinningBone.real[3] = dualQuaternion.real.w;
+        skinningBone.dual[0] = dualQuaternion.dual.x;
+        skinningBone.dual[1] = dualQuaternion.dual.y;
+        skinningBone.dual[2] = dualQuaternion.dual.z;
+        skinningBone.dual[3] = dualQuaternion.dual.w;
+
+        for (machine j = 0; j < 3; j++)
+        {
+            for (machine i = 0; i < 3; i++)
+            {
+                float m = stretch(i, j);
+                skinningBone.stretch[j * 4 + i] = m;
+                stretchFlag |= (Fabs(m - ((i == j) ? 1.0F : 0.0F)) > 1.0e-5F);
+            }
+
+            skinningBone.stretch[j * 4 + 3] = 0.0F;
+        }
+    }
+
+    DualQuaternionJob job = {boneArray, paletteCount, stretchFlag, boneCountArray, boneIndexArray, boneWeightArray, &positionStream, &normalStream, &tangentStream};
+    int32*            blockInfluenceArray = CalculateBlockInfluences(boneCountArray, vertexCount);
+
+    ParallelForBlocks(threadPool, vertexCount, kSkinningBlockSize, [&job, blockInfluenceArray](int32 begin, int32 end) {
+        job.SkinBlock(begin, end, blockInfluenceArray[begin / kSkinningBlockSize]);
+    });
+
+    delete[] blockInfluenceArray;
+    delete[] boneArray;
+}
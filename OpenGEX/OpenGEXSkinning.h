@@ -0,0 +1,77 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#ifndef OpenGEXSkinning_h
+#define OpenGEXSkinning_h
+
+#include "OpenGEXThreadPool.h"
+#include "TSQuaternion.h"
+
+using namespace Terathon;
+
+namespace OpenGEX
+{
+    enum
+    {
+        kSkinningBlockSize = 2048
+    };
+
+    enum
+    {
+        kSkinningLinearBlend,
+        kSkinningDualQuaternion
+    };
+
+    // One vertex attribute to be skinned. The output array holds three components per vertex, and a stream
+    // with a null input array is skipped.
+
+    struct SkinningStream
+    {
+        const float* inputArray;
+        int32        inputStride;
+        float*       outputArray;
+    };
+
+    // Skins positions, normals, and tangents with linear blend skinning, using the variable-length influences stored
+    // in a skin structure. Each palette entry is the current bone transform times the inverse bind transform times
+    // the skin transform, so the output is in the space of the bone transforms. Influences with bone indices outside
+    // the palette are ignored, and weights are divided by their sum. Vertices without influences are copied.
+    //
+    // Normals and tangents are transformed by the blended matrix without translation and renormalized, which is exact
+    // for bones without nonuniform scale. When a thread pool is given, vertices are split into blocks processed in parallel.
+
+    void SkinVertices(const Transform3D* paletteArray, int32 paletteCount, const uint16* boneCountArray, const uint16* boneIndexArray, const float* boneWeightArray,
+                      int32 vertexCount, const SkinningStream& positionStream, const SkinningStream& normalStream, const SkinningStream& tangentStream,
+                      ThreadPool* threadPool);
+
+    // A unit dual quaternion representing a rigid motion. The real part is the rotation, and the dual part is half
+    // the translation, as a pure quaternion, times the rotation.
+
+    struct DualQuaternion
+    {
+        Quaternion real;
+        Quaternion dual;
+    };
+
+    // Splits a palette transform into a rigid motion and the remaining matrix applied before it, which is the identity
+    // for transforms without scale. The rotation is taken from the orthonormalized columns of the transform.
+
+    void CalculateDualQuaternion(const Transform3D& transform, DualQuaternion* result, Matrix3D* stretch);
+
+    // Skins vertices with dual quaternion skinning, taking the same arguments as SkinVertices. Each palette entry is
+    // converted to a dual quaternion, and the dual quaternions of a vertex are blended after being flipped into the
+    // same hemisphere as the first influence. When any palette entry contains scale, the remaining matrices are
+    // blended linearly and applied first, so scaled bones still work without affecting the volume preservation of
+    // the rotations.
+
+    void SkinVerticesDualQuaternion(const Transform3D* paletteArray, int32 paletteCount, const uint16* boneCountArray, const uint16* boneIndexArray, const float* boneWeightArray,
+                                    int32 vertexCount, const SkinningStream& positionStream, const SkinningStream& normalStream, const SkinningStream& tangentStream,
+                                    ThreadPool* threadPool);
+} // namespace OpenGEX
+
+#endif
@@ -0,0 +1,209 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#include "OpenGEXTangent.h"
+
+using namespace OpenGEX;
+
+namespace
+{
+    enum : uint8
+    {
+        kTriangleValid = 1 << 0,
+        kTriangleOrientationPreserving = 1 << 1
+    };
+
+    struct TriangleTangent
+    {
+        Vector3D direction;
+        uint8    flags;
+    };
+
+    inline Vector3D ReadVector(const float* array, int32 stride, uint32 index)
+    {
+        const float* v = array + index * stride;
+        return (Vector3D(v[0], v[1], v[2]));
+    }
+
+    inline bool NormalizeIfNonzero(Vector3D& v)
+    {
+        float m = SquaredMag(v);
+        if (m > 0.0F)
+        {
+            v *= InverseSqrt(m);
+            return (true);
+        }
+
+        return (false);
+    }
+} // namespace
+
+void OpenGEX::GenerateTangents(const uint32* indexArray, int32 indexCount, const float* positionArray, int32 positionStride, const float* normalArray, int32 normalStride,
+                               const float* texcoordArray, int32 texcoordStride, int32 vertexCount, float* tangentArray, float* bitangentArray, ThreadPool* threadPool)
+{
+    int32 triangleCount = indexCount / 3;
+
+    // First, find the texture-space s direction of each triangle. Its sign is flipped for mirrored
+    // triangles so that it always points along increasing s, and the handedness is kept in the flags.
+
+    TriangleTangent* triangleArray = new TriangleTangent[triangleCount];
+
+    ParallelForBlocks(threadPool, triangleCount, kTangentBlockSize, [&](int32 begin, int32 end) {
+        for (machine a = begin; a < end; a++)
+        {
+            const uint32* triangle = indexArray + a * 3;
+            const float*  t0 = texcoordArray + triangle[0] * texcoordStride;
+            const float*  t1 = texcoordArray + triangle[1] * texcoordStride;
+            const float*  t2 = texcoordArray + triangle[2] * texcoordStride;
+
+            Vector3D p0 = ReadVector(positionArray, positionStride, triangle[0]);
+            Vector3D d1 = ReadVector(positionArray, positionStride, triangle[1]) - p0;
+            Vector3D d2 = ReadVector(positionArray, positionStride, triangle[2]) - p0;
+
+            float s1 = t1[0] - t0[0];
+            float v1 = t1[1] - t0[1];
+            float s2 = t2[0] - t0[0];
+            float v2 = t2[1] - t0[1];
+
+            TriangleTangent& triangleTangent = triangleArray[a];
+            triangleTangent.flags = 0;
+
+            float area = s1 * v2 - s2 * v1;
+            if (Fabs(area) > Math::min_float)
+            {
+                Vector3D direction = d1 * v2 - d2 * v1;
+                if (area > 0.0F)
+                {
+                    triangleTangent.flags = kTriangleOrientationPreserving;
+                }
+                else
+                {
+                    direction = -direction;
+                }
+
+                if (NormalizeIfNonzero(direction))
+                {
+                    triangleTangent.direction = direction;
+                    triangleTangent.flags |= kTriangleValid;
+                }
+            }
+        }
+    });
+
+    // Build a list of the triangle corners that use each vertex so that vertices can be processed independently.
+
+    int32* cornerStart = new int32[vertexCount + 1];
+    int32* cornerArray = new int32[triangleCount * 3];
+
+    for (machine a = 0; a <= vertexCount; a++)
+    {
+        cornerStart[a] = 0;
+    }
+
+    for (machine a = 0; a < triangleCount * 3; a++)
+    {
+        cornerStart[indexArray[a] + 1]++;
+    }
+
+    for (machine a = 0; a < vertexCount; a++)
+    {
+        cornerStart[a + 1] += cornerStart[a];
+    }
+
+    for (machine a = 0; a < triangleCount * 3; a++)
+    {
+        cornerArray[cornerStart[indexArray[a]]++] = int32(a);
+    }
+
+    for (machine a = vertexCount; a > 0; a--)
+    {
+        cornerStart[a] = cornerStart[a - 1];
+    }
+
+    cornerStart[0] = 0;
+
+    ParallelForBlocks(threadPool, vertexCount, kTangentBlockSize, [&](int32 begin, int32 end) {
+        for (machine a = begin; a < end; a++)
+        {
+            Vector3D normal = ReadVector(normalArray, normalStride, uint32(a));
+            if (!NormalizeIfNonzero(normal))
+            {
+                normal.Set(0.0F, 0.0F, 1.0F);
+            }
+
+            Vector3D position = ReadVector(positionArray, positionStride, uint32(a));
+
+            // Contributions are summed separately for each handedness. A vertex shared by mirrored and
+            // unmirrored triangles isn't split, so it takes the side with more weight.
+
+            Vector3D sum[2] = {Vector3D(0.0F, 0.0F, 0.0F), Vector3D(0.0F, 0.0F, 0.0F)};
+            float    weight[2] = {0.0F, 0.0F};
+
+            for (machine k = cornerStart[a]; k < cornerStart[a + 1]; k++)
+            {
+                int32                  corner = cornerArray[k];
+                int32                  triangle = corner / 3;
+                const TriangleTangent& triangleTangent = triangleArray[triangle];
+
+                if (triangleTangent.flags & kTriangleValid)
+                {
+                    Vector3D direction = triangleTangent.direction - normal * Dot(normal, triangleTangent.direction);
+                    NormalizeIfNonzero(direction);
+
+                    const uint32* vertex = indexArray + triangle * 3;
+                    int32         c = corner - triangle * 3;
+
+                    Vector3D e1 = ReadVector(positionArray, positionStride, vertex[(c + 2) % 3]) - position;
+                    Vector3D e2 = ReadVector(positionArray, positionStride, vertex[(c + 1) % 3]) - position;
+                    e1 -= normal * Dot(normal, e1);
+                    e2 -= normal * Dot(normal, e2);
+                    NormalizeIfNonzero(e1);
+                    NormalizeIfNonzero(e2);
+
+                    float angle = Arccos(Clamp(Dot(e1, e2), -1.0F, 1.0F));
+                    int32 side = (triangleTangent.flags & kTriangleOrientationPreserving) ? 1 : 0;
+
+                    sum[side] += direction * angle;
+                    weight[side] += angle;
+                }
+            }
+
+            int32    side = (weight[1] >= weight[0]) ? 1 : 0;
+            Vector3D tangent = sum[side];
+
+            if (!NormalizeIfNonzero(tangent))
+            {
+                // No triangle gives this vertex a texture direction, so any vector perpendicular to the normal is used.
+
+                tangent = (Fabs(normal.x) < 0.5F) ? Vector3D(1.0F, 0.0F, 0.0F) : Vector3D(0.0F, 1.0F, 0.0F);
+                tangent -= normal * Dot(normal, tangent);
+                tangent.Normalize();
+                side = 1;
+            }
+
+            Vector3D bitangent = Cross(normal, tangent);
+            if (side == 0)
+            {
+                bitangent = -bitangent;
+            }
+
+            float* t = tangentArray + a * 3;
+            float* b = bitangentArray + a * 3;
+            t[0] = tangent.x;
+            t[1] = tangent.y;
+            t[2] = tangent.z;
+            b[0] = bitangent.x;
+            b[1] = bitangent.y;
+            b[2] = bitangent.z;
+        }
+    });
+
+    delete[] cornerArray;
+    delete[] cornerStart;
+    delete[] triangleArray;
+}
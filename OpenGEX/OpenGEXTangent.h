@@ -0,0 +1,42 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#ifndef OpenGEXTangent_h
+#define OpenGEXTangent_h
+
+#include "OpenGEXThreadPool.h"
+#include "TSVector3D.h"
+
+using namespace Terathon;
+
+namespace OpenGEX
+{
+    enum
+    {
+        kTangentBlockSize = 4096
+    };
+
+    // Calculates a tangent and bitangent for every vertex of a triangle list. Each triangle contributes its texture-space
+    // direction, projected into the tangent plane of the vertex normal and weighted by the corner angle, and contributions
+    // of opposite handedness are not mixed. The bitangent is the cross product of the normal and tangent, negated where
+    // the texture is mirrored.
+    //
+    // Vertices are never split or merged. A vertex shared by mirrored and unmirrored triangles takes the handedness with
+    // more weight, and separate vertices with the same position, normal, and texcoord are not averaged together. The
+    // results therefore only match tangents baked with MikkTSpace on meshes without shared mirrored seams or duplicated
+    // vertices, which are usually split by the exporter anyway.
+    //
+    // Triangles must be wound counterclockwise when viewed from the side that the normals point to.
+    // The output arrays hold three components per vertex. When a thread pool is given, meshes larger
+    // than kTangentBlockSize triangles or vertices are split into blocks that are processed in parallel.
+
+    void GenerateTangents(const uint32* indexArray, int32 indexCount, const float* positionArray, int32 positionStride, const float* normalArray, int32 normalStride,
+                          const float* texcoordArray, int32 texcoordStride, int32 vertexCount, float* tangentArray, float* bitangentArray, ThreadPool* threadPool);
+} // namespace OpenGEX
+
+#endif
@@ -0,0 +1,174 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#include "OpenGEXThreadPool.h"
+#include "OpenGEXProfile.h"
+
+#include <atomic>
+#include <memory>
+
+using namespace OpenGEX;
+
+namespace
+{
+    struct ParallelForState
+    {
+        std::atomic<int32>      nextIndex;
+        std::atomic<int32>      finishedCount;
+        int32                   count;
+        std::mutex              finishMutex;
+        std::condition_variable finishCondition;
+
+        const std::function<void(int32)>* func;
+
+        void Run(void)
+        {
+            int32 completed = 0;
+            for (;;)
+            {
+                int32 index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+                if (index >= count)
+                {
+                    break;
+                }
+
+                (*func)(index);
+                completed++;
+            }
+
+            if ((completed != 0) && (finishedCount.fetch_add(completed, std::memory_order_acq_rel) + completed == count))
+            {
+                std::lock_guard<std::mutex> lock(finishMutex);
+                finishCondition.notify_all();
+            }
+        }
+    };
+} // namespace
+
+ThreadPool::ThreadPool(int32 threadCount)
+{
+    exitFlag = false;
+
+    if (threadCount <= 0)
+    {
+        threadCount = Max(int32(std::thread::hardware_concurrency()) - 1, 1);
+    }
+
+    threadArray.reserve(threadCount);
+    for (machine a = 0; a < threadCount; a++)
+    {
+        threadArray.emplace_back(&ThreadPool::WorkerThread, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        exitFlag = true;
+    }
+
+    queueCondition.notify_all();
+
+    for (std::thread& thread : threadArray)
+    {
+        thread.join();
+    }
+}
+
+void ThreadPool::WorkerThread(void)
+{
+    SetProfileThreadName("OpenGEX Worker");
+
+    for (;;)
+    {
+        std::function<void()> job;
+
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueCondition.wait(lock, [this] { return ((exitFlag) || (!jobQueue.empty())); });
+
+            if (jobQueue.empty())
+            {
+                return;
+            }
+
+            job = std::move(jobQueue.front());
+            jobQueue.pop_front();
+        }
+
+        job();
+    }
+}
+
+void ThreadPool::SubmitJob(std::function<void()> job)
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        jobQueue.push_back(std::move(job));
+    }
+
+    queueCondition.notify_one();
+}
+
+void ThreadPool::ParallelFor(int32 count, const std::function<void(int32)>& func)
+{
+    if (count <= 0)
+    {
+        return;
+    }
+
+    if ((count == 1) || (threadArray.empty()))
+    {
+        for (machine a = 0; a < count; a++)
+        {
+            func(int32(a));
+        }
+
+        return;
+    }
+
+    // The state is shared with the helper jobs because a helper can start after the
+    // calling thread has already finished all of the work and returned.
+
+    std::shared_ptr<ParallelForState> state = std::make_shared<ParallelForState>();
+    state->nextIndex.store(0, std::memory_order_relaxed);
+    state->finishedCount.store(0, std::memory_order_relaxed);
+    state->count = count;
+    state->func = &func;
+
+    int32 helperCount = Min(GetThreadCount(), count - 1);
+    for (machine a = 0; a < helperCount; a++)
+    {
+        SubmitJob([state] { state->Run(); });
+    }
+
+    state->Run();
+
+    std::unique_lock<std::mutex> lock(state->finishMutex);
+    state->finishCondition.wait(lock, [&state] { return (state->finishedCount.load(std::memory_order_acquire) == state->count); });
+}
+
+void OpenGEX::ParallelForBlocks(ThreadPool* threadPool, int32 count, int32 blockSize, const std::function<void(int32, int32)>& func)
+{
+    int32 blockCount = (count + blockSize - 1) / blockSize;
+    if ((!threadPool) || (blockCount <= 1))
+    {
+        if (count > 0)
+        {
+            func(0, count);
+        }
+
+        return;
+    }
+
+    threadPool->ParallelFor(blockCount, [count, blockSize, &func](int32 block) {
+        int32 begin = block * blockSize;
+        func(begin, Min(begin + blockSize, count));
+    });
+}
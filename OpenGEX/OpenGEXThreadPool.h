@@ -0,0 +1,67 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#ifndef OpenGEXThreadPool_h
+#define OpenGEXThreadPool_h
+
+#include "TSPlatform.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace Terathon;
+
+namespace OpenGEX
+{
+    // A fixed set of worker threads that execute queued jobs. A single pool can be shared by
+    // any number of data descriptions, and it is safe to submit work from inside a job.
+
+    class ThreadPool
+    {
+    private:
+        std::vector<std::thread>          threadArray;
+        std::deque<std::function<void()>> jobQueue;
+        std::mutex                        queueMutex;
+        std::condition_variable           queueCondition;
+        bool                              exitFlag;
+
+        void WorkerThread(void);
+
+    public:
+        // A thread count of zero creates one worker per hardware thread, minus the calling thread.
+
+        explicit ThreadPool(int32 threadCount = 0);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        int32 GetThreadCount(void) const
+        {
+            return (int32(threadArray.size()));
+        }
+
+        void SubmitJob(std::function<void()> job);
+
+        // Calls func(i) for every i in [0, count) and returns when all calls have finished.
+        // The calling thread takes part in the work, so nested calls cannot deadlock.
+
+        void ParallelFor(int32 count, const std::function<void(int32)>& func);
+    };
+
+    // Splits [0, count) into ranges of blockSize elements and calls func(begin, end) for each range,
+    // in parallel when a thread pool is given and there is more than one range.
+
+    void ParallelForBlocks(ThreadPool* threadPool, int32 count, int32 blockSize, const std::function<void(int32, int32)>& func);
+} // namespace OpenGEX
+
+#endif
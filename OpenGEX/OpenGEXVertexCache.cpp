@@ -0,0 +1,319 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#include "OpenGEXVertexCache.h"
+
+using namespace OpenGEX;
+
+namespace
+{
+    // Scoring constants from Tom Forsyth, "Linear-Speed Vertex Cache Optimisation".
+
+    const float kCacheDecayPower = 1.5F;
+    const float kLastTriangleScore = 0.75F;
+    const float kValenceBoostScale = 2.0F;
+    const float kValenceBoostPower = 0.5F;
+
+    const int32 kValenceTableSize = 32;
+
+    struct ScoreTable
+    {
+        float cacheScore[kVertexCacheMaxSize];
+        float valenceScore[kValenceTableSize];
+
+        // The cache score decays over the simulated cache size, which is at least kVertexCacheMinSize and at most kVertexCacheMaxSize.
+
+        explicit ScoreTable(int32 cacheSize)
+        {
+            for (machine a = 0; a < 3; a++)
+            {
+                cacheScore[a] = kLastTriangleScore;
+            }
+
+            float scale = 1.0F / float(cacheSize - 3);
+            for (machine a = 3; a < kVertexCacheMaxSize; a++)
+            {
+                cacheScore[a] = (a < cacheSize) ? Pow(1.0F - float(a - 3) * scale, kCacheDecayPower) : 0.0F;
+            }
+
+            valenceScore[0] = 0.0F;
+            for (machine a = 1; a < kValenceTableSize; a++)
+            {
+                valenceScore[a] = kValenceBoostScale * Pow(float(a), -kValenceBoostPower);
+            }
+        }
+
+        float CalculateVertexScore(int32 cachePosition, int32 remainingValence) const
+        {
+            if (remainingValence == 0)
+            {
+                // No triangles use this vertex anymore.
+                return (-1.0F);
+            }
+
+            float score = (cachePosition >= 0) ? cacheScore[cachePosition] : 0.0F;
+
+            if (remainingValence < kValenceTableSize)
+            {
+                return (score + valenceScore[remainingValence]);
+            }
+
+            return (score + kValenceBoostScale * Pow(float(remainingValence), -kValenceBoostPower));
+        }
+    };
+} // namespace
+
+void OpenGEX::AnalyzeVertexCache(const uint32* indexArray, int32 triangleCount, int32 vertexCount, int32 cacheSize, VertexCacheStatistics* statistics)
+{
+    statistics->acmr = 0.0F;
+    statistics->atvr = 0.0F;
+
+    if ((triangleCount == 0) || (vertexCount == 0))
+    {
+        return;
+    }
+
+    // A vertex is resident in the FIFO if fewer than cacheSize misses have occurred since it was loaded.
+
+    uint32* timestamp = new uint32[vertexCount];
+    for (machine a = 0; a < vertexCount; a++)
+    {
+        timestamp[a] = 0;
+    }
+
+    uint32 time = cacheSize + 1;
+    int32  missCount = 0;
+
+    int32 indexCount = triangleCount * 3;
+    for (machine a = 0; a < indexCount; a++)
+    {
+        uint32 index = indexArray[a];
+        if (time - timestamp[index] > uint32(cacheSize))
+        {
+            timestamp[index] = time++;
+            missCount++;
+        }
+    }
+
+    int32 referencedCount = 0;
+    for (machine a = 0; a < vertexCount; a++)
+    {
+        referencedCount += (timestamp[a] != 0);
+    }
+
+    delete[] timestamp;
+
+    statistics->acmr = float(missCount) / float(triangleCount);
+    statistics->atvr = float(missCount) / float(Max(referencedCount, 1));
+}
+
+void OpenGEX::OptimizeTriangleOrder(const uint32* indexArray, int32 triangleCount, int32 vertexCount, int32 cacheSize, uint32* outputArray)
+{
+    if (triangleCount == 0)
+    {
+        return;
+    }
+
+    cacheSize = Min(Max(cacheSize, int32(kVertexCacheMinSize)), int32(kVertexCacheMaxSize));
+    const ScoreTable scoreTable(cacheSize);
+
+    int32 indexCount = triangleCount * 3;
+
+    // Build the vertex-to-triangle adjacency. The triangle count of each vertex doubles as its remaining valence,
+    // and emitted triangles are removed from the adjacency lists as the algorithm proceeds.
+
+    int32* valenceArray = new int32[vertexCount];
+    int32* offsetArray = new int32[vertexCount];
+    int32* adjacencyArray = new int32[indexCount];
+
+    for (machine a = 0; a < vertexCount; a++)
+    {
+        valenceArray[a] = 0;
+    }
+
+    for (machine a = 0; a < indexCount; a++)
+    {
+        valenceArray[indexArray[a]]++;
+    }
+
+    int32 offset = 0;
+    for (machine a = 0; a < vertexCount; a++)
+    {
+        offsetArray[a] = offset;
+        offset += valenceArray[a];
+        valenceArray[a] = 0;
+    }
+
+    for (machine a = 0; a < triangleCount; a++)
+    {
+        for (machine k = 0; k < 3; k++)
+        {
+            uint32 index = indexArray[a * 3 + k];
+            adjacencyArray[offsetArray[index] + valenceArray[index]++] = int32(a);
+        }
+    }
+
+    float* vertexScore = new float[vertexCount];
+    bool*  emittedFlag = new bool[triangleCount];
+
+    for (machine a = 0; a < vertexCount; a++)
+    {
+        vertexScore[a] = scoreTable.CalculateVertexScore(-1, valenceArray[a]);
+    }
+
+    for (machine a = 0; a < triangleCount; a++)
+    {
+        emittedFlag[a] = false;
+    }
+
+    uint32 cache[kVertexCacheMaxSize + 3];
+    uint32 newCache[kVertexCacheMaxSize + 3];
+    int32  cacheCount = 0;
+
+    int32 bestTriangle = -1;
+    int32 scanCursor = 0;
+
+    for (machine output = 0; output < triangleCount; output++)
+    {
+        if (bestTriangle < 0)
+        {
+            // Nothing adjacent to the cache is left, so restart with the next unemitted triangle.
+
+            while (emittedFlag[scanCursor])
+            {
+                scanCursor++;
+            }
+
+            bestTriangle = scanCursor;
+        }
+
+        const uint32* triangle = indexArray + bestTriangle * 3;
+        emittedFlag[bestTriangle] = true;
+
+        outputArray[output * 3] = triangle[0];
+        outputArray[output * 3 + 1] = triangle[1];
+        outputArray[output * 3 + 2] = triangle[2];
+
+        int32 newCount = 0;
+        for (machine k = 0; k < 3; k++)
+        {
+            uint32 index = triangle[k];
+
+            int32* adjacency = adjacencyArray + offsetArray[index];
+            int32  count = valenceArray[index];
+            for (machine j = 0; j < count; j++)
+            {
+                if (adjacency[j] == bestTriangle)
+                {
+                    adjacency[j] = adjacency[count - 1];
+                    valenceArray[index] = count - 1;
+                    break;
+                }
+            }
+
+            // Degenerate triangles can reference the same vertex more than once.
+
+            bool duplicateFlag = false;
+            for (machine j = 0; j < newCount; j++)
+            {
+                duplicateFlag |= (newCache[j] == index);
+            }
+
+            if (!duplicateFlag)
+            {
+                newCache[newCount++] = index;
+            }
+        }
+
+        for (machine a = 0; a < cacheCount; a++)
+        {
+            uint32 index = cache[a];
+            if ((index != triangle[0]) && (index != triangle[1]) && (index != triangle[2]))
+            {
+                newCache[newCount++] = index;
+            }
+        }
+
+        for (machine a = 0; a < newCount; a++)
+        {
+            uint32 index = newCache[a];
+            int32  position = (a < cacheSize) ? int32(a) : -1;
+            vertexScore[index] = scoreTable.CalculateVertexScore(position, valenceArray[index]);
+        }
+
+        cacheCount = Min(newCount, cacheSize);
+        for (machine a = 0; a < cacheCount; a++)
+        {
+            cache[a] = newCache[a];
+        }
+
+        // Only triangles touching a vertex whose score changed can have a new score, so the best
+        // candidate is always found among them.
+
+        float bestScore = -1.0F;
+        bestTriangle = -1;
+
+        for (machine a = 0; a < newCount; a++)
+        {
+            uint32       index = newCache[a];
+            const int32* adjacency = adjacencyArray + offsetArray[index];
+            int32        count = valenceArray[index];
+
+            for (machine j = 0; j < count; j++)
+            {
+                int32         t = adjacency[j];
+                const uint32* k = indexArray + t * 3;
+
+                float score = vertexScore[k[0]] + vertexScore[k[1]] + vertexScore[k[2]];
+                if (score > bestScore)
+                {
+                    bestScore = score;
+                    bestTriangle = t;
+                }
+            }
+        }
+    }
+
+    delete[] emittedFlag;
+    delete[] vertexScore;
+    delete[] adjacencyArray;
+    delete[] offsetArray;
+    delete[] valenceArray;
+}
+
+void OpenGEX::OptimizeVertexOrder(uint32* indexArray, int32 indexCount, int32 vertexCount, uint32* vertexMap)
+{
+    uint32* remapTable = new uint32[vertexCount];
+    for (machine a = 0; a < vertexCount; a++)
+    {
+        remapTable[a] = 0xFFFFFFFF;
+    }
+
+    uint32 nextIndex = 0;
+    for (machine a = 0; a < indexCount; a++)
+    {
+        uint32 index = indexArray[a];
+        if (remapTable[index] == 0xFFFFFFFF)
+        {
+            remapTable[index] = nextIndex;
+            vertexMap[nextIndex++] = index;
+        }
+
+        indexArray[a] = remapTable[index];
+    }
+
+    for (machine a = 0; a < vertexCount; a++)
+    {
+        if (remapTable[a] == 0xFFFFFFFF)
+        {
+            vertexMap[nextIndex++] = uint32(a);
+        }
+    }
+
+    delete[] remapTable;
+}
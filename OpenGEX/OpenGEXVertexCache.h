@@ -0,0 +1,46 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#ifndef OpenGEXVertexCache_h
+#define OpenGEXVertexCache_h
+
+#include "TSMath.h"
+
+using namespace Terathon;
+
+namespace OpenGEX
+{
+    enum
+    {
+        kVertexCacheMinSize = 4,
+        kVertexCacheDefaultSize = 16,
+        kVertexCacheMaxSize = 32
+    };
+
+    struct VertexCacheStatistics
+    {
+        float acmr; // Average cache miss ratio, in transformed vertices per triangle.
+        float atvr; // Average transform to vertex ratio, in transformed vertices per referenced vertex.
+    };
+
+    // Simulates a FIFO post-transform cache of the given size over a triangle list.
+
+    void AnalyzeVertexCache(const uint32* indexArray, int32 triangleCount, int32 vertexCount, int32 cacheSize, VertexCacheStatistics* statistics);
+
+    // Reorders the triangles in indexArray using Forsyth's linear-speed vertex cache optimization, scoring vertices
+    // for a cache of the given size, which is clamped to [kVertexCacheMinSize, kVertexCacheMaxSize]. The input and output arrays must not overlap.
+
+    void OptimizeTriangleOrder(const uint32* indexArray, int32 triangleCount, int32 vertexCount, int32 cacheSize, uint32* outputArray);
+
+    // Renumbers vertices in the order that they are first referenced by the index array, which is rewritten
+    // in place. Unreferenced vertices are moved to the end. On return, vertexMap[newIndex] holds the old index.
+
+    void OptimizeVertexOrder(uint32* indexArray, int32 indexCount, int32 vertexCount, uint32* vertexMap);
+} // namespace OpenGEX
+
+#endif
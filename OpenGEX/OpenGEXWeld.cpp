@@ -0,0 +1,153 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#include "OpenGEXWeld.h"
+#include "TSMath.h"
+
+using namespace OpenGEX;
+
+namespace
+{
+    const uint32 kEmptySlot = 0xFFFFFFFF;
+
+    struct WeldKey
+    {
+        const WeldAttribute* attributeArray;
+        const float*         inverseEpsilonArray;
+        int32                attributeCount;
+
+        static int64 QuantizeComponent(float x, float inverseEpsilon)
+        {
+            if (inverseEpsilon == 0.0F)
+            {
+                // Positive and negative zero are treated as the same value.
+
+                return ((x == 0.0F) ? 0 : int64(reinterpret_cast<const uint32&>(x)));
+            }
+
+            // Values are rounded to the nearest multiple of epsilon so that values lying on or very near a
+            // multiple, which is common in authored data, don't straddle the boundary between two cells.
+
+            return (int64(Floor(x * inverseEpsilon + 0.5F)));
+        }
+
+        uint32 CalculateHash(uint32 vertex) const
+        {
+            uint64 hash = 0xCBF29CE484222325ULL;
+
+            for (machine a = 0; a < attributeCount; a++)
+            {
+                const WeldAttribute& attribute = attributeArray[a];
+                const float*         v = attribute.vertexArray + vertex * attribute.componentCount;
+                float                inverseEpsilon = inverseEpsilonArray[a];
+
+                for (machine k = 0; k < attribute.componentCount; k++)
+                {
+                    hash = (hash ^ uint64(QuantizeComponent(v[k], inverseEpsilon))) * 0x100000001B3ULL;
+                }
+            }
+
+            hash ^= hash >> 33;
+            hash *= 0xFF51AFD7ED558CCDULL;
+            hash ^= hash >> 33;
+            return (uint32(hash));
+        }
+
+        bool Equal(uint32 vertex1, uint32 vertex2) const
+        {
+            for (machine a = 0; a < attributeCount; a++)
+            {
+                const WeldAttribute& attribute = attributeArray[a];
+                const float*         v1 = attribute.vertexArray + vertex1 * attribute.componentCount;
+                const float*         v2 = attribute.vertexArray + vertex2 * attribute.componentCount;
+                float                inverseEpsilon = inverseEpsilonArray[a];
+
+                for (machine k = 0; k < attribute.componentCount; k++)
+                {
+                    if (QuantizeComponent(v1[k], inverseEpsilon) != QuantizeComponent(v2[k], inverseEpsilon))
+                    {
+                        return (false);
+                    }
+                }
+            }
+
+            return (true);
+        }
+    };
+} // namespace
+
+int32 OpenGEX::WeldVertices(const WeldAttribute* attributeArray, int32 attributeCount, int32 vertexCount, uint32* remapArray, uint32* vertexMap, ThreadPool* threadPool)
+{
+    float* inverseEpsilonArray = new float[attributeCount];
+    for (machine a = 0; a < attributeCount; a++)
+    {
+        float epsilon = attributeArray[a].epsilon;
+        inverseEpsilonArray[a] = (epsilon > 0.0F) ? 1.0F / epsilon : 0.0F;
+    }
+
+    WeldKey key = {attributeArray, inverseEpsilonArray, attributeCount};
+
+    // Hashing reads every component of every vertex, so it is the expensive part and runs in parallel.
+
+    uint32* hashArray = new uint32[vertexCount];
+    ParallelForBlocks(threadPool, vertexCount, kWeldBlockSize, [&key, hashArray](int32 begin, int32 end) {
+        for (machine a = begin; a < end; a++)
+        {
+            hashArray[a] = key.CalculateHash(uint32(a));
+        }
+    });
+
+    // Vertices are inserted in order into an open-addressing table with linear probing,
+    // which keeps the numbering deterministic. The table is at most half full.
+
+    uint32 tableSize = 16;
+    while (tableSize < uint32(vertexCount) * 2)
+    {
+        tableSize <<= 1;
+    }
+
+    uint32  tableMask = tableSize - 1;
+    uint32* tableArray = new uint32[tableSize];
+    for (machine a = 0; a < tableSize; a++)
+    {
+        tableArray[a] = kEmptySlot;
+    }
+
+    int32 uniqueCount = 0;
+    for (machine a = 0; a < vertexCount; a++)
+    {
+        uint32 hash = hashArray[a];
+        uint32 slot = hash & tableMask;
+
+        for (;;)
+        {
+            uint32 vertex = tableArray[slot];
+            if (vertex == kEmptySlot)
+            {
+                tableArray[slot] = uint32(a);
+                vertexMap[uniqueCount] = uint32(a);
+                remapArray[a] = uniqueCount++;
+                break;
+            }
+
+            if ((hashArray[vertex] == hash) && (key.Equal(vertex, uint32(a))))
+            {
+                remapArray[a] = remapArray[vertex];
+                break;
+            }
+
+            slot = (slot + 1) & tableMask;
+        }
+    }
+
+    delete[] tableArray;
+    delete[] hashArray;
+    delete[] inverseEpsilonArray;
+
+    return (uniqueCount);
+}
@@ -0,0 +1,49 @@
+//
+// This file is part of the Terathon OpenGEX Import Template, by Eric Lengyel.
+// Copyright 2013-2022, Terathon Software LLC
+//
+// This software is distributed under the MIT License.
+// Separate proprietary licenses are available from Terathon Software.
+//
+
+#ifndef OpenGEXWeld_h
+#define OpenGEXWeld_h
+
+#include "OpenGEXThreadPool.h"
+
+using namespace Terathon;
+
+namespace OpenGEX
+{
+    enum
+    {
+        kWeldBlockSize = 8192
+    };
+
+    struct WeldAttribute
+    {
+        const float* vertexArray;
+        int32        componentCount;
+        float        epsilon; // Zero for exact matching.
+    };
+
+    struct WeldStatistics
+    {
+        int32 originalVertexCount;
+        int32 weldedVertexCount;
+        float weldTime; // In milliseconds.
+    };
+
+    // Finds vertices whose attributes all match and gives each group a single new index, numbered in order
+    // of first occurrence. Components of an attribute with a nonzero epsilon are snapped to cells of that
+    // size centered on multiples of epsilon, and they match when they fall in the same cell. Components of
+    // other attributes must be exactly equal.
+    //
+    // On return, remapArray[oldIndex] holds the new index, and vertexMap[newIndex] holds the first old
+    // index in each group. The return value is the number of unique vertices. Hash values are calculated
+    // in parallel when a thread pool is given.
+
+    int32 WeldVertices(const WeldAttribute* attributeArray, int32 attributeCount, int32 vertexCount, uint32* remapArray, uint32* vertexMap, ThreadPool* threadPool);
+} // namespace OpenGEX
+
+#endif
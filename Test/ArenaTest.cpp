@@ -0,0 +1,155 @@
+#include "OpenGEX.h"
+#include "OpenGEXGenerator.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace OpenGEX;
+
+namespace
+{
+    enum
+    {
+        kTestAlignment = 64
+    };
+
+    // Checks that every vertex array of the scene was copied to the arena at an aligned offset.
+
+    bool CheckData(const CompactScene& scene, const GeometryArena& arena, const char* data)
+    {
+        int32 arrayCount = 0;
+
+        for (machine object = 0; object < scene.GetGeometryObjectCount(); object++)
+        {
+            const SceneGeometryObject& geometryObject = scene.GetGeometryObject(int32(object));
+            for (machine m = 0; m < geometryObject.meshCount; m++)
+            {
+                const SceneMesh& mesh = geometryObject.meshArray[m];
+                for (machine a = 0; a < mesh.vertexArrayCount; a++)
+                {
+                    const SceneVertexArray&   vertexArray = mesh.vertexArray[a];
+                    const GeometryArenaEntry* entry = arena.FindEntry(uint32(object), mesh.meshLevel, kGeometryArrayVertex, vertexArray.attrib, vertexArray.attribIndex, vertexArray.morphIndex);
+                    if (!entry)
+                    {
+                        fprintf(stderr, "Object %d has no entry for its %s array\n", int32(object), vertexArray.attrib);
+                        return (false);
+                    }
+
+                    uint64 size = uint64(vertexArray.vertexCount) * vertexArray.componentCount * sizeof(float);
+                    if ((entry->offset % kTestAlignment != 0) || (entry->size != size) || (memcmp(data + entry->offset, vertexArray.vertexArray, size) != 0))
+                    {
+                        fprintf(stderr, "The %s array of object %d wasn't copied correctly\n", vertexArray.attrib, int32(object));
+                        return (false);
+                    }
+
+                    arrayCount++;
+                }
+            }
+        }
+
+        if (arrayCount == 0)
+        {
+            fprintf(stderr, "The scene has no vertex arrays\n");
+            return (false);
+        }
+
+        return (true);
+    }
+
+    bool CheckTable(const GeometryArena& arena, const GeometryArena& readArena)
+    {
+        if ((readArena.GetAlignment() != arena.GetAlignment()) || (readArena.GetDataSize() != arena.GetDataSize()) || (readArena.GetEntryCount() != arena.GetEntryCount()))
+        {
+            fprintf(stderr, "The table read back doesn't match the arena\n");
+            return (false);
+        }
+
+        for (machine a = 0; a < arena.GetEntryCount(); a++)
+        {
+            if ((memcmp(&arena.GetEntry(int32(a)), &readArena.GetEntry(int32(a)), sizeof(GeometryArenaEntry)) != 0) ||
+                (strcmp(arena.GetEntryName(int32(a)), readArena.GetEntryName(int32(a))) != 0))
+            {
+                fprintf(stderr, "Entry %d doesn't match after reading the table\n", int32(a));
+                return (false);
+            }
+        }
+
+        return (true);
+    }
+} // namespace
+
+int main(void)
+{
+    GeneratorParams params;
+    InitGeneratorParams(&params);
+    params.nodeCount = 4;
+    params.hierarchyDepth = 2;
+    params.meshCount = 3;
+    params.vertexCount = 100;
+    params.lodCount = 1;
+    params.boneCount = 4;
+
+    std::string text;
+    GenerateScene(params, &text);
+
+    OpenGexDataDescription description;
+    description.SetProcessFlags(kProcessPackSkinInfluences);
+
+    DataResult result = description.ProcessText(text.c_str());
+    if (result != kDataOkay)
+    {
+        fprintf(stderr, "ProcessText failed: %s\n", OpenGEX::DataResultToString(result).c_str());
+        return (1);
+    }
+
+    CompactScene  scene(&description);
+    GeometryArena arena(kTestAlignment);
+    arena.AddScene(&scene);
+
+    std::vector<char> data(arena.GetDataSize());
+    if ((!arena.WriteData(data.data())) || (!CheckData(scene, arena, data.data())))
+    {
+        return (1);
+    }
+
+    std::string table;
+    arena.WriteTable(&table);
+
+    GeometryArena readArena;
+    if ((!readArena.ReadTable(table.data(), machine(table.size()))) || (!CheckTable(arena, readArena)))
+    {
+        fprintf(stderr, "The table couldn't be read back\n");
+        return (1);
+    }
+
+    // A table read back no longer knows where the data comes from.
+
+    if (readArena.WriteData(data.data()))
+    {
+        fprintf(stderr, "WriteData succeeded without sources\n");
+        return (1);
+    }
+
+    // Truncated tables and tables with a zero alignment are rejected.
+
+    GeometryArena badArena;
+    if (badArena.ReadTable(table.data(), machine(table.size() - 1)))
+    {
+        fprintf(stderr, "A truncated table was accepted\n");
+        return (1);
+    }
+
+    std::string zeroTable = table;
+    uint64      zeroAlignment = 0;
+    memcpy(zeroTable.data() + 16, &zeroAlignment, sizeof(uint64));
+    if (badArena.ReadTable(zeroTable.data(), machine(zeroTable.size())))
+    {
+        fprintf(stderr, "A table with a zero alignment was accepted\n");
+        return (1);
+    }
+
+    printf("Arena round trip passed with %d entries\n", arena.GetEntryCount());
+    return (0);
+}
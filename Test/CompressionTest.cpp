@@ -0,0 +1,189 @@
+#include "OpenGEX.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#ifdef OPENGEX_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef OPENGEX_ZSTD
+#include <zstd.h>
+#endif
+
+using namespace OpenGEX;
+
+namespace
+{
+    // Letters from a linear congruential generator don't compress much, so stored gzip blocks have predictable sizes.
+
+    std::string GenerateText(uint64 size, uint32 seed)
+    {
+        std::string text(size, 0);
+        for (machine a = 0; a < machine(size); a++)
+        {
+            seed = seed * 1664525 + 1013904223;
+            text[a] = char('a' + (seed >> 24) % 26);
+        }
+
+        return (text);
+    }
+
+    bool CheckText(const char* testName, DataResult result, char* text, uint64 size, const std::string& expected)
+    {
+        bool success = ((result == kDataOkay) && (size == expected.size()) && (memcmp(text, expected.data(), size) == 0) && (text[size] == 0));
+        if (!success)
+        {
+            fprintf(stderr, "%s failed: %s, %llu bytes instead of %llu\n", testName, OpenGEX::DataResultToString(result).c_str(), (unsigned long long) size, (unsigned long long) expected.size());
+        }
+
+        if (result == kDataOkay)
+        {
+            delete[] text;
+        }
+
+        return (success);
+    }
+
+    bool CheckData(const char* testName, const std::string& data, const std::string& expected)
+    {
+        char*      text = nullptr;
+        uint64     size = 0;
+        DataResult result = DecompressText(data.data(), data.size(), &text, &size);
+        return (CheckText(testName, result, text, size, expected));
+    }
+
+    bool CheckFile(const char* testName, const std::string& data, const std::string& expected)
+    {
+        const char* fileName = "CompressionTest.tmp";
+
+        FILE* file = fopen(fileName, "wb");
+        if ((!file) || (fwrite(data.data(), 1, data.size(), file) != data.size()))
+        {
+            fprintf(stderr, "Unable to write %s\n", fileName);
+            if (file)
+            {
+                fclose(file);
+            }
+
+            return (false);
+        }
+
+        fclose(file);
+
+        char*      text = nullptr;
+        uint64     size = 0;
+        DataResult result = LoadTextFile(fileName, &text, &size);
+        remove(fileName);
+
+        return (CheckText(testName, result, text, size, expected));
+    }
+
+#ifdef OPENGEX_ZLIB
+
+    std::string CompressGzip(const std::string& text, int level)
+    {
+        z_stream stream;
+        memset(&stream, 0, sizeof(z_stream));
+        deflateInit2(&stream, level, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+
+        std::string data(deflateBound(&stream, uLong(text.size())), 0);
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(text.data()));
+        stream.avail_in = uInt(text.size());
+        stream.next_out = reinterpret_cast<Bytef*>(data.data());
+        stream.avail_out = uInt(data.size());
+        deflate(&stream, Z_FINISH);
+
+        data.resize(stream.total_out);
+        deflateEnd(&stream);
+        return (data);
+    }
+
+    bool TestGzip(void)
+    {
+        // The first member is sized so that it ends one byte before the end of the first chunk read from a file,
+        // which leaves only the first byte of the next member's magic number in that chunk.
+
+        std::string firstText;
+        std::string firstData;
+        uint64      firstSize = kCompressionChunkSize;
+        for (machine a = 0; a < 16; a++)
+        {
+            firstText = GenerateText(firstSize, 1);
+            firstData = CompressGzip(firstText, 0);
+            int64 difference = int64(kCompressionChunkSize - 1) - int64(firstData.size());
+            if (difference == 0)
+            {
+                break;
+            }
+
+            firstSize += difference;
+        }
+
+        std::string secondText = GenerateText(300000, 2);
+        std::string data = firstData + CompressGzip(secondText, 6);
+        std::string text = firstText + secondText;
+
+        bool success = (CheckData("Two gzip members in memory", data, text) && CheckFile("Two gzip members in a file", data, text));
+
+        // Zero padding after the last member is ignored.
+
+        std::string paddedData = firstData + std::string(3, 0);
+        return ((CheckData("Padded gzip member", paddedData, firstText)) && (success));
+    }
+
+#endif
+
+#ifdef OPENGEX_ZSTD
+
+    std::string CompressZstd(const std::string& text)
+    {
+        std::string data(ZSTD_compressBound(text.size()), 0);
+        size_t      size = ZSTD_compress(data.data(), data.size(), text.data(), text.size(), 3);
+        data.resize((ZSTD_isError(size)) ? 0 : size);
+        return (data);
+    }
+
+    bool TestZstd(void)
+    {
+        std::string firstText = GenerateText(kCompressionChunkSize * 2, 3);
+        std::string secondText = GenerateText(12345, 4);
+        std::string data = CompressZstd(firstText) + CompressZstd(secondText);
+        std::string text = firstText + secondText;
+
+        return ((CheckData("Two zstd frames in memory", data, text)) && (CheckFile("Two zstd frames in a file", data, text)));
+    }
+
+#endif
+} // namespace
+
+int main(void)
+{
+    std::string text = GenerateText(1000, 5);
+    if (!CheckData("Plain text", text, text))
+    {
+        return (1);
+    }
+
+#ifdef OPENGEX_ZLIB
+
+    if (!TestGzip())
+    {
+        return (1);
+    }
+
+#endif
+
+#ifdef OPENGEX_ZSTD
+
+    if (!TestZstd())
+    {
+        return (1);
+    }
+
+#endif
+
+    printf("Decompression passed\n");
+    return (0);
+}
@@ -0,0 +1,213 @@
+#include "OpenGEX.h"
+#include "OpenGEXGenerator.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+using namespace OpenGEX;
+
+namespace
+{
+    constexpr ProcessFlags kTestProcessFlags = kProcessOptimizeVertexCache | kProcessNarrowIndexArrays | kProcessBuildMeshlets | kProcessGenerateTangents | kProcessPackSkinInfluences;
+
+    bool CompareMeshes(const MeshStructure* first, const MeshStructure* second)
+    {
+        if ((first->GetVertexCount() != second->GetVertexCount()) || (first->GetVertexArrayList()->size() != second->GetVertexArrayList()->size()) ||
+            (first->GetIndexArrayList()->size() != second->GetIndexArrayList()->size()))
+        {
+            return (false);
+        }
+
+        auto vertexIterator = second->GetVertexArrayList()->begin();
+        for (const VertexArrayStructure* vertexArrayStructure : *first->GetVertexArrayList())
+        {
+            const VertexArrayStructure* other = *vertexIterator++;
+            machine                     size = machine(vertexArrayStructure->GetVertexCount()) * vertexArrayStructure->GetComponentCount() * sizeof(float);
+            if ((vertexArrayStructure->GetAttribString() != other->GetAttribString()) || (vertexArrayStructure->GetVertexCount() != other->GetVertexCount()) ||
+                (vertexArrayStructure->GetComponentCount() != other->GetComponentCount()) || (memcmp(vertexArrayStructure->GetVertexArrayData(), other->GetVertexArrayData(), size) != 0))
+            {
+                return (false);
+            }
+        }
+
+        auto indexIterator = second->GetIndexArrayList()->begin();
+        for (const IndexArrayStructure* indexArrayStructure : *first->GetIndexArrayList())
+        {
+            const IndexArrayStructure* other = *indexIterator++;
+            machine                    size = machine(indexArrayStructure->GetIndexCount()) * indexArrayStructure->GetIndexSize();
+            if ((indexArrayStructure->GetIndexCount() != other->GetIndexCount()) || (indexArrayStructure->GetIndexSize() != other->GetIndexSize()) ||
+                (memcmp(indexArrayStructure->GetIndexArrayData(), other->GetIndexArrayData(), size) != 0))
+            {
+                return (false);
+            }
+        }
+
+        const MeshletData& meshletData = first->GetMeshletData();
+        const MeshletData& otherData = second->GetMeshletData();
+        if ((meshletData.meshletCount != otherData.meshletCount) || (meshletData.vertexCount != otherData.vertexCount) || (meshletData.triangleCount != otherData.triangleCount) ||
+            (memcmp(meshletData.vertexArray, otherData.vertexArray, machine(meshletData.vertexCount) * sizeof(uint32)) != 0) ||
+            (memcmp(meshletData.triangleArray, otherData.triangleArray, machine(meshletData.triangleCount) * 3) != 0))
+        {
+            return (false);
+        }
+
+        const SkinStructure* skinStructure = first->GetSkinStructure();
+        if (skinStructure)
+        {
+            const PackedSkinData& data = skinStructure->GetPackedSkinData();
+            const PackedSkinData& otherSkin = second->GetSkinStructure()->GetPackedSkinData();
+            machine               elementCount = machine(data.vertexCount) * data.influenceCount;
+            if ((data.vertexCount != otherSkin.vertexCount) || (data.paletteCount != otherSkin.paletteCount) ||
+                (memcmp(data.boneWeightArray, otherSkin.boneWeightArray, elementCount * GetSkinWeightSize(data.weightFormat)) != 0) ||
+                (memcmp(data.boneIndexArray, otherSkin.boneIndexArray, elementCount * data.indexSize) != 0))
+            {
+                return (false);
+            }
+        }
+
+        return (true);
+    }
+
+    bool CompareDescriptions(const OpenGexDataDescription& first, const OpenGexDataDescription& second)
+    {
+        const std::list<MeshStructure*>* meshList = first.GetMeshList();
+        const std::list<MeshStructure*>* otherList = second.GetMeshList();
+        if ((meshList->size() != otherList->size()) || (first.GetSkeletonList()->size() != second.GetSkeletonList()->size()))
+        {
+            fprintf(stderr, "The mesh or skeleton counts differ\n");
+            return (false);
+        }
+
+        int32 meshIndex = 0;
+        auto  meshIterator = otherList->begin();
+        for (const MeshStructure* meshStructure : *meshList)
+        {
+            if (!CompareMeshes(meshStructure, *meshIterator++))
+            {
+                fprintf(stderr, "Mesh %d differs\n", meshIndex);
+                return (false);
+            }
+
+            meshIndex++;
+        }
+
+        // The trees were parsed from the same text, so their structures correspond one to one.
+
+        const Structure* root = first.GetRootStructure();
+        const Structure* otherRoot = second.GetRootStructure();
+        const Structure* structure = root->GetFirstSubnode();
+        const Structure* other = otherRoot->GetFirstSubnode();
+
+        while ((structure) && (other))
+        {
+            if (structure->GetBaseStructureType() == kStructureNode)
+            {
+                const NodeStructure* nodeStructure = static_cast<const NodeStructure*>(structure);
+                const NodeStructure* otherNode = static_cast<const NodeStructure*>(other);
+                if (memcmp(&nodeStructure->GetWorldTransform(), &otherNode->GetWorldTransform(), sizeof(Transform3D)) != 0)
+                {
+                    fprintf(stderr, "The world transforms of node %s differ\n", nodeStructure->GetNodeName().c_str());
+                    return (false);
+                }
+
+                if (structure->GetStructureType() == kStructureGeometryNode)
+                {
+                    const BoundingBox& box = static_cast<const GeometryNodeStructure*>(structure)->GetWorldBoundingBox();
+                    const BoundingBox& otherBox = static_cast<const GeometryNodeStructure*>(other)->GetWorldBoundingBox();
+                    if (memcmp(&box, &otherBox, sizeof(BoundingBox)) != 0)
+                    {
+                        fprintf(stderr, "The bounding boxes of node %s differ\n", nodeStructure->GetNodeName().c_str());
+                        return (false);
+                    }
+                }
+            }
+
+            structure = structure->GetNextNode(root);
+            other = other->GetNextNode(otherRoot);
+        }
+
+        return ((!structure) && (!other));
+    }
+} // namespace
+
+int main(void)
+{
+    GeneratorParams params;
+    InitGeneratorParams(&params);
+    params.nodeCount = 12;
+    params.hierarchyDepth = 4;
+    params.meshCount = 3;
+    params.vertexCount = 400;
+    params.lodCount = 1;
+    params.morphTargetCount = 2;
+    params.boneCount = 6;
+    params.clipCount = 1;
+    params.animatedNodeCount = 4;
+
+    std::string text;
+    GenerateScene(params, &text);
+
+    OpenGexDataDescription oneShot;
+    oneShot.SetProcessFlags(kTestProcessFlags);
+
+    DataResult result = oneShot.ProcessText(text.c_str());
+    if (result != kDataOkay)
+    {
+        fprintf(stderr, "One-shot processing failed: %s\n", OpenGEX::DataResultToString(result).c_str());
+        return (1);
+    }
+
+    // A zero budget makes each slice do exactly one step.
+
+    OpenGexDataDescription incremental;
+    incremental.SetProcessFlags(kTestProcessFlags);
+    incremental.SetIncrementalFlag(true);
+
+    result = incremental.ProcessText(text.c_str());
+
+    int32 sliceCount = 0;
+    while (result == kDataOkay)
+    {
+        result = incremental.ProcessDataSlice(0.0F);
+        sliceCount++;
+
+        if (result == kDataOpenGexProcessingIncomplete)
+        {
+            result = kDataOkay;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if (result != kDataOkay)
+    {
+        fprintf(stderr, "Incremental processing failed: %s\n", OpenGEX::DataResultToString(result).c_str());
+        return (1);
+    }
+
+    // If each top-level structure were one step, the slices would be those steps, two steps for each mesh, and one step
+    // to finish each stage. Nodes are stepped into, so more slices are needed.
+
+    int32 topLevelCount = 0;
+    for (const Structure* structure = incremental.GetRootStructure()->GetFirstSubnode(); structure; structure = structure->GetNextSubnode())
+    {
+        topLevelCount++;
+    }
+
+    if (sliceCount <= topLevelCount + int32(incremental.GetMeshList()->size()) * 2 + 4)
+    {
+        fprintf(stderr, "Only %d slices were needed for %d top-level structures\n", sliceCount, topLevelCount);
+        return (1);
+    }
+
+    if (!CompareDescriptions(oneShot, incremental))
+    {
+        return (1);
+    }
+
+    printf("Incremental processing matched in %d slices\n", sliceCount);
+    return (0);
+}
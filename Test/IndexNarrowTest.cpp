@@ -0,0 +1,139 @@
+#include "OpenGEX.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace OpenGEX;
+
+namespace
+{
+    struct MeshCase
+    {
+        const char* name;
+        int32       vertexCount;
+        const char* indexType;
+        const char* indexProperties;
+        uint32      largeIndex; // Replaces the last index if nonzero.
+        int32       expectedSize;
+    };
+
+    // A fan of triangles over a row of vertices, so the largest index is one less than the vertex count.
+
+    std::vector<uint32> GenerateIndices(const MeshCase& meshCase)
+    {
+        std::vector<uint32> indexArray;
+        for (uint32 a = 1; a + 1 < uint32(meshCase.vertexCount); a++)
+        {
+            indexArray.insert(indexArray.end(), {0, a, a + 1});
+        }
+
+        if (meshCase.largeIndex != 0)
+        {
+            indexArray.back() = meshCase.largeIndex;
+        }
+
+        return (indexArray);
+    }
+
+    void AppendMesh(std::string* text, const MeshCase& meshCase)
+    {
+        *text += "GeometryObject\n{\nMesh (primitive = \"triangles\")\n{\nVertexArray (attrib = \"position\")\n{\nfloat[3]\n{\n";
+
+        char line[64];
+        for (machine a = 0; a < meshCase.vertexCount; a++)
+        {
+            snprintf(line, sizeof(line), "{%d.0, %d.0, 0.0}%s\n", int32(a), int32(a & 1), (a + 1 < meshCase.vertexCount) ? "," : "");
+            *text += line;
+        }
+
+        snprintf(line, sizeof(line), "}\n}\nIndexArray %s\n{\n%s[3]\n{\n", meshCase.indexProperties, meshCase.indexType);
+        *text += line;
+
+        std::vector<uint32> indexArray = GenerateIndices(meshCase);
+        for (machine a = 0; a < machine(indexArray.size()); a += 3)
+        {
+            snprintf(line, sizeof(line), "{%u, %u, %u}%s\n", indexArray[a], indexArray[a + 1], indexArray[a + 2], (a + 3 < machine(indexArray.size())) ? "," : "");
+            *text += line;
+        }
+
+        *text += "}\n}\n}\n}\n";
+    }
+
+    bool CheckMeshes(const MeshCase* caseArray, int32 caseCount, int32 minIndexSize)
+    {
+        std::string text;
+        for (machine a = 0; a < caseCount; a++)
+        {
+            AppendMesh(&text, caseArray[a]);
+        }
+
+        OpenGexDataDescription description;
+        description.SetProcessFlags(kProcessNarrowIndexArrays);
+        description.SetMinIndexSize(minIndexSize);
+
+        DataResult result = description.ProcessText(text.c_str());
+        if (result != kDataOkay)
+        {
+            fprintf(stderr, "ProcessText failed: %s\n", OpenGEX::DataResultToString(result).c_str());
+            return (false);
+        }
+
+        const MeshCase* meshCase = caseArray;
+        for (const MeshStructure* meshStructure : *description.GetMeshList())
+        {
+            const IndexArrayStructure* indexArrayStructure = meshStructure->GetIndexArrayList()->front();
+            if (indexArrayStructure->GetIndexSize() != meshCase->expectedSize)
+            {
+                fprintf(stderr, "The %s mesh has %d-byte indices instead of %d with a minimum of %d\n", meshCase->name, indexArrayStructure->GetIndexSize(), meshCase->expectedSize, minIndexSize);
+                return (false);
+            }
+
+            // The values must survive the conversion unchanged.
+
+            std::vector<uint32> expectedArray = GenerateIndices(*meshCase);
+            std::vector<uint32> indexArray(indexArrayStructure->GetIndexCount());
+            indexArrayStructure->ReadIndexArray(indexArray.data());
+            if (indexArray != expectedArray)
+            {
+                fprintf(stderr, "The indices of the %s mesh changed\n", meshCase->name);
+                return (false);
+            }
+
+            meshCase++;
+        }
+
+        return (true);
+    }
+} // namespace
+
+int main(void)
+{
+    static const MeshCase caseArray[5] = {
+        {"small", 200, "unsigned_int32", "", 0, 1},
+        {"medium", 300, "unsigned_int64", "", 0, 2},
+        {"restart", 200, "unsigned_int32", "(restart = 4294967295)", 0, 4},
+        {"out-of-range", 200, "unsigned_int32", "", 70000, 4},
+        {"narrow", 100, "unsigned_int8", "", 0, 1}
+    };
+
+    if (!CheckMeshes(caseArray, 5, 1))
+    {
+        return (1);
+    }
+
+    // A larger minimum keeps small meshes at that width, and arrays already narrower than it are left alone.
+
+    static const MeshCase minimumArray[2] = {
+        {"small", 200, "unsigned_int32", "", 0, 2},
+        {"narrow", 100, "unsigned_int8", "", 0, 1}
+    };
+
+    if (!CheckMeshes(minimumArray, 2, 2))
+    {
+        return (1);
+    }
+
+    printf("Index narrowing passed\n");
+    return (0);
+}
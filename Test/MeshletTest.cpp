@@ -0,0 +1,149 @@
+#include "OpenGEX.h"
+
+#include <cstdio>
+#include <string>
+
+using namespace OpenGEX;
+
+namespace
+{
+    enum
+    {
+        kGridSize = 20,
+        kGridVertexCount = (kGridSize + 1) * (kGridSize + 1),
+        kGridTriangleCount = kGridSize * kGridSize * 2
+    };
+
+    void AppendTriangles(std::string* text, int32 firstRow, int32 lastRow)
+    {
+        char line[64];
+        for (machine j = firstRow; j < lastRow; j++)
+        {
+            for (machine i = 0; i < kGridSize; i++)
+            {
+                int32 v = int32(j * (kGridSize + 1) + i);
+                snprintf(line, sizeof(line), "{%d, %d, %d}, {%d, %d, %d},\n", v, v + 1, v + kGridSize + 2, v, v + kGridSize + 2, v + kGridSize + 1);
+                *text += line;
+            }
+        }
+
+        // Remove the final comma.
+
+        text->resize(text->size() - 2);
+        *text += "\n";
+    }
+
+    // A flat grid whose triangles are split between two index arrays with different materials. Each half has many
+    // more triangles than fit in one meshlet, so both index arrays produce several meshlets.
+
+    std::string GenerateGrid(void)
+    {
+        std::string text = "GeometryObject\n{\nMesh (primitive = \"triangles\")\n{\nVertexArray (attrib = \"position\")\n{\nfloat[3]\n{\n";
+
+        char line[64];
+        for (machine j = 0; j <= kGridSize; j++)
+        {
+            for (machine i = 0; i <= kGridSize; i++)
+            {
+                snprintf(line, sizeof(line), "{%d.0, %d.0, 0.0}%s\n", int32(i), int32(j), ((i == kGridSize) && (j == kGridSize)) ? "" : ",");
+                text += line;
+            }
+        }
+
+        text += "}\n}\nIndexArray (material = 0)\n{\nunsigned_int32[3]\n{\n";
+        AppendTriangles(&text, 0, kGridSize / 2);
+        text += "}\n}\nIndexArray (material = 1)\n{\nunsigned_int32[3]\n{\n";
+        AppendTriangles(&text, kGridSize / 2, kGridSize);
+        text += "}\n}\n}\n}\n";
+
+        return (text);
+    }
+
+    bool CheckMeshlets(const MeshletData& meshletData)
+    {
+        int32  triangleTotal = 0;
+        uint32 materialMask = 0;
+
+        for (machine a = 0; a < meshletData.meshletCount; a++)
+        {
+            const Meshlet& meshlet = meshletData.meshletArray[a];
+            if ((meshlet.vertexOffset + meshlet.vertexCount > uint32(meshletData.vertexCount)) || (meshlet.triangleOffset + meshlet.triangleCount > uint32(meshletData.triangleCount)))
+            {
+                fprintf(stderr, "Meshlet %d is out of range: vertices %u + %u of %d, triangles %u + %u of %d\n", int32(a), meshlet.vertexOffset, meshlet.vertexCount,
+                        meshletData.vertexCount, meshlet.triangleOffset, meshlet.triangleCount, meshletData.triangleCount);
+                return (false);
+            }
+
+            for (machine k = 0; k < machine(meshlet.vertexCount); k++)
+            {
+                if (meshletData.vertexArray[meshlet.vertexOffset + k] >= uint32(kGridVertexCount))
+                {
+                    fprintf(stderr, "Meshlet %d references a vertex outside the mesh\n", int32(a));
+                    return (false);
+                }
+            }
+
+            for (machine k = 0; k < machine(meshlet.triangleCount * 3); k++)
+            {
+                if (meshletData.triangleArray[meshlet.triangleOffset * 3 + k] >= meshlet.vertexCount)
+                {
+                    fprintf(stderr, "Meshlet %d has a local index outside its vertices\n", int32(a));
+                    return (false);
+                }
+            }
+
+            triangleTotal += meshlet.triangleCount;
+            materialMask |= 1 << meshlet.materialIndex;
+        }
+
+        if (triangleTotal != kGridTriangleCount)
+        {
+            fprintf(stderr, "The meshlets contain %d triangles instead of %d\n", triangleTotal, kGridTriangleCount);
+            return (false);
+        }
+
+        if (materialMask != 3)
+        {
+            fprintf(stderr, "The meshlets don't have both materials\n");
+            return (false);
+        }
+
+        return (true);
+    }
+} // namespace
+
+int main(void)
+{
+    OpenGexDataDescription description;
+    description.SetProcessFlags(kProcessBuildMeshlets);
+
+    std::string text = GenerateGrid();
+    DataResult  result = description.ProcessText(text.c_str());
+    if (result != kDataOkay)
+    {
+        fprintf(stderr, "ProcessText failed: %s\n", OpenGEX::DataResultToString(result).c_str());
+        return (1);
+    }
+
+    const std::list<MeshStructure*>* meshList = description.GetMeshList();
+    if (meshList->size() != 1)
+    {
+        fprintf(stderr, "Expected one mesh\n");
+        return (1);
+    }
+
+    const MeshletData& meshletData = meshList->front()->GetMeshletData();
+    if (meshletData.meshletCount < 4)
+    {
+        fprintf(stderr, "Expected several meshlets for each index array, got %d\n", meshletData.meshletCount);
+        return (1);
+    }
+
+    if (!CheckMeshlets(meshletData))
+    {
+        return (1);
+    }
+
+    printf("%d meshlets passed\n", meshletData.meshletCount);
+    return (0);
+}
@@ -0,0 +1,145 @@
+#include "OpenGEX.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace OpenGEX;
+
+namespace
+{
+    enum
+    {
+        kGridSize = 8,
+        kGridVertexCount = kGridSize * kGridSize,
+        kMovedVertex = 10
+    };
+
+    // Morph 1 is an absolute target that raises the first row of the grid, and morph 2 is relative to morph 0
+    // and moves a single vertex. Both change only a few vertices, so they can be stored sparsely.
+
+    void GetMorphPosition(uint32 morph, machine vertex, float* position)
+    {
+        position[0] = float(vertex % kGridSize);
+        position[1] = float(vertex / kGridSize);
+        position[2] = 0.0F;
+
+        if ((morph == 1) && (vertex < kGridSize))
+        {
+            position[2] = 1.0F;
+        }
+        else if ((morph == 2) && (vertex == kMovedVertex))
+        {
+            position[0] += 2.0F;
+        }
+    }
+
+    std::string GenerateScene(const char* weightText)
+    {
+        std::string text = "GeometryNode $node1\n{\nObjectRef {ref {$geometry1}}\n";
+        text += weightText;
+        text += "}\n\nGeometryObject $geometry1\n{\nMorph (index = 1) {Name {string {\"Raise\"}}}\nMorph (index = 2, base = 0) {Name {string {\"Move\"}}}\nMesh\n{\n";
+
+        char line[64];
+        for (uint32 morph = 0; morph < 3; morph++)
+        {
+            snprintf(line, sizeof(line), "VertexArray (attrib = \"position\", morph = %u)\n{\nfloat[3]\n{\n", morph);
+            text += line;
+
+            for (machine a = 0; a < kGridVertexCount; a++)
+            {
+                float position[3];
+                GetMorphPosition(morph, a, position);
+                snprintf(line, sizeof(line), "{%g, %g, %g}%s\n", position[0], position[1], position[2], (a + 1 < kGridVertexCount) ? "," : "");
+                text += line;
+            }
+
+            text += "}\n}\n";
+        }
+
+        text += "}\n}\n";
+        return (text);
+    }
+
+    // The absolute target contributes its weight times its own positions, and the relative target contributes its
+    // weight times its difference from morph 0. Morph 0 is weighted by baseWeight.
+
+    bool CheckBlend(const char* weightText, float baseWeight, float sparseThreshold)
+    {
+        const float weight1 = 0.5F;
+        const float weight2 = 1.0F;
+
+        OpenGexDataDescription description;
+        description.SetMorphSparseThreshold(sparseThreshold);
+
+        std::string text = GenerateScene(weightText);
+        DataResult  result = description.ProcessText(text.c_str());
+        if (result != kDataOkay)
+        {
+            fprintf(stderr, "ProcessText failed: %s\n", OpenGEX::DataResultToString(result).c_str());
+            return (false);
+        }
+
+        const MeshStructure*   meshStructure = description.GetMeshList()->front();
+        const MorphStatistics& statistics = meshStructure->GetMorphStatistics();
+        if ((statistics.targetCount != 2) || (statistics.sparseTargetCount != ((sparseThreshold > 0.0F) ? 2 : 0)))
+        {
+            fprintf(stderr, "Expected two %s targets, got %d with %d sparse\n", (sparseThreshold > 0.0F) ? "sparse" : "dense", statistics.targetCount, statistics.sparseTargetCount);
+            return (false);
+        }
+
+        const GeometryNodeStructure* geometryNodeStructure = static_cast<const GeometryNodeStructure*>(description.GetRootStructure()->GetFirstSubnode());
+
+        std::vector<float> positionArray(kGridVertexCount * 3);
+        if (!meshStructure->BlendMorphTargets(geometryNodeStructure, positionArray.data(), nullptr, nullptr))
+        {
+            fprintf(stderr, "BlendMorphTargets failed\n");
+            return (false);
+        }
+
+        for (machine a = 0; a < kGridVertexCount; a++)
+        {
+            float base[3], morph1[3], morph2[3];
+            GetMorphPosition(0, a, base);
+            GetMorphPosition(1, a, morph1);
+            GetMorphPosition(2, a, morph2);
+
+            for (machine k = 0; k < 3; k++)
+            {
+                float expected = base[k] * baseWeight + morph1[k] * weight1 + (morph2[k] - base[k]) * weight2;
+                if (Fabs(positionArray[a * 3 + k] - expected) > 1.0e-5F)
+                {
+                    fprintf(stderr, "Vertex %d component %d is %g instead of %g with threshold %g\n", int32(a), int32(k), positionArray[a * 3 + k], expected, sparseThreshold);
+                    return (false);
+                }
+            }
+        }
+
+        return (true);
+    }
+} // namespace
+
+int main(void)
+{
+    for (machine s = 0; s < 2; s++)
+    {
+        float threshold = (s == 0) ? 0.0F : 0.25F;
+
+        // With a weight for morph 0, the positions are exactly the weighted sum of the morphs.
+
+        if (!CheckBlend("MorphWeight (index = 0) {float {0.25}}\nMorphWeight (index = 1) {float {0.5}}\nMorphWeight (index = 2) {float {1.0}}\n", 0.25F, threshold))
+        {
+            return (1);
+        }
+
+        // Without one, morph 0 takes the weight left by the absolute target.
+
+        if (!CheckBlend("MorphWeight (index = 1) {float {0.5}}\nMorphWeight (index = 2) {float {1.0}}\n", 0.5F, threshold))
+        {
+            return (1);
+        }
+    }
+
+    printf("Morph blending passed\n");
+    return (0);
+}
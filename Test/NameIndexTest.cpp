@@ -0,0 +1,119 @@
+#include "OpenGEX.h"
+
+#include <cstdio>
+
+using namespace OpenGEX;
+
+namespace
+{
+    // Two nodes share the object name "Box", and the local name %part is used under two different super nodes,
+    // once with a nested local name below it.
+
+    const char sceneText[] =
+        "GeometryNode $node1\n{\nName {string {\"Box\"}}\nObjectRef {ref {$geometry1}}\nMaterialRef {ref {$material1}}\n"
+        "Node $node2 {Name {string {\"Box\"}}}\nNode %part {Node %detail {}}\n}\n\n"
+        "Node $node3\n{\nName {string {\"Handle\"}}\nNode %part {}\n}\n\n"
+        "GeometryObject $geometry1\n{\nMesh\n{\nVertexArray (attrib = \"position\")\n{\nfloat[3] {{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}}\n}\n}\n}\n\n"
+        "Material $material1 {}\n";
+
+    // Every named structure in the tree has to be found under its own name, and every reference has to resolve
+    // to the same structure that OpenDDL finds by searching the tree.
+
+    bool CheckStructureNames(const OpenGexDataDescription& description)
+    {
+        const NameIndex* nameIndex = description.GetNameIndex();
+        const Structure* root = description.GetRootStructure();
+
+        int32      namedCount = 0;
+        Structure* structure = root->GetFirstSubnode();
+        while (structure)
+        {
+            const std::string& name = structure->GetStructureName();
+            if (!name.empty())
+            {
+                const Structure* found = (structure->GetGlobalNameFlag()) ? nameIndex->FindGlobalStructure(name) : nameIndex->FindLocalStructure(structure->GetSuperNode(), name);
+                if (found != structure)
+                {
+                    fprintf(stderr, "The structure named %s%s wasn't found\n", (structure->GetGlobalNameFlag()) ? "$" : "%", name.c_str());
+                    return (false);
+                }
+
+                namedCount++;
+            }
+
+            if (structure->GetStructureType() == kDataRef)
+            {
+                const DataStructure<RefDataType>* dataStructure = static_cast<const DataStructure<RefDataType>*>(structure);
+                for (machine a = 0; a < machine(dataStructure->GetDataElementCount()); a++)
+                {
+                    const StructureRef& reference = dataStructure->GetDataElement(int32(a));
+                    if (nameIndex->FindStructure(reference) != description.FindStructure(reference))
+                    {
+                        fprintf(stderr, "A reference resolved differently than it does in OpenDDL\n");
+                        return (false);
+                    }
+                }
+            }
+
+            structure = structure->GetNextNode(root);
+        }
+
+        if (namedCount != 8)
+        {
+            fprintf(stderr, "Found %d named structures instead of 8\n", namedCount);
+            return (false);
+        }
+
+        return (true);
+    }
+} // namespace
+
+int main(void)
+{
+    OpenGexDataDescription description;
+    DataResult             result = description.ProcessText(sceneText);
+    if (result != kDataOkay)
+    {
+        fprintf(stderr, "ProcessText failed: %s\n", OpenGEX::DataResultToString(result).c_str());
+        return (1);
+    }
+
+    if (!CheckStructureNames(description))
+    {
+        return (1);
+    }
+
+    const NameIndex* nameIndex = description.GetNameIndex();
+    const Structure* node1 = nameIndex->FindGlobalStructure("node1");
+    const Structure* node3 = nameIndex->FindGlobalStructure("node3");
+    const Structure* part1 = nameIndex->FindLocalStructure(node1, "part");
+    const Structure* part3 = nameIndex->FindLocalStructure(node3, "part");
+
+    // Local names are scoped to their super node and aren't visible globally or from other nodes.
+
+    if ((!part1) || (!part3) || (part1 == part3) || (nameIndex->FindGlobalStructure("part")) || (nameIndex->FindLocalStructure(node1, "detail")) || (!nameIndex->FindLocalStructure(part1, "detail")))
+    {
+        fprintf(stderr, "Local names were not scoped to their super nodes\n");
+        return (1);
+    }
+
+    // Names that were never seen aren't interned by a lookup.
+
+    int32 stringCount = nameIndex->GetStringCount();
+    if ((nameIndex->FindGlobalStructure("missing")) || (nameIndex->FindString("missing") != kNameInvalid) || (nameIndex->GetStringCount() != stringCount))
+    {
+        fprintf(stderr, "Looking up a missing name changed the index\n");
+        return (1);
+    }
+
+    // The first node with an object name is kept when the name is repeated.
+
+    if ((description.FindNode("Box") != node1) || (description.FindNode("Handle") != node3) || (description.FindNode("Missing")))
+    {
+        fprintf(stderr, "Nodes were not found by their object names\n");
+        return (1);
+    }
+
+    printf("Name index passed\n");
+    return (0);
+}
@@ -0,0 +1,132 @@
+#include "OpenGEX.h"
+#include "OpenGEXGenerator.h"
+
+#include <cstdio>
+#include <string>
+
+using namespace OpenGEX;
+
+namespace
+{
+    enum
+    {
+        kBoneCount = 5,
+        kPackedInfluenceCount = 3
+    };
+
+    // With 8-bit weights, the weight array takes one byte per influence. A 9 x 9 grid packed with three influences
+    // per vertex has an odd number of influences, so the arrays after the weights have to be aligned explicitly.
+
+    bool CheckPackedSkin(const PackedSkinData& data)
+    {
+        if ((data.vertexCount * data.influenceCount) % 2 == 0)
+        {
+            fprintf(stderr, "The influence total %d isn't odd\n", data.vertexCount * data.influenceCount);
+            return (false);
+        }
+
+        if (((reinterpret_cast<uintptr_t>(data.paletteArray) & 15) != 0) || ((reinterpret_cast<uintptr_t>(data.boneIndexArray) & 15) != 0))
+        {
+            fprintf(stderr, "The palette or index array isn't aligned to 16 bytes\n");
+            return (false);
+        }
+
+        for (machine a = 0; a < data.paletteCount; a++)
+        {
+            if (data.paletteArray[a] >= kBoneCount)
+            {
+                fprintf(stderr, "Palette entry %d refers to bone %d\n", int32(a), data.paletteArray[a]);
+                return (false);
+            }
+        }
+
+        const uint8*  weightArray = static_cast<const uint8*>(data.boneWeightArray);
+        const uint16* indexArray = static_cast<const uint16*>(data.boneIndexArray);
+
+        for (machine v = 0; v < data.vertexCount; v++)
+        {
+            int32 weightSum = 0;
+            for (machine k = 0; k < data.influenceCount; k++)
+            {
+                machine element = (data.planarFlag) ? k * data.vertexCount + v : v * data.influenceCount + k;
+                if ((weightArray[element] != 0) && (indexArray[element] >= data.paletteCount))
+                {
+                    fprintf(stderr, "Vertex %d has an index outside the palette\n", int32(v));
+                    return (false);
+                }
+
+                weightSum += weightArray[element];
+            }
+
+            if (weightSum != 255)
+            {
+                fprintf(stderr, "The weights of vertex %d sum to %d\n", int32(v), weightSum);
+                return (false);
+            }
+        }
+
+        return (true);
+    }
+} // namespace
+
+int main(void)
+{
+    GeneratorParams params;
+    InitGeneratorParams(&params);
+    params.nodeCount = 1;
+    params.hierarchyDepth = 1;
+    params.meshCount = 1;
+    params.vertexCount = 81;
+    params.lodCount = 0;
+    params.boneCount = kBoneCount;
+    params.influenceCount = 4;
+    params.clipCount = 0;
+
+    std::string text;
+    GenerateScene(params, &text);
+
+    for (machine planar = 0; planar < 2; planar++)
+    {
+        SkinPackFormat format;
+        format.influenceCount = kPackedInfluenceCount;
+        format.indexSize = 2;
+        format.weightFormat = kSkinWeightUnorm8;
+        format.planarFlag = (planar != 0);
+        format.compactPaletteFlag = false;
+
+        OpenGexDataDescription description;
+        description.SetProcessFlags(kProcessPackSkinInfluences);
+        description.SetSkinPackFormat(format);
+
+        DataResult result = description.ProcessText(text.c_str());
+        if (result != kDataOkay)
+        {
+            fprintf(stderr, "ProcessText failed: %s\n", OpenGEX::DataResultToString(result).c_str());
+            return (1);
+        }
+
+        int32 skinCount = 0;
+        for (const MeshStructure* meshStructure : *description.GetMeshList())
+        {
+            const SkinStructure* skinStructure = meshStructure->GetSkinStructure();
+            if (skinStructure)
+            {
+                if (!CheckPackedSkin(skinStructure->GetPackedSkinData()))
+                {
+                    return (1);
+                }
+
+                skinCount++;
+            }
+        }
+
+        if (skinCount == 0)
+        {
+            fprintf(stderr, "The scene has no skins\n");
+            return (1);
+        }
+    }
+
+    printf("Skin packing passed\n");
+    return (0);
+}
@@ -0,0 +1,230 @@
+#include "OpenGEX.h"
+
+#include <cstdio>
+#include <vector>
+
+using namespace OpenGEX;
+
+namespace
+{
+    enum
+    {
+        kPatternCount = 7,
+        kPaletteCount = 5,
+        kVertexCount = kSkinningBlockSize * 2 + 100
+    };
+
+    struct InfluencePattern
+    {
+        int32  count;
+        uint16 boneIndex[2];
+        float  boneWeight[2];
+    };
+
+    // Bone 0 is the identity, bone 1 moves up by two, bone 2 rotates a quarter turn about z and moves along x,
+    // bone 3 doubles the size and moves along z, and bone 4 only rotates a quarter turn about z. Bone 7 is past
+    // the end of the palette. The last pattern blends the identity with a rotation, where the two methods differ.
+
+    const InfluencePattern patternArray[kPatternCount] = {
+        {1, {1, 0}, {1.0F, 0.0F}},
+        {2, {0, 1}, {0.25F, 0.25F}},
+        {2, {7, 2}, {1.0F, 1.0F}},
+        {0, {0, 0}, {0.0F, 0.0F}},
+        {1, {2, 0}, {0.5F, 0.0F}},
+        {1, {3, 0}, {1.0F, 0.0F}},
+        {2, {0, 4}, {0.5F, 0.5F}}
+    };
+
+    void GetPalette(Transform3D* paletteArray)
+    {
+        paletteArray[0] = Transform3D(1.0F, 0.0F, 0.0F, 0.0F, 0.0F, 1.0F, 0.0F, 0.0F, 0.0F, 0.0F, 1.0F, 0.0F);
+        paletteArray[1] = Transform3D(1.0F, 0.0F, 0.0F, 0.0F, 0.0F, 1.0F, 0.0F, 2.0F, 0.0F, 0.0F, 1.0F, 0.0F);
+        paletteArray[2] = Transform3D(0.0F, -1.0F, 0.0F, 1.0F, 1.0F, 0.0F, 0.0F, 0.0F, 0.0F, 0.0F, 1.0F, 0.0F);
+        paletteArray[3] = Transform3D(2.0F, 0.0F, 0.0F, 0.0F, 0.0F, 2.0F, 0.0F, 0.0F, 0.0F, 0.0F, 2.0F, 3.0F);
+        paletteArray[4] = Transform3D(0.0F, -1.0F, 0.0F, 0.0F, 1.0F, 0.0F, 0.0F, 0.0F, 0.0F, 0.0F, 1.0F, 0.0F);
+    }
+
+    void GetVertex(machine vertex, float* position, float* normal, float* tangent)
+    {
+        position[0] = float(vertex % 17);
+        position[1] = float(vertex / 17) * 0.1F;
+        position[2] = 1.0F;
+
+        normal[0] = 0.6F;
+        normal[1] = 0.0F;
+        normal[2] = 0.8F;
+
+        // Tangents carry a handedness in the fourth component.
+
+        tangent[0] = 0.0F;
+        tangent[1] = 0.8F;
+        tangent[2] = -0.6F;
+        tangent[3] = 1.0F;
+    }
+
+    // Calculates the expected result for one attribute of a vertex. Directions ignore translation and scale.
+    // With a short palette, the influences of bones 3 and 4 are ignored, which leaves the vertices unchanged.
+
+    void TransformExpected(int32 pattern, const float* v, bool direction, int32 method, int32 paletteCount, float* output)
+    {
+        float s = (direction) ? 0.0F : 1.0F;
+
+        if ((pattern >= 5) && (paletteCount < kPaletteCount))
+        {
+            pattern = 3;
+        }
+
+        switch (pattern)
+        {
+        case 0:
+
+            output[0] = v[0];
+            output[1] = v[1] + s * 2.0F;
+            output[2] = v[2];
+            break;
+
+        case 1:
+
+            output[0] = v[0];
+            output[1] = v[1] + s;
+            output[2] = v[2];
+            break;
+
+        case 2:
+        case 4:
+
+            output[0] = s - v[1];
+            output[1] = v[0];
+            output[2] = v[2];
+            break;
+
+        case 5:
+        {
+            float scale = (direction) ? 1.0F : 2.0F;
+            output[0] = v[0] * scale;
+            output[1] = v[1] * scale;
+            output[2] = v[2] * scale + s * 3.0F;
+            break;
+        }
+
+        case 6:
+        {
+            // Linear blending averages the matrices, which shrinks positions and leaves directions to be renormalized.
+            // Dual quaternion blending gives an eighth turn.
+
+            float c = (method == kSkinningDualQuaternion) ? Sqrt(0.5F) : 0.5F;
+            output[0] = (v[0] - v[1]) * c;
+            output[1] = (v[0] + v[1]) * c;
+            output[2] = v[2];
+
+            if ((direction) && (method != kSkinningDualQuaternion))
+            {
+                float m = InverseSqrt(output[0] * output[0] + output[1] * output[1] + output[2] * output[2]);
+                output[0] *= m;
+                output[1] *= m;
+                output[2] *= m;
+            }
+
+            break;
+        }
+
+        default:
+
+            output[0] = v[0];
+            output[1] = v[1];
+            output[2] = v[2];
+            break;
+        }
+    }
+
+    bool CheckSkinning(int32 method, int32 paletteCount, ThreadPool* threadPool)
+    {
+        Transform3D paletteArray[kPaletteCount];
+        GetPalette(paletteArray);
+
+        std::vector<uint16> boneCountArray(kVertexCount);
+        std::vector<uint16> boneIndexArray;
+        std::vector<float>  boneWeightArray;
+
+        std::vector<float> positionArray(kVertexCount * 3);
+        std::vector<float> normalArray(kVertexCount * 3);
+        std::vector<float> tangentArray(kVertexCount * 4);
+
+        for (machine a = 0; a < kVertexCount; a++)
+        {
+            const InfluencePattern& influence = patternArray[a % kPatternCount];
+            boneCountArray[a] = uint16(influence.count);
+            for (machine k = 0; k < influence.count; k++)
+            {
+                boneIndexArray.push_back(influence.boneIndex[k]);
+                boneWeightArray.push_back(influence.boneWeight[k]);
+            }
+
+            GetVertex(a, &positionArray[a * 3], &normalArray[a * 3], &tangentArray[a * 4]);
+        }
+
+        std::vector<float> skinnedPosition(kVertexCount * 3);
+        std::vector<float> skinnedNormal(kVertexCount * 3);
+        std::vector<float> skinnedTangent(kVertexCount * 3);
+
+        SkinningStream positionStream = {positionArray.data(), 3, skinnedPosition.data()};
+        SkinningStream normalStream = {normalArray.data(), 3, skinnedNormal.data()};
+        SkinningStream tangentStream = {tangentArray.data(), 4, skinnedTangent.data()};
+
+        if (method == kSkinningDualQuaternion)
+        {
+            SkinVerticesDualQuaternion(paletteArray, paletteCount, boneCountArray.data(), boneIndexArray.data(), boneWeightArray.data(), kVertexCount, positionStream, normalStream, tangentStream, threadPool);
+        }
+        else
+        {
+            SkinVertices(paletteArray, paletteCount, boneCountArray.data(), boneIndexArray.data(), boneWeightArray.data(), kVertexCount, positionStream, normalStream, tangentStream, threadPool);
+        }
+
+        for (machine a = 0; a < kVertexCount; a++)
+        {
+            int32 pattern = int32(a % kPatternCount);
+
+            float expected[3][3];
+            TransformExpected(pattern, &positionArray[a * 3], false, method, paletteCount, expected[0]);
+            TransformExpected(pattern, &normalArray[a * 3], true, method, paletteCount, expected[1]);
+            TransformExpected(pattern, &tangentArray[a * 4], true, method, paletteCount, expected[2]);
+
+            const float* skinned[3] = {&skinnedPosition[a * 3], &skinnedNormal[a * 3], &skinnedTangent[a * 3]};
+            for (machine i = 0; i < 3; i++)
+            {
+                for (machine k = 0; k < 3; k++)
+                {
+                    if (Fabs(skinned[i][k] - expected[i][k]) > 1.0e-5F)
+                    {
+                        fprintf(stderr, "%s skinning of vertex %d attribute %d component %d with %d bones is %g instead of %g%s\n", (method == kSkinningDualQuaternion) ? "Dual quaternion" : "Linear blend", int32(a), int32(i), int32(k), paletteCount, skinned[i][k], expected[i][k], (threadPool) ? " with a thread pool" : "");
+                        return (false);
+                    }
+                }
+            }
+        }
+
+        return (true);
+    }
+} // namespace
+
+int main(void)
+{
+    // There are enough vertices for several blocks, so the thread pool splits the influences at block boundaries.
+    // Dual quaternion skinning only applies the stretch matrices when some bone has scale, so it is also checked
+    // with a palette that stops before the scaled bone.
+
+    ThreadPool threadPool(4);
+    for (int32 method = kSkinningLinearBlend; method <= kSkinningDualQuaternion; method++)
+    {
+        for (int32 paletteCount = 3; paletteCount <= kPaletteCount; paletteCount += kPaletteCount - 3)
+        {
+            if ((!CheckSkinning(method, paletteCount, nullptr)) || (!CheckSkinning(method, paletteCount, &threadPool)))
+            {
+                return (1);
+            }
+        }
+    }
+
+    printf("Skinning passed\n");
+    return (0);
+}
@@ -0,0 +1,143 @@
+#include "OpenGEX.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace OpenGEX;
+
+namespace
+{
+    enum
+    {
+        kGridSize = 8,
+        kGridVertexCount = (kGridSize + 1) * (kGridSize + 1)
+    };
+
+    // Row-major grid triangles thrash a small cache, so the optimized order is measurably better.
+
+    std::vector<uint32> GenerateGridIndices(void)
+    {
+        std::vector<uint32> indexArray;
+        for (machine j = 0; j < kGridSize; j++)
+        {
+            for (machine i = 0; i < kGridSize; i++)
+            {
+                uint32 v = uint32(j * (kGridSize + 1) + i);
+                indexArray.insert(indexArray.end(), {v, v + 1, v + kGridSize + 2, v, v + kGridSize + 2, v + kGridSize + 1});
+            }
+        }
+
+        return (indexArray);
+    }
+
+    void AppendGridMesh(std::string* text, const std::vector<uint32>& indexArray, const char* indexProperties)
+    {
+        *text += "GeometryObject\n{\nMesh (primitive = \"triangles\")\n{\nVertexArray (attrib = \"position\")\n{\nfloat[3]\n{\n";
+
+        char line[64];
+        for (machine j = 0; j <= kGridSize; j++)
+        {
+            for (machine i = 0; i <= kGridSize; i++)
+            {
+                snprintf(line, sizeof(line), "{%d.0, %d.0, 0.0}%s\n", int32(i), int32(j), ((i == kGridSize) && (j == kGridSize)) ? "" : ",");
+                *text += line;
+            }
+        }
+
+        *text += "}\n}\nIndexArray ";
+        *text += indexProperties;
+        *text += "\n{\nunsigned_int32[3]\n{\n";
+
+        for (machine a = 0; a < machine(indexArray.size()); a += 3)
+        {
+            snprintf(line, sizeof(line), "{%u, %u, %u}%s\n", indexArray[a], indexArray[a + 1], indexArray[a + 2], (a + 3 < machine(indexArray.size())) ? "," : "");
+            *text += line;
+        }
+
+        *text += "}\n}\n}\n}\n";
+    }
+
+    bool CheckOriginalOrder(const MeshStructure* meshStructure, const std::vector<uint32>& indexArray)
+    {
+        const IndexArrayStructure* indexArrayStructure = meshStructure->GetIndexArrayList()->front();
+        if (indexArrayStructure->GetIndexCount() != uint32(indexArray.size()))
+        {
+            return (false);
+        }
+
+        std::vector<uint32> readArray(indexArray.size());
+        indexArrayStructure->ReadIndexArray(readArray.data());
+        return (readArray == indexArray);
+    }
+} // namespace
+
+int main(void)
+{
+    std::vector<uint32> gridArray = GenerateGridIndices();
+
+    // The second mesh declares a restart value, and the third has an index past the end of its vertex arrays.
+    // Neither can be optimized, but both have to load with their triangles in the original order.
+
+    std::vector<uint32> outOfRangeArray = gridArray;
+    outOfRangeArray[4] = kGridVertexCount + 10;
+
+    std::string text;
+    AppendGridMesh(&text, gridArray, "");
+    AppendGridMesh(&text, gridArray, "(restart = 4294967295)");
+    AppendGridMesh(&text, outOfRangeArray, "");
+
+    // Cache sizes outside the supported range are clamped instead of reaching the optimizer.
+
+    OpenGexDataDescription description;
+    description.SetProcessFlags(kProcessOptimizeVertexCache);
+    description.SetVertexCacheSize(0);
+
+    if (description.GetVertexCacheSize() != kVertexCacheMinSize)
+    {
+        fprintf(stderr, "A cache size of zero was stored as %d\n", description.GetVertexCacheSize());
+        return (1);
+    }
+
+    DataResult result = description.ProcessText(text.c_str());
+    if (result != kDataOkay)
+    {
+        fprintf(stderr, "ProcessText failed: %s\n", OpenGEX::DataResultToString(result).c_str());
+        return (1);
+    }
+
+    const std::list<MeshStructure*>* meshList = description.GetMeshList();
+    if (meshList->size() != 3)
+    {
+        fprintf(stderr, "Expected three meshes\n");
+        return (1);
+    }
+
+    auto                 meshIterator = meshList->begin();
+    const MeshStructure* optimizedMesh = *meshIterator++;
+    const MeshStructure* restartMesh = *meshIterator++;
+    const MeshStructure* outOfRangeMesh = *meshIterator;
+
+    float originalAcmr = optimizedMesh->GetOriginalCacheStatistics().acmr;
+    float optimizedAcmr = optimizedMesh->GetOptimizedCacheStatistics().acmr;
+    if ((originalAcmr <= 0.0F) || (optimizedAcmr >= originalAcmr))
+    {
+        fprintf(stderr, "The ACMR went from %f to %f\n", originalAcmr, optimizedAcmr);
+        return (1);
+    }
+
+    if ((!CheckOriginalOrder(restartMesh, gridArray)) || (restartMesh->GetOriginalCacheStatistics().acmr != 0.0F))
+    {
+        fprintf(stderr, "The mesh with a restart value was reordered\n");
+        return (1);
+    }
+
+    if ((!CheckOriginalOrder(outOfRangeMesh, outOfRangeArray)) || (outOfRangeMesh->GetOriginalCacheStatistics().acmr != 0.0F))
+    {
+        fprintf(stderr, "The mesh with an out-of-range index was reordered\n");
+        return (1);
+    }
+
+    printf("Vertex cache optimization passed with an ACMR of %f, down from %f\n", optimizedAcmr, originalAcmr);
+    return (0);
+}
@@ -0,0 +1,153 @@
+#include "OpenGEX.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace OpenGEX;
+
+namespace
+{
+    enum
+    {
+        kGridSize = 8,
+        kGridVertexCount = (kGridSize + 1) * (kGridSize + 1),
+        kTriangleVertexCount = kGridSize * kGridSize * 6
+    };
+
+    // The grid is written as a triangle list without an index array, so every triangle has its own copies of its
+    // corners. Each copy is moved by a different amount much smaller than the weld epsilon. The left and right
+    // halves of the grid have opposite normals, so the vertices on the middle column can't be merged across it.
+
+    void GetTriangleVertex(machine vertex, float* position, float* normal)
+    {
+        static const int32 cornerOffset[6][2] = {{0, 0}, {1, 0}, {1, 1}, {0, 0}, {1, 1}, {0, 1}};
+
+        machine cell = vertex / 6;
+        machine i = cell % kGridSize;
+        machine j = cell / kGridSize;
+        float   jitter = float(vertex) * 1.0e-5F;
+
+        position[0] = float(i + cornerOffset[vertex % 6][0]) + jitter;
+        position[1] = float(j + cornerOffset[vertex % 6][1]) - jitter;
+        position[2] = 0.0F;
+
+        normal[0] = 0.0F;
+        normal[1] = 0.0F;
+        normal[2] = (i < kGridSize / 2) ? 1.0F : -1.0F;
+    }
+
+    std::string GenerateMesh(void)
+    {
+        std::string text = "GeometryObject\n{\nMesh (primitive = \"triangles\")\n{\n";
+
+        char line[64];
+        for (machine k = 0; k < 2; k++)
+        {
+            text += (k == 0) ? "VertexArray (attrib = \"position\")\n{\nfloat[3]\n{\n" : "VertexArray (attrib = \"normal\")\n{\nfloat[3]\n{\n";
+
+            for (machine a = 0; a < kTriangleVertexCount; a++)
+            {
+                float position[3], normal[3];
+                GetTriangleVertex(a, position, normal);
+
+                const float* v = (k == 0) ? position : normal;
+                snprintf(line, sizeof(line), "{%.9g, %.9g, %.9g}%s\n", v[0], v[1], v[2], (a + 1 < kTriangleVertexCount) ? "," : "");
+                text += line;
+            }
+
+            text += "}\n}\n";
+        }
+
+        text += "}\n}\n";
+        return (text);
+    }
+
+    bool CheckWeld(float epsilon, int32 expectedCount)
+    {
+        OpenGexDataDescription description;
+        description.SetProcessFlags(kProcessWeldVertices);
+        description.SetWeldEpsilon("position", epsilon);
+
+        std::string text = GenerateMesh();
+        DataResult  result = description.ProcessText(text.c_str());
+        if (result != kDataOkay)
+        {
+            fprintf(stderr, "ProcessText failed: %s\n", OpenGEX::DataResultToString(result).c_str());
+            return (false);
+        }
+
+        const MeshStructure*  meshStructure = description.GetMeshList()->front();
+        const WeldStatistics& statistics = meshStructure->GetWeldStatistics();
+        if ((statistics.originalVertexCount != kTriangleVertexCount) || (statistics.weldedVertexCount != expectedCount) || (meshStructure->GetVertexCount() != expectedCount))
+        {
+            fprintf(stderr, "Welding %d vertices with an epsilon of %g left %d (%d in the mesh) instead of %d\n", statistics.originalVertexCount, epsilon, statistics.weldedVertexCount, meshStructure->GetVertexCount(), expectedCount);
+            return (false);
+        }
+
+        // When vertices were merged, the new index array has to reproduce every triangle, with each corner no
+        // farther from its original position than the epsilon and with exactly the original normal.
+
+        if (expectedCount == kTriangleVertexCount)
+        {
+            return (meshStructure->GetIndexArrayList()->empty());
+        }
+
+        const IndexArrayStructure* indexArrayStructure = meshStructure->GetIndexArrayList()->front();
+        if (indexArrayStructure->GetIndexCount() != uint32(kTriangleVertexCount))
+        {
+            fprintf(stderr, "The welded mesh has %u indices instead of %d\n", indexArrayStructure->GetIndexCount(), int32(kTriangleVertexCount));
+            return (false);
+        }
+
+        std::vector<uint32> indexArray(kTriangleVertexCount);
+        indexArrayStructure->ReadIndexArray(indexArray.data());
+
+        const float* positionArray = static_cast<const float*>(meshStructure->FindVertexArray("position")->GetVertexArrayData());
+        const float* normalArray = static_cast<const float*>(meshStructure->FindVertexArray("normal")->GetVertexArrayData());
+
+        for (machine a = 0; a < kTriangleVertexCount; a++)
+        {
+            float position[3], normal[3];
+            GetTriangleVertex(a, position, normal);
+
+            uint32 index = indexArray[a];
+            if (index >= uint32(expectedCount))
+            {
+                fprintf(stderr, "Index %d is %u, past the end of the welded vertices\n", int32(a), index);
+                return (false);
+            }
+
+            for (machine k = 0; k < 3; k++)
+            {
+                if ((Fabs(positionArray[index * 3 + k] - position[k]) > epsilon) || (normalArray[index * 3 + k] != normal[k]))
+                {
+                    fprintf(stderr, "Vertex %d moved to index %u with different attributes\n", int32(a), index);
+                    return (false);
+                }
+            }
+        }
+
+        return (true);
+    }
+} // namespace
+
+int main(void)
+{
+    // Every grid vertex becomes a single vertex except those on the middle column, which keep one copy for each normal.
+
+    if (!CheckWeld(0.01F, kGridVertexCount + kGridSize + 1))
+    {
+        return (1);
+    }
+
+    // With exact matching, the moved copies are all different and nothing is merged.
+
+    if (!CheckWeld(0.0F, kTriangleVertexCount))
+    {
+        return (1);
+    }
+
+    printf("Vertex welding passed\n");
+    return (0);
+}